@@ -0,0 +1,179 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <random>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset10.hpp"
+
+#include "samples/args_helper.hpp"
+#include "samples/common.hpp"
+#include "samples/latency_metrics.hpp"
+#include "samples/slog.hpp"
+// clang-format on
+
+using Ms = std::chrono::duration<double, std::ratio<1, 1000>>;
+
+namespace {
+struct WeightsFormat {
+    std::string name;
+    ov::element::Type precision;
+    size_t group_size;  // 0 means per output channel decompression
+    bool with_zero_point;
+};
+
+template <typename T>
+std::vector<T> random_vector(size_t size, int from, int to, std::mt19937& gen) {
+    std::uniform_int_distribution<int> distribution(from, to);
+    std::vector<T> values(size);
+    for (auto& value : values)
+        value = static_cast<T>(distribution(gen));
+    return values;
+}
+
+std::vector<float> random_scales(size_t size, std::mt19937& gen) {
+    std::uniform_real_distribution<float> distribution(0.001f, 0.01f);
+    std::vector<float> values(size);
+    for (auto& value : values)
+        value = distribution(gen);
+    return values;
+}
+
+// Creates [OC, IC] f32 weights or their compressed representation with the decompression subgraph
+ov::Output<ov::Node> make_weights(const WeightsFormat& format, size_t oc, size_t ic, std::mt19937& gen) {
+    using namespace ov::opset10;
+    if (format.precision == ov::element::f32) {
+        return std::make_shared<Constant>(ov::element::f32, ov::Shape{oc, ic}, random_scales(oc * ic, gen));
+    }
+
+    const size_t groups = format.group_size ? ic / format.group_size : 1;
+    const ov::Shape weights_shape = format.group_size ? ov::Shape{oc, groups, format.group_size} : ov::Shape{oc, ic};
+    const ov::Shape decompression_shape = format.group_size ? ov::Shape{oc, groups, 1} : ov::Shape{oc, 1};
+    // Compressed values are generated within the precision range: [0, 255] for u8, [0, 15] for u4 and [-8, 7] for i4
+    auto make_compressed_constant = [&](const ov::Shape& shape) {
+        if (format.precision == ov::element::u8)
+            return std::make_shared<Constant>(format.precision, shape, random_vector<uint8_t>(ov::shape_size(shape), 0, 255, gen));
+        const int min_value = format.precision == ov::element::i4 ? -8 : 0;
+        return std::make_shared<Constant>(format.precision,
+                                          shape,
+                                          random_vector<int8_t>(ov::shape_size(shape), min_value, min_value + 15, gen));
+    };
+
+    ov::Output<ov::Node> weights = std::make_shared<Convert>(make_compressed_constant(weights_shape), ov::element::f32);
+    if (format.with_zero_point) {
+        auto zero_point = std::make_shared<Convert>(make_compressed_constant(decompression_shape), ov::element::f32);
+        weights = std::make_shared<Subtract>(weights, zero_point);
+    }
+    auto scale = std::make_shared<Constant>(ov::element::f32,
+                                            decompression_shape,
+                                            random_scales(ov::shape_size(decompression_shape), gen));
+    weights = std::make_shared<Multiply>(weights, scale);
+    if (format.group_size) {
+        auto target_shape = Constant::create(ov::element::i64, ov::Shape{2}, {oc, ic});
+        weights = std::make_shared<Reshape>(weights, target_shape, false);
+    }
+    return weights;
+}
+
+// A stack of square FullyConnected layers processing a sequence of tokens, similar to the decoder of an LLM
+std::shared_ptr<ov::Model> make_model(const WeightsFormat& format, size_t hidden_size, size_t layers) {
+    std::mt19937 gen(1);
+    auto data = std::make_shared<ov::opset10::Parameter>(ov::element::f32,
+                                                         ov::PartialShape{1, -1, static_cast<int64_t>(hidden_size)});
+    ov::Output<ov::Node> output = data;
+    for (size_t i = 0; i < layers; i++) {
+        auto weights = make_weights(format, hidden_size, hidden_size, gen);
+        output = std::make_shared<ov::opset10::MatMul>(output, weights, false, true);
+    }
+    return std::make_shared<ov::Model>(ov::OutputVector{output}, ov::ParameterVector{data}, format.name);
+}
+
+LatencyMetrics measure_latency(ov::InferRequest& ireq, size_t tokens, size_t hidden_size, const std::string& name) {
+    ov::Tensor input{ov::element::f32, ov::Shape{1, tokens, hidden_size}};
+    fill_tensor_random(input);
+    ireq.set_input_tensor(input);
+    // Warm up
+    ireq.infer();
+    // Benchmark for seconds_to_run seconds and at least niter iterations
+    std::chrono::seconds seconds_to_run{2};
+    size_t niter = 10;
+    std::vector<double> latencies;
+    auto time_point = std::chrono::steady_clock::now();
+    auto time_point_to_finish = time_point + seconds_to_run;
+    while (time_point < time_point_to_finish || latencies.size() < niter) {
+        ireq.infer();
+        auto iter_end = std::chrono::steady_clock::now();
+        latencies.push_back(std::chrono::duration_cast<Ms>(iter_end - time_point).count());
+        time_point = iter_end;
+    }
+    return LatencyMetrics{latencies, name, 50};
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        slog::info << "OpenVINO:" << slog::endl;
+        slog::info << ov::get_openvino_version();
+        if (argc > 5) {
+            slog::info << "Usage : " << argv[0] << " [<hidden_size>] [<layers>] [<group_size>] [<max_tokens>]"
+                       << slog::endl;
+            return EXIT_FAILURE;
+        }
+        const size_t hidden_size = argc > 1 ? std::stoul(argv[1]) : 4096;
+        const size_t layers = argc > 2 ? std::stoul(argv[2]) : 8;
+        const size_t group_size = argc > 3 ? std::stoul(argv[3]) : 128;
+        const size_t max_tokens = argc > 4 ? std::stoul(argv[4]) : 256;
+        if (group_size == 0 || hidden_size % group_size != 0) {
+            slog::err << "Hidden size must be divisible by the group size" << slog::endl;
+            return EXIT_FAILURE;
+        }
+
+        const std::vector<WeightsFormat> formats = {
+            {"f32", ov::element::f32, 0, false},
+            {"u8_per_channel", ov::element::u8, 0, true},
+            {"u4_per_channel", ov::element::u4, 0, true},
+            {"u4_group_" + std::to_string(group_size), ov::element::u4, group_size, true},
+            {"i4_group_" + std::to_string(group_size), ov::element::i4, group_size, false},
+        };
+
+        // A single token is the next token generation, longer sequences are the prompt processing
+        std::vector<size_t> token_counts;
+        for (size_t tokens = 1; tokens <= max_tokens; tokens *= 4)
+            token_counts.push_back(tokens);
+
+        ov::Core core;
+        ov::AnyMap latency{{ov::hint::performance_mode.name(), ov::hint::PerformanceMode::LATENCY}};
+        // results[format][tokens]
+        std::vector<std::vector<LatencyMetrics>> results;
+        for (const auto& format : formats) {
+            slog::info << "Benchmarking " << format.name << " weights: " << layers << " layers of " << hidden_size << "x"
+                       << hidden_size << slog::endl;
+            ov::CompiledModel compiled_model = core.compile_model(make_model(format, hidden_size, layers), "CPU", latency);
+            ov::InferRequest ireq = compiled_model.create_infer_request();
+            results.emplace_back();
+            for (const size_t tokens : token_counts) {
+                results.back().push_back(measure_latency(ireq, tokens, hidden_size, format.name));
+            }
+        }
+
+        // Report results
+        for (size_t t = 0; t < token_counts.size(); t++) {
+            const double reference = results.front()[t].median_or_percentile;
+            slog::info << "Latency of " << token_counts[t] << " token(s):" << slog::endl;
+            for (const auto& format_results : results) {
+                const auto& result = format_results[t];
+                slog::info << "\t" << result.data_shape << ": median " << double_to_string(result.median_or_percentile)
+                           << " ms, min " << double_to_string(result.min) << " ms, speedup vs f32 "
+                           << double_to_string(reference / result.median_or_percentile) << "x" << slog::endl;
+            }
+        }
+    } catch (const std::exception& ex) {
+        slog::err << ex.what() << slog::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -196,6 +196,25 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for arrivals settings
+static const char arrivals_message[] =
+    "Optional. Defines how the infer requests arrive: \"closed\" - a new request is submitted as soon as one of "
+    "-nireq requests finishes (default), \"poisson\" - open loop, the requests arrive independently with the "
+    "exponentially distributed intervals at the -qps rate, \"trace\" - open loop, the arrival timestamps are "
+    "replayed from the -arrival_trace file. In the open loop modes the time a request waits for an idle infer "
+    "request (queue delay) is reported separately from the inference time. Requires the async API.";
+
+/// @brief message for qps settings
+static const char qps_message[] =
+    "Optional. Comma separated target arrival rates (queries per second) of the open loop modes, e.g. "
+    "\"50,100,200\". Every rate is a separate load level running for -t seconds or -niter arrivals, the latency "
+    "percentiles and histograms are reported for every level. Required for the \"poisson\" arrivals, in the "
+    "\"trace\" mode the trace is scaled in time to the rates (the trace is replayed as is if not set).";
+
+/// @brief message for arrival_trace settings
+static const char arrival_trace_message[] =
+    "Optional. Path to a file with the arrival timestamps (ms, one per line) for the \"trace\" arrivals.";
+
 // @brief message for report_type option
 static const char report_type_message[] =
     "Optional. Enable collecting statistics report. \"no_counters\" report contains "
@@ -355,6 +374,15 @@ DEFINE_bool(use_device_mem, false, use_device_mem_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint64(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Defines how the infer requests arrive
+DEFINE_string(arrivals, "closed", arrivals_message);
+
+/// @brief Target arrival rates of the open loop modes
+DEFINE_string(qps, "", qps_message);
+
+/// @brief Path to a file with the arrival timestamps
+DEFINE_string(arrival_trace, "", arrival_trace_message);
+
 /// @brief Enables statistics report collecting
 DEFINE_string(report_type, "", report_type_message);
 
@@ -415,6 +443,11 @@ static void show_usage() {
     std::cout << "    -inference_only         " << inference_only_message << std::endl;
     std::cout << "    -infer_precision        " << inference_precision_message << std::endl;
     std::cout << std::endl;
+    std::cout << "Load generation options:" << std::endl;
+    std::cout << "    -arrivals  <closed/poisson/trace>  " << arrivals_message << std::endl;
+    std::cout << "    -qps  <value>           " << qps_message << std::endl;
+    std::cout << "    -arrival_trace  <path>  " << arrival_trace_message << std::endl;
+    std::cout << std::endl;
     std::cout << "Preprocessing options:" << std::endl;
     std::cout << "    -ip   <value>           " << inputs_precision_message << std::endl;
     std::cout << "    -op   <value>           " << outputs_precision_message << std::endl;
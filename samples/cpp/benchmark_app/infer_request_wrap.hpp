@@ -87,6 +87,15 @@ public:
         _lat_group_id = id;
     }
 
+    // time the request waited for this infer request in the open loop modes
+    void set_queue_delay(double queue_delay) {
+        _queueDelay = queue_delay;
+    }
+
+    double get_queue_delay() const {
+        return _queueDelay;
+    }
+
     // in case of using GPU memory we need to allocate CL buffer for
     // output blobs. By encapsulating cl buffer inside InferReqWrap
     // we will control the number of output buffers and access to it.
@@ -100,6 +109,7 @@ private:
     Time::time_point _endTime;
     size_t _id;
     size_t _lat_group_id;
+    double _queueDelay = 0;
     QueueCallbackFunction _callbackQueue;
     std::map<std::string, ::gpu::BufferType> outputClBuffer;
 };
@@ -137,6 +147,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queue_delays.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
@@ -155,6 +166,7 @@ public:
             inferenceException = ptr;
         } else {
             _latencies.push_back(latency);
+            _queue_delays.push_back(requests.at(id)->get_queue_delay());
             if (enable_lat_groups) {
                 _latency_groups[lat_group_id].push_back(latency);
             }
@@ -196,6 +208,11 @@ public:
         return _latency_groups;
     }
 
+    // queue delays of the requests in the same order as the latencies
+    std::vector<double> get_queue_delays() {
+        return _queue_delays;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -205,6 +222,7 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queue_delays;
     std::vector<std::vector<double>> _latency_groups;
     bool enable_lat_groups;
     std::exception_ptr inferenceException = nullptr;
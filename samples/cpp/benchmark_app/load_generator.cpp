@@ -0,0 +1,185 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "samples/common.hpp"
+#include "samples/slog.hpp"
+
+#include "load_generator.hpp"
+// clang-format on
+
+namespace {
+size_t most_significant_bit(uint64_t value) {
+    size_t msb = 0;
+    while (value >>= 1)
+        msb++;
+    return msb;
+}
+}  // namespace
+
+size_t LatencyHistogram::bucket_index(uint64_t value_us) {
+    if (value_us < sub_buckets)
+        return static_cast<size_t>(value_us);
+    const size_t msb = most_significant_bit(value_us);
+    return (msb - sub_bucket_bits + 1) * sub_buckets + ((value_us >> (msb - sub_bucket_bits)) & (sub_buckets - 1));
+}
+
+uint64_t LatencyHistogram::bucket_upper_bound(size_t index) {
+    if (index < sub_buckets)
+        return index;
+    const size_t shift = index / sub_buckets - 1;
+    const uint64_t sub = index % sub_buckets;
+    return ((sub_buckets + sub + 1) << shift) - 1;
+}
+
+void LatencyHistogram::add(double latency_ms) {
+    const auto value_us = static_cast<uint64_t>(std::max(0.0, latency_ms) * 1000.0);
+    const auto index = bucket_index(value_us);
+    if (index >= buckets.size())
+        buckets.resize(index + 1, 0);
+    buckets[index]++;
+    total++;
+    max_value = std::max(max_value, latency_ms);
+}
+
+double LatencyHistogram::percentile(double p) const {
+    if (total == 0)
+        return 0;
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(total))));
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < buckets.size(); i++) {
+        accumulated += buckets[i];
+        if (accumulated >= rank)
+            return std::min(static_cast<double>(bucket_upper_bound(i)) / 1000.0, max_value);
+    }
+    return max_value;
+}
+
+nlohmann::json LatencyHistogram::to_json() const {
+    nlohmann::json js;
+    js["count"] = total;
+    js["p50"] = percentile(50);
+    js["p90"] = percentile(90);
+    js["p99"] = percentile(99);
+    js["p99.9"] = percentile(99.9);
+    js["max"] = max_value;
+    js["histogram"] = nlohmann::json::array();
+    for (size_t i = 0; i < buckets.size(); i++) {
+        if (buckets[i] != 0)
+            js["histogram"].push_back({static_cast<double>(bucket_upper_bound(i)) / 1000.0, buckets[i]});
+    }
+    return js;
+}
+
+void LoadLevelMetrics::write_to_stream(std::ostream& stream) const {
+    std::ios::fmtflags fmt(stream.flags());
+    stream << std::fixed << std::setprecision(2) << target_qps << ";" << achieved_qps << ";" << requests;
+    for (const auto* histogram : {&queue_delay, &inference_time, &latency}) {
+        stream << ";" << histogram->percentile(50) << ";" << histogram->percentile(90) << ";"
+               << histogram->percentile(99) << ";" << histogram->percentile(99.9);
+    }
+    stream.flags(fmt);
+}
+
+void LoadLevelMetrics::write_to_slog() const {
+    slog::info << "   Target QPS:       " << double_to_string(target_qps) << slog::endl;
+    slog::info << "   Achieved QPS:     " << double_to_string(achieved_qps) << slog::endl;
+    slog::info << "   Requests:         " << requests << slog::endl;
+    auto print = [](const std::string& name, const LatencyHistogram& histogram) {
+        slog::info << name << "p50 " << double_to_string(histogram.percentile(50)) << " ms, p90 "
+                   << double_to_string(histogram.percentile(90)) << " ms, p99 "
+                   << double_to_string(histogram.percentile(99)) << " ms, p99.9 "
+                   << double_to_string(histogram.percentile(99.9)) << " ms" << slog::endl;
+    };
+    print("   Queue delay:      ", queue_delay);
+    print("   Inference time:   ", inference_time);
+    print("   Latency:          ", latency);
+}
+
+nlohmann::json LoadLevelMetrics::to_json() const {
+    nlohmann::json js;
+    js["target_qps"] = target_qps;
+    js["achieved_qps"] = achieved_qps;
+    js["requests"] = requests;
+    js["queue_delay"] = queue_delay.to_json();
+    js["inference_time"] = inference_time.to_json();
+    js["latency"] = latency.to_json();
+    return js;
+}
+
+std::vector<double> generate_poisson_arrivals(double qps, double duration_ms, uint64_t max_arrivals, uint32_t seed) {
+    if (qps <= 0)
+        throw std::logic_error("The arrival rate of the Poisson arrivals should be positive.");
+    if (duration_ms <= 0 && max_arrivals == 0)
+        throw std::logic_error("Either duration or number of arrivals should be set for the Poisson arrivals.");
+
+    std::mt19937 generator(seed);
+    // inter-arrival times of the Poisson process are exponentially distributed
+    std::exponential_distribution<double> interval_ms(qps / 1000.0);
+    std::vector<double> arrivals;
+    double time_ms = 0;
+    while (max_arrivals == 0 || arrivals.size() < max_arrivals) {
+        time_ms += interval_ms(generator);
+        if (duration_ms > 0 && time_ms > duration_ms)
+            break;
+        arrivals.push_back(time_ms);
+    }
+    return arrivals;
+}
+
+std::vector<double> read_arrival_trace(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open())
+        throw std::logic_error("Cannot open the arrival trace file " + path);
+
+    std::vector<double> trace;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#')
+            continue;
+        trace.push_back(std::stod(line));
+    }
+    if (trace.size() < 2)
+        throw std::logic_error("The arrival trace " + path + " should contain at least 2 timestamps.");
+
+    std::sort(trace.begin(), trace.end());
+    const auto first = trace.front();
+    for (auto& timestamp : trace)
+        timestamp -= first;
+    if (trace.back() <= 0)
+        throw std::logic_error("The arrival trace " + path + " should span a non-zero time interval.");
+    return trace;
+}
+
+std::vector<double> replay_arrival_trace(const std::vector<double>& trace,
+                                         double qps,
+                                         double duration_ms,
+                                         uint64_t max_arrivals) {
+    if (duration_ms <= 0 && max_arrivals == 0)
+        max_arrivals = trace.size();
+
+    // the mean interval is kept between the repetitions of the trace
+    const double trace_span_ms = trace.back() * trace.size() / (trace.size() - 1);
+    const double trace_qps = 1000.0 * trace.size() / trace_span_ms;
+    const double scale = qps > 0 ? trace_qps / qps : 1.0;
+
+    std::vector<double> arrivals;
+    for (size_t repetition = 0;; repetition++) {
+        for (const auto timestamp : trace) {
+            const double time_ms = (repetition * trace_span_ms + timestamp) * scale;
+            if ((duration_ms > 0 && time_ms > duration_ms) || (max_arrivals != 0 && arrivals.size() >= max_arrivals))
+                return arrivals;
+            arrivals.push_back(time_ms);
+        }
+    }
+}
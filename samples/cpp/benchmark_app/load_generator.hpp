@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef JSON_HEADER
+#    include <json.hpp>
+#else
+#    include <nlohmann/json.hpp>
+#endif
+
+// @brief arrival modes
+static constexpr char closedLoopArrivals[] = "closed";
+static constexpr char poissonArrivals[] = "poisson";
+static constexpr char traceArrivals[] = "trace";
+
+/// @brief HDR-style latency histogram: the log-linear buckets keep the relative precision below 1% in the whole
+/// range of values, so the high percentiles (p99, p99.9) are reported without storing the raw values
+class LatencyHistogram {
+public:
+    /// @brief records a value in milliseconds
+    void add(double latency_ms);
+
+    uint64_t count() const {
+        return total;
+    }
+
+    /// @brief returns the percentile in milliseconds, p is in the range [0, 100]
+    double percentile(double p) const;
+
+    double max() const {
+        return max_value;
+    }
+
+    /// @brief returns the percentiles and the non-empty buckets as [upper bound (ms), count] pairs
+    nlohmann::json to_json() const;
+
+private:
+    static constexpr size_t sub_bucket_bits = 7;
+    static constexpr size_t sub_buckets = 1 << sub_bucket_bits;
+
+    static size_t bucket_index(uint64_t value_us);
+    static uint64_t bucket_upper_bound(size_t index);
+
+    std::vector<uint64_t> buckets;
+    uint64_t total = 0;
+    double max_value = 0;
+};
+
+/// @brief Results of one load level of the open-loop mode
+struct LoadLevelMetrics {
+    double target_qps = 0;
+    double achieved_qps = 0;
+    uint64_t requests = 0;
+    /// @brief time from the request arrival till the start of its inference
+    LatencyHistogram queue_delay;
+    /// @brief time of the inference itself
+    LatencyHistogram inference_time;
+    /// @brief time from the request arrival till the end of its inference
+    LatencyHistogram latency;
+
+    void write_to_stream(std::ostream& stream) const;
+    void write_to_slog() const;
+    nlohmann::json to_json() const;
+};
+
+/**
+ * @brief Generates the arrival times (ms since the load level start) of the Poisson process
+ * @param qps the mean arrival rate
+ * @param duration_ms the arrivals are generated within the duration if it is not zero
+ * @param max_arrivals the max number of arrivals if it is not zero
+ */
+std::vector<double> generate_poisson_arrivals(double qps, double duration_ms, uint64_t max_arrivals, uint32_t seed);
+
+/**
+ * @brief Reads the arrival timestamps (ms, one per line) of the recorded traffic
+ */
+std::vector<double> read_arrival_trace(const std::string& path);
+
+/**
+ * @brief Replays the arrivals of the trace, the trace is repeated if it is shorter than the level
+ * @param qps the trace is scaled in time to the arrival rate if it is not zero
+ */
+std::vector<double> replay_arrival_trace(const std::vector<double>& trace,
+                                         double qps,
+                                         double duration_ms,
+                                         uint64_t max_arrivals);
@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -34,6 +35,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -63,6 +65,18 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (FLAGS_arrivals != closedLoopArrivals && FLAGS_arrivals != poissonArrivals && FLAGS_arrivals != traceArrivals) {
+        throw std::logic_error("Incorrect arrivals. Please set -arrivals option to `closed`, `poisson` or `trace` value.");
+    }
+    if (FLAGS_arrivals != closedLoopArrivals && FLAGS_api != "async") {
+        throw std::logic_error("The open loop arrivals can be used only with the async API.");
+    }
+    if (FLAGS_arrivals == poissonArrivals && FLAGS_qps.empty()) {
+        throw std::logic_error("The target arrival rates should be set by -qps option for the poisson arrivals.");
+    }
+    if (FLAGS_arrivals == traceArrivals && FLAGS_arrival_trace.empty()) {
+        throw std::logic_error("The arrival trace should be set by -arrival_trace option for the trace arrivals.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "cumulative_throughput" && FLAGS_hint != "ctput" && FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -924,6 +938,7 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("topology", "topology", topology_name),
                      StatisticsVariant("target device", "target_device", device_name),
                      StatisticsVariant("API", "api", FLAGS_api),
+                     StatisticsVariant("arrivals", "arrivals", FLAGS_arrivals),
                      StatisticsVariant("precision", "precision", type.get_type_name()),
                      StatisticsVariant("batch size", "batch_size", batchSize),
                      StatisticsVariant("number of iterations", "iterations_num", niter),
@@ -1023,6 +1038,9 @@ int main(int argc, char* argv[]) {
             }
             ss << niter << " iterations";
         }
+        if (FLAGS_arrivals != closedLoopArrivals) {
+            ss << " per load level, " << FLAGS_arrivals << " arrivals";
+        }
 
         next_step(ss.str());
 
@@ -1113,52 +1131,128 @@ int main(int argc, char* argv[]) {
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.get_idle_request();
-            if (!inferRequest) {
-                OPENVINO_THROW("No idle Infer Requests!");
+        auto prepare_request = [&](const InferReqWrap::Ptr& inferRequest) {
+            if (inferenceOnly) {
+                return;
             }
+            auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
 
-            if (!inferenceOnly) {
-                auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
+            if (FLAGS_pcseq) {
+                inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
+            }
+
+            if (isDynamicNetwork) {
+                batchSize = get_batch_size(inputs);
+            }
+
+            for (auto& item : inputs) {
+                auto inputName = item.first;
+                const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
+                inferRequest->set_tensor(inputName, data);
+            }
 
-                if (FLAGS_pcseq) {
-                    inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
+            if (useGpuMem) {
+                auto outputTensors =
+                    ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
+                for (auto& output : compiledModel.outputs()) {
+                    inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
                 }
+            }
+        };
 
-                if (isDynamicNetwork) {
-                    batchSize = get_batch_size(inputs);
+        std::vector<LoadLevelMetrics> loadLevels;
+        if (FLAGS_arrivals == closedLoopArrivals) {
+            /** Start inference & calculate performance **/
+            /** to align number if iterations to guarantee that last infer requests are
+             * executed in the same conditions **/
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0)) {
+                inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    OPENVINO_THROW("No idle Infer Requests!");
                 }
 
-                for (auto& item : inputs) {
-                    auto inputName = item.first;
-                    const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
-                    inferRequest->set_tensor(inputName, data);
+                prepare_request(inferRequest);
+
+                if (FLAGS_api == "sync") {
+                    inferRequest->infer();
+                } else {
+                    inferRequest->start_async();
                 }
+                ++iteration;
 
-                if (useGpuMem) {
-                    auto outputTensors =
-                        ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
-                    for (auto& output : compiledModel.outputs()) {
-                        inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
-                    }
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                processedFramesN += batchSize;
+            }
+        } else {
+            std::vector<double> qpsLevels;
+            for (const auto& qps : split(FLAGS_qps, ',')) {
+                qpsLevels.push_back(std::stod(qps));
+            }
+            std::vector<double> arrivalTrace;
+            if (FLAGS_arrivals == traceArrivals) {
+                arrivalTrace = read_arrival_trace(FLAGS_arrival_trace);
+                if (qpsLevels.empty()) {
+                    // the trace is replayed as is
+                    qpsLevels.push_back(0);
                 }
             }
 
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                inferRequest->start_async();
-            }
-            ++iteration;
+            const double levelDurationMs = static_cast<double>(duration_nanoseconds) * 0.000001;
+            for (size_t level = 0; level < qpsLevels.size(); level++) {
+                const auto arrivals =
+                    FLAGS_arrivals == poissonArrivals
+                        ? generate_poisson_arrivals(qpsLevels[level], levelDurationMs, niter, static_cast<uint32_t>(level))
+                        : replay_arrival_trace(arrivalTrace, qpsLevels[level], levelDurationMs, niter);
+                if (arrivals.empty()) {
+                    slog::warn << "No requests arrive at the load level " << qpsLevels[level] << " QPS" << slog::endl;
+                    continue;
+                }
+                const size_t firstResult = inferRequestsQueue.get_latencies().size();
+
+                // the arrival times do not depend on the completions, so the time a request waits for an idle
+                // infer request is accounted as the queue delay instead of delaying the next arrivals
+                const auto levelStartTime = Time::now();
+                for (const auto arrival : arrivals) {
+                    const auto arrivalTime =
+                        levelStartTime + std::chrono::duration_cast<Time::duration>(
+                                             std::chrono::duration<double, std::milli>(arrival));
+                    std::this_thread::sleep_until(arrivalTime);
+
+                    inferRequest = inferRequestsQueue.get_idle_request();
+                    if (!inferRequest) {
+                        OPENVINO_THROW("No idle Infer Requests!");
+                    }
 
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-            processedFramesN += batchSize;
+                    prepare_request(inferRequest);
+
+                    inferRequest->set_queue_delay(
+                        std::chrono::duration_cast<ns>(Time::now() - arrivalTime).count() * 0.000001);
+                    inferRequest->start_async();
+                    ++iteration;
+                    processedFramesN += batchSize;
+                }
+                inferRequestsQueue.wait_all();
+                const double levelTimeMs =
+                    std::chrono::duration_cast<ns>(Time::now() - levelStartTime).count() * 0.000001;
+
+                LoadLevelMetrics metrics;
+                metrics.target_qps =
+                    qpsLevels[level] > 0 ? qpsLevels[level] : 1000.0 * arrivals.size() / arrivals.back();
+                metrics.achieved_qps = 1000.0 * arrivals.size() / levelTimeMs;
+                metrics.requests = arrivals.size();
+                const auto latencies = inferRequestsQueue.get_latencies();
+                const auto queueDelays = inferRequestsQueue.get_queue_delays();
+                for (size_t i = firstResult; i < latencies.size(); i++) {
+                    metrics.queue_delay.add(queueDelays[i]);
+                    metrics.inference_time.add(latencies[i]);
+                    metrics.latency.add(queueDelays[i] + latencies[i]);
+                }
+                slog::info << "Load level " << (level + 1) << ":" << slog::endl;
+                metrics.write_to_slog();
+                loadLevels.push_back(metrics);
+            }
         }
 
         // wait the latest inference executions
@@ -1214,6 +1308,10 @@ int main(int argc, char* argv[]) {
             }
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
+            for (const auto& level : loadLevels) {
+                statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS_LOAD_LEVELS,
+                                           {StatisticsVariant("Load level", "load_levels", level)});
+            }
         }
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
@@ -26,7 +26,7 @@ void StatisticsReport::dump() {
 
     auto dump_parameters = [&dumper](const Parameters& parameters) {
         for (auto& parameter : parameters) {
-            if (parameter.type != StatisticsVariant::METRICS) {
+            if (parameter.type != StatisticsVariant::METRICS && parameter.type != StatisticsVariant::LOAD_LEVEL) {
                 dumper << parameter.csv_name;
             }
             dumper << parameter.to_string();
@@ -67,6 +67,19 @@ void StatisticsReport::dump() {
         dumper.endLine();
     }
 
+    if (_parameters.count(Category::EXECUTION_RESULTS_LOAD_LEVELS)) {
+        dumper << "Load Levels";
+        dumper.endLine();
+        dumper << "Target QPS;Achieved QPS;Requests;"
+                  "Queue delay p50;Queue delay p90;Queue delay p99;Queue delay p99.9;"
+                  "Inference time p50;Inference time p90;Inference time p99;Inference time p99.9;"
+                  "Latency p50;Latency p90;Latency p99;Latency p99.9";
+        dumper.endLine();
+
+        dump_parameters(_parameters.at(Category::EXECUTION_RESULTS_LOAD_LEVELS));
+        dumper.endLine();
+    }
+
     slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
 }
 
@@ -227,6 +240,9 @@ void StatisticsReportJSON::dump() {
     if (_parameters.count(Category::EXECUTION_RESULTS_GROUPPED)) {
         dump_parameters(js["execution_results"], _parameters.at(Category::EXECUTION_RESULTS_GROUPPED));
     }
+    if (_parameters.count(Category::EXECUTION_RESULTS_LOAD_LEVELS)) {
+        dump_parameters(js["execution_results"], _parameters.at(Category::EXECUTION_RESULTS_LOAD_LEVELS));
+    }
 
     std::ofstream out_stream(name);
     out_stream << std::setw(4) << js << std::endl;
@@ -353,11 +369,17 @@ std::string StatisticsVariant::to_string() const {
         return s_val;
     case ULONGLONG:
         return std::to_string(ull_val);
-    case METRICS:
+    case METRICS: {
         std::ostringstream str;
         metrics_val.write_to_stream(str);
         return str.str();
     }
+    case LOAD_LEVEL: {
+        std::ostringstream str;
+        load_level_val.write_to_stream(str);
+        return str.str();
+    }
+    }
     throw std::invalid_argument("StatisticsVariant::to_string : invalid type is provided");
 }
 
@@ -382,6 +404,13 @@ void StatisticsVariant::write_to_json(nlohmann::json& js) const {
         }
         arr.push_back(to_json(metrics_val));
     } break;
+    case LOAD_LEVEL: {
+        auto& arr = js[json_name];
+        if (arr.empty()) {
+            arr = nlohmann::json::array();
+        }
+        arr.push_back(load_level_val.to_json());
+    } break;
     default:
         throw std::invalid_argument("StatisticsVariant:: json conversion : invalid type is provided");
     }
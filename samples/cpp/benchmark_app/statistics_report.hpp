@@ -21,6 +21,7 @@
 #include "samples/slog.hpp"
 #include "samples/latency_metrics.hpp"
 
+#include "load_generator.hpp"
 #include "utils.hpp"
 // clang-format on
 
@@ -32,7 +33,7 @@ static constexpr char sortDetailedCntReport[] = "sort_detailed_counters";
 
 class StatisticsVariant {
 public:
-    enum Type { INT, DOUBLE, STRING, ULONGLONG, METRICS };
+    enum Type { INT, DOUBLE, STRING, ULONGLONG, METRICS, LOAD_LEVEL };
 
     StatisticsVariant(std::string csv_name, std::string json_name, int v)
         : csv_name(csv_name),
@@ -69,6 +70,11 @@ public:
           json_name(json_name),
           metrics_val(v),
           type(METRICS) {}
+    StatisticsVariant(std::string csv_name, std::string json_name, const LoadLevelMetrics& v)
+        : csv_name(csv_name),
+          json_name(json_name),
+          load_level_val(v),
+          type(LOAD_LEVEL) {}
 
     ~StatisticsVariant() {}
 
@@ -79,6 +85,7 @@ public:
     unsigned long long ull_val = 0;
     std::string s_val;
     LatencyMetrics metrics_val;
+    LoadLevelMetrics load_level_val;
     Type type;
 
     std::string to_string() const;
@@ -96,7 +103,13 @@ public:
         std::string report_folder;
     };
 
-    enum class Category { COMMAND_LINE_PARAMETERS, RUNTIME_CONFIG, EXECUTION_RESULTS, EXECUTION_RESULTS_GROUPPED };
+    enum class Category {
+        COMMAND_LINE_PARAMETERS,
+        RUNTIME_CONFIG,
+        EXECUTION_RESULTS,
+        EXECUTION_RESULTS_GROUPPED,
+        EXECUTION_RESULTS_LOAD_LEVELS
+    };
 
     virtual ~StatisticsReport() = default;
 
@@ -18,6 +18,9 @@ public:
     bool m_save_expressions = false;
     // True if we should check runtime info for nodes to call specific needed transformations
     bool m_need_fill_tail_register = false;
+    // True if the work amounts of the Loops are passed to the kernel in runtime, so one kernel serves all the shapes
+    // with the same broadcasting pattern. Only the Loops over the innermost dimension are supported
+    bool m_runtime_work_amounts = false;
     size_t m_loop_depth = 1;
 };
 
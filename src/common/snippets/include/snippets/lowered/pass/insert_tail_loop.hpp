@@ -17,6 +17,8 @@ namespace pass {
  * @interface InsertTailLoop
  * @brief Injects tail-processing loop after a vector loop if required.
  *  Additional optimizations are performed if a loop body is executed only once.
+ *  If the work amounts are runtime arguments (see Config::m_runtime_work_amounts), the vector loop is always followed by
+ *  the scalar tail loop processing the runtime remainder, and no single evaluation optimizations are applied.
  * @ingroup snippets
  */
 class InsertTailLoop : public Pass {
@@ -38,6 +40,8 @@ private:
                                      LinearIR::constExprIt tail_end,
                                      size_t tail_size);
     static bool optimize_single_evaluation(const std::shared_ptr<op::LoopEnd>& loop);
+    // returns the iterator to the LoopEnd of the inserted tail loop
+    static LinearIR::constExprIt insert_runtime_tail_loop(LinearIR& linear_ir, LinearIR::constExprIt loop_end_it);
 };
 
 } // namespace pass
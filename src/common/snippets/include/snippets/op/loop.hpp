@@ -63,6 +63,8 @@ private:
  * apply_increments, which enables more flexibility.
  * @param finalization_offsets pointer increments that are be applied to i/o pointers before exiting the loop
  * @param id the identifier of Loop in Loop system in LoopManager
+ * If the work amount is a runtime argument of the kernel (see set_runtime_work_amount), the Loop body may be skipped
+ * entirely and the finalization offsets are defined per unit of the runtime work amount.
  * @ingroup snippets
  */
 class LoopEnd : public LoopBase {
@@ -91,6 +93,16 @@ public:
     void set_work_amount(size_t new_work_amount);
     void set_increment(size_t new_increment);
     void set_evaluate_once(bool once);
+    /**
+     * @brief Makes the work amount a runtime argument of the kernel, so the Loop doesn't depend on the shape.
+     * @param idx index of the runtime work amount argument
+     * @param divisor if not zero, the Loop processes the remainder of the runtime work amount division by divisor
+     *        (the tail Loop after the vector one). Must be a power of two.
+     */
+    void set_runtime_work_amount(size_t idx, size_t divisor = 0);
+    bool has_runtime_work_amount() const;
+    size_t get_runtime_work_amount_idx() const;
+    size_t get_runtime_work_amount_divisor() const;
     // Used to propagate information about Loop structure, needed to simplify some optimizations. For example,
     // to skip pointer increments when outer Loop is empty, and work_amount == vector_size (one inner vector Loop)
     // true by default, the optimizations enabled if it's false;
@@ -111,6 +123,8 @@ private:
     size_t m_output_num = 0;
     size_t m_id = 0;  // the corresponding Loop identificator in LoopManager
     bool m_evaluate_once = false; // true if the Loop is executed only once, used to skip setting and testing the loop counter
+    int64_t m_runtime_work_amount_idx = -1; // -1 if the work amount is known at compile time
+    size_t m_runtime_work_amount_divisor = 0;
 };
 
 } // namespace op
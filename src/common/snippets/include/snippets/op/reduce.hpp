@@ -0,0 +1,74 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface ReduceBase
+ * @brief Base class for the reductions which are decomposed on linear IR into the accumulation Loop and Horizon op,
+ *        the same way as Softmax. The output keeps the reduced dimension equal to 1.
+ *        Where:
+ *          - axis - the reduced dimension. Only the last dimension is supported by decomposition at the moment
+ * @ingroup snippets
+ */
+class ReduceBase : public ov::op::Op {
+public:
+    OPENVINO_OP("ReduceBase", "SnippetsOpset");
+
+    ReduceBase(const Output<Node>& x, size_t axis);
+    ReduceBase() = default;
+
+    size_t get_axis() const { return m_axis; }
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+    void validate_and_infer_types() override;
+
+    /**
+     * @brief Sets the subtensors of the port descriptors: the reduced dimension and the inner ones are processed at once
+     */
+    static void compute_and_set_reduce_subtensors(const std::shared_ptr<ReduceBase>& reduce);
+
+protected:
+    size_t m_axis = 0;
+};
+
+/**
+ * @interface ReduceSum
+ * @brief The sum of the elements along the axis
+ * @ingroup snippets
+ */
+class ReduceSum : public ReduceBase {
+public:
+    OPENVINO_OP("ReduceSum", "SnippetsOpset", ReduceBase);
+
+    ReduceSum(const Output<Node>& x, size_t axis) : ReduceBase(x, axis) {}
+    ReduceSum() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+};
+
+/**
+ * @interface ReduceMax
+ * @brief The maximum of the elements along the axis
+ * @ingroup snippets
+ */
+class ReduceMax : public ReduceBase {
+public:
+    OPENVINO_OP("ReduceMax", "SnippetsOpset", ReduceBase);
+
+    ReduceMax(const Output<Node>& x, size_t axis) : ReduceBase(x, axis) {}
+    ReduceMax() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ov
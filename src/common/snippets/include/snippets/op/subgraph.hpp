@@ -124,6 +124,8 @@ public:
     // it's going to be replaced with Jitters table later
     void set_generator(std::shared_ptr<ov::snippets::Generator> generator);
     void set_tile_rank(size_t newRank) {tileRank = newRank;}
+    // plugin enables it to generate the kernel which reads the Loops work amounts from the runtime arguments
+    void set_runtime_work_amounts(bool enable) {runtimeWorkAmounts = enable;}
     void set_virtual_port_count(const size_t count);
 
     void print() const;
@@ -162,6 +164,7 @@ private:
 
     ov::PartialShape master_shape;
     size_t tileRank = 0; // set by plugin to specify the number of dimensions processed in a single kernel call
+    bool runtimeWorkAmounts = false; // set by plugin to make the kernel independent of the innermost dimension
     size_t maxInputRank = 0;
     std::vector<size_t> appendOnesForCanonical;
 
@@ -0,0 +1,29 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+
+namespace ov {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface ReduceToSnippetsReduce
+ * @brief Converts ReduceSum, ReduceMax and ReduceMean with constant axes to snippets ReduceSum and ReduceMax
+ *        and updates port descriptors in accordance with the reduction axis.
+ *        ReduceMean is converted to ReduceSum multiplied by the reciprocal of the reduced dimension.
+ * @ingroup snippets
+ */
+class ReduceToSnippetsReduce: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ReduceToSnippetsReduce", "0");
+    ReduceToSnippetsReduce();
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ov
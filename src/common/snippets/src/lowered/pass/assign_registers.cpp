@@ -62,7 +62,7 @@ bool AssignRegisters::run(LinearIR& linear_ir) {
             manually_assigned_gprs[expr->get_output_port_connector(0)] =
                     static_cast<Reg>(num_results + num_parameters + buffer_id);
         } else if (ov::is_type<op::HorizonMax>(op) || ov::is_type<op::HorizonSum>(op)) {
-            // Only in SoftmaxDecomposition ReduceMax and ReduceSum use HorizonMax/HorizonSum and VectorBuffer.
+            // Only in SoftmaxDecomposition and ReduceDecomposition ReduceMax and ReduceSum use HorizonMax/HorizonSum and VectorBuffer.
             // We should manually set the one vector register for VectorBuffer and Max/Sum output to simulate a accumulator
             // TODO [96351]: We should rewrite accumulator pattern using another way
             const auto& input_tensor = expr->get_input_port_connector(0);
@@ -91,7 +91,8 @@ bool AssignRegisters::run(LinearIR& linear_ir) {
             //       All operations `outside loop` after Horizon ops should have the same register to avoid using it in the next Loop
             const auto current_loops_ids = expr->get_loop_ids();
             auto next_expr = output_tensor->get_consumers().begin()->get_expr();
-            while (next_expr->get_loop_ids() == current_loops_ids) {
+            // Note: the result of Reduce may be stored right after Horizon op, Result doesn't have outputs
+            while (next_expr->get_loop_ids() == current_loops_ids && !ov::is_type<ov::op::v0::Result>(next_expr->get_node())) {
                 manually_assigned_vecs[next_expr->get_output_port_connector(0)] =
                         static_cast<Reg>(accumulator_reg);
                 next_expr = next_expr->get_output_port_connector(0)->get_consumers().begin()->get_expr();
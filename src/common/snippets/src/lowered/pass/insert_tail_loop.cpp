@@ -161,9 +161,39 @@ bool InsertTailLoop::optimize_single_evaluation(const std::shared_ptr<op::LoopEn
     return true;
 }
 
+LinearIR::constExprIt InsertTailLoop::insert_runtime_tail_loop(LinearIR& linear_ir, LinearIR::constExprIt loop_end_it) {
+    const auto loop_end = ov::as_type_ptr<op::LoopEnd>((*loop_end_it)->get_node());
+    const auto loop_info = linear_ir.get_loop_manager()->get_loop_info(loop_end->get_id());
+    // The pointer increments of the outer Loops depend on the inner dimensions, so they can't be runtime arguments yet
+    OPENVINO_ASSERT(loop_info->dim_idx == 0 && !loop_info->outer_splited_loop,
+                    "Only the Loops over the innermost dimension support the runtime work amount");
+    const auto work_amount = static_cast<int64_t>(loop_end->get_work_amount());
+    const auto increment = loop_end->get_increment();
+    OPENVINO_ASSERT(work_amount > 0, "Loop with the runtime work amount must be compiled for non-empty dimension");
+
+    // The finalization offsets are proportional to the work amount, so the tail loop applies them per unit
+    // of the runtime work amount after the vector loop
+    auto unit_finalization_offsets = loop_end->get_finalization_offsets();
+    for (auto& offset : unit_finalization_offsets) {
+        OPENVINO_ASSERT(offset % work_amount == 0, "Finalization offsets must be proportional to the work amount");
+        offset /= work_amount;
+    }
+    loop_end->set_finalization_offsets(std::vector<int64_t>(unit_finalization_offsets.size(), 0));
+    loop_end->set_runtime_work_amount(loop_info->dim_idx);
+
+    const auto loop_begin = loop_end->get_loop_begin();
+    const auto begin_it = linear_ir.find(linear_ir.get_expr_by_node(loop_begin));
+    LinearIR::constExprIt tail_begin, tail_end;
+    const auto tail_loop_end = create_tail_loop(linear_ir, begin_it, std::next(loop_end_it), tail_begin, tail_end,
+                                                loop_end, true, 1, unit_finalization_offsets);
+    tail_loop_end->set_runtime_work_amount(loop_info->dim_idx, increment);
+    return std::prev(tail_end);
+}
+
 bool InsertTailLoop::run(LinearIR& linear_ir) {
     OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::insertTailLoop")
     const auto& loop_manager = linear_ir.get_loop_manager();
+    const auto runtime_work_amounts = linear_ir.get_config().m_runtime_work_amounts;
     bool modified = false;
 
     for (auto expr_it = linear_ir.cbegin(); expr_it != linear_ir.cend(); ++expr_it) {
@@ -173,6 +203,12 @@ bool InsertTailLoop::run(LinearIR& linear_ir) {
         if (!loop_end)
             continue;
 
+        if (runtime_work_amounts) {
+            expr_it = insert_runtime_tail_loop(linear_ir, expr_it);
+            modified = true;
+            continue;
+        }
+
         const auto work_amount = loop_end->get_work_amount();
         const auto increment = loop_end->get_increment();
         const auto loop_info = loop_manager->get_loop_info(loop_end->get_id());
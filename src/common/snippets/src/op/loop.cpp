@@ -91,6 +91,8 @@ std::shared_ptr<Node> LoopEnd::clone_with_new_inputs(const OutputVector& inputs)
     const auto loop_end = std::make_shared<LoopEnd>(inputs.at(0), m_work_amount, m_work_amount_increment, m_ptr_increments,
                                                     m_finalization_offsets, m_element_type_sizes, m_input_num, m_output_num, m_id);
     loop_end->m_evaluate_once = m_evaluate_once;
+    loop_end->m_runtime_work_amount_idx = m_runtime_work_amount_idx;
+    loop_end->m_runtime_work_amount_divisor = m_runtime_work_amount_divisor;
     return loop_end;
 }
 
@@ -168,6 +170,25 @@ void LoopEnd::set_evaluate_once(bool once) {
     m_evaluate_once = once;
 }
 
+void LoopEnd::set_runtime_work_amount(size_t idx, size_t divisor) {
+    OPENVINO_ASSERT((divisor & (divisor - 1)) == 0, "LoopEnd runtime work amount divisor must be a power of two");
+    m_runtime_work_amount_idx = static_cast<int64_t>(idx);
+    m_runtime_work_amount_divisor = divisor;
+}
+
+bool LoopEnd::has_runtime_work_amount() const {
+    return m_runtime_work_amount_idx >= 0;
+}
+
+size_t LoopEnd::get_runtime_work_amount_idx() const {
+    OPENVINO_ASSERT(has_runtime_work_amount(), "LoopEnd work amount is not a runtime argument");
+    return static_cast<size_t>(m_runtime_work_amount_idx);
+}
+
+size_t LoopEnd::get_runtime_work_amount_divisor() const {
+    return m_runtime_work_amount_divisor;
+}
+
 void LoopEnd::validate_and_infer_types() {
     NODE_VALIDATION_CHECK(this, get_input_size() == 1, "LoopEnd must have one input");
     const auto loop_begin = ov::as_type_ptr<LoopBegin>(get_input_node_shared_ptr(0));
@@ -194,6 +215,7 @@ bool LoopEnd::visit_attributes(AttributeVisitor &visitor) {
     visitor.on_attribute("input_num", m_input_num);
     visitor.on_attribute("output_num", m_output_num);
     visitor.on_attribute("id", m_id);
+    visitor.on_attribute("runtime_work_amount_idx", m_runtime_work_amount_idx);
     return true;
 }
 
@@ -0,0 +1,57 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/itt.hpp"
+
+#include "snippets/op/reduce.hpp"
+#include "snippets/lowered/port_descriptor.hpp"
+
+
+namespace ov {
+namespace snippets {
+namespace op {
+
+ReduceBase::ReduceBase(const Output<Node>& x, size_t axis) : Op({x}), m_axis(axis) {
+    constructor_validate_and_infer_types();
+}
+
+bool ReduceBase::visit_attributes(AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(ReduceBase_visit_attributes);
+    visitor.on_attribute("axis", m_axis);
+    return true;
+}
+
+void ReduceBase::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(ReduceBase_validate_and_infer_types);
+    auto new_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, new_shape.rank().is_static() && m_axis < new_shape.size(),
+                          "Reduce axis ", m_axis, " is out of the input rank");
+    new_shape[m_axis] = 1;
+    set_output_type(0, get_input_element_type(0), new_shape);
+}
+
+void ReduceBase::compute_and_set_reduce_subtensors(const std::shared_ptr<ReduceBase>& reduce) {
+    const auto rank = reduce->get_input_partial_shape(0).size();
+    std::vector<size_t> subtensor(rank, 1);
+    for (size_t i = reduce->get_axis(); i < rank; ++i)
+        subtensor[i] = lowered::PortDescriptor::ServiceDimensions::FULL_DIM;
+    lowered::PortDescriptorUtils::set_port_descriptor_ptr(reduce->input(0), std::make_shared<lowered::PortDescriptor>(reduce->input(0), subtensor));
+    lowered::PortDescriptorUtils::set_port_descriptor_ptr(reduce->output(0), std::make_shared<lowered::PortDescriptor>(reduce->output(0), subtensor));
+}
+
+std::shared_ptr<Node> ReduceSum::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(ReduceSum_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ReduceSum>(new_args.at(0), m_axis);
+}
+
+std::shared_ptr<Node> ReduceMax::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(ReduceMax_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ReduceMax>(new_args.at(0), m_axis);
+}
+
+} // namespace op
+} // namespace snippets
+} // namespace ov
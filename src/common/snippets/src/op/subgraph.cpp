@@ -7,6 +7,7 @@
 
 #include "snippets/op/subgraph.hpp"
 #include "snippets/op/convert_saturation.hpp"
+#include "snippets/op/reduce.hpp"
 
 #include "snippets/pass/insert_movebroadcast.hpp"
 #include "snippets/pass/broadcast_to_movebroadcast.hpp"
@@ -17,6 +18,7 @@
 #include "snippets/pass/matmul_to_brgemm.hpp"
 #include "snippets/pass/fuse_transpose_brgemm.hpp"
 #include "snippets/pass/set_softmax_ports.hpp"
+#include "snippets/pass/reduce_to_snippets_reduce.hpp"
 
 #include "snippets/utils.hpp"
 
@@ -34,6 +36,7 @@
 #include "snippets/lowered/pass/propagate_layout.hpp"
 #include "snippets/lowered/pass/cleanup_loop_offsets.hpp"
 #include "snippets/lowered/pass/softmax_decomposition.hpp"
+#include "snippets/lowered/pass/reduce_decomposition.hpp"
 #include "snippets/lowered/pass/move_scalar_to_consumer.hpp"
 #include "snippets/lowered/pass/move_result_out_of_loop.hpp"
 #include "snippets/lowered/pass/clean_repeated_ptr_shifts.hpp"
@@ -70,6 +73,10 @@ auto snippets::op::Subgraph::is_domain_sensitive_op(const std::shared_ptr<ov::No
     return ov::is_type<ov::op::v1::Transpose>(op) ||
            ov::is_type<ov::op::v1::Softmax>(op) ||
            ov::is_type<ov::op::v8::Softmax>(op) ||
+           ov::is_type<ov::op::v1::ReduceSum>(op) ||
+           ov::is_type<ov::op::v1::ReduceMean>(op) ||
+           ov::is_type<ov::op::v1::ReduceMax>(op) ||
+           ov::is_type<op::ReduceBase>(op) ||
            ov::is_type<ov::op::v0::MatMul>(op) ||
            ov::is_type<ov::op::v1::Broadcast>(op) || // Broadcast is domain sensetive op because the output shape depends on
            ov::is_type<ov::op::v3::Broadcast>(op);   // the both input and broadcast shapes (the both - are inputs of op). Note: is used only in MHA pattern
@@ -92,7 +99,7 @@ auto snippets::op::Subgraph::get_estimated_buffer_count(const ov::NodeVector& op
     // 2. Around MatMul: all buffers around Matmul must not be inplace because MatMul blocking implementation changes registers during computations.
     // The count is estimated because when we calculate this number, we have only original graph representation
     // and where will be Loops - we can just predict.
-    // Note: The ops that create Buffers: MatMul, Transpose and Softmax (always FP32)
+    // Note: The ops that create Buffers: MatMul, Transpose, Softmax and Reduce (always FP32)
     std::vector<size_t> used_precision_size;
 
     auto push_prc_size = [&used_precision_size](size_t precision_size) {
@@ -120,6 +127,10 @@ auto snippets::op::Subgraph::get_estimated_buffer_count(const ov::NodeVector& op
             // Softmax always uses 2 FP32 Buffers after decomposition.
             // They are inplace and the same so we can push precision size only once
             push_prc_size(ov::element::f32.size());
+        } else if (ov::is_type<ov::op::util::ArithmeticReductionKeepDims>(op) || ov::is_type<op::ReduceBase>(op)) {
+            // Reduce input is usually needed by the next Loops after the reduction (e.g. Subtract of the mean),
+            // so FP32 Buffer is possible after decomposition
+            push_prc_size(ov::element::f32.size());
         } else if (const auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(op)) {
             // Since all buffers around Matmul must be unique, we explicitely add values to the vector without any checks
             if (!ov::is_type<ov::op::v0::Parameter>(matmul->get_input_node_shared_ptr(0)))
@@ -295,7 +306,8 @@ auto snippets::op::Subgraph::constant_input_should_be_inside_body(const std::sha
     return ov::is_type<ov::op::v1::Transpose>(node) ||
            ov::is_type<ov::op::v1::Broadcast>(node) ||
            ov::is_type<ov::op::v3::Broadcast>(node) ||
-           ov::is_type<ov::op::v1::Reshape>(node);
+           ov::is_type<ov::op::v1::Reshape>(node) ||
+           ov::is_type<ov::op::util::ArithmeticReductionKeepDims>(node);
 }
 
 ///
@@ -554,6 +566,7 @@ void snippets::op::Subgraph::data_flow_transformations(ov::pass::Manager& pre_co
         common_manager.register_pass<snippets::pass::FuseTransposeBrgemm>();
         common_manager.register_pass<snippets::pass::TransposeDecomposition>();
         common_manager.register_pass<snippets::pass::SetSoftmaxPorts>();
+        common_manager.register_pass<snippets::pass::ReduceToSnippetsReduce>();
     }
     common_manager.register_pass<snippets::pass::BroadcastToMoveBroadcast>();
     common_manager.register_pass<snippets::pass::ConvertConstantsToScalars>();
@@ -595,6 +608,7 @@ void snippets::op::Subgraph::control_flow_transformations(lowered::LinearIR& lin
     lowered::pass::PassPipeline common_pipeline;
     common_pipeline.register_pass<lowered::pass::MarkLoops>(vector_size);
     common_pipeline.register_pass<lowered::pass::SoftmaxDecomposition>(vector_size);
+    common_pipeline.register_pass<lowered::pass::ReduceDecomposition>(vector_size);
     common_pipeline.register_pass<lowered::pass::FuseLoops>();
     common_pipeline.register_pass<lowered::pass::SplitLoops>();
     common_pipeline.register_pass<lowered::pass::MoveResultOutOfLoop>();
@@ -666,6 +680,7 @@ snippets::Schedule snippets::op::Subgraph::generate(
     lowering_config.m_save_expressions = config.m_has_domain_sensitive_ops;
     lowering_config.m_need_fill_tail_register = config.m_has_domain_sensitive_ops;
     lowering_config.m_loop_depth = tileRank;
+    lowering_config.m_runtime_work_amounts = runtimeWorkAmounts;
 
     lowered::LinearIR linear_ir = lowered::LinearIR(body_ptr(), lowering_config);
     control_flow_transformations(linear_ir, target_lowered_markup_pipeline, target_lowered_pipeline);
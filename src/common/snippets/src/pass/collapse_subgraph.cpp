@@ -164,6 +164,20 @@ auto is_supported_op(const std::shared_ptr<const Node> &n) -> bool {
         return axis >= 0 && axis == (rank.get_length() - 1);
     };
 
+    auto is_supported_reduce_op = [](const std::shared_ptr<const Node> &n) -> bool {
+        // Reduce is supported only by the last dimension with kept dimensions since it's decomposed like Softmax
+        if (!ov::is_type<const ov::op::v1::ReduceSum>(n) &&
+            !ov::is_type<const ov::op::v1::ReduceMean>(n) &&
+            !ov::is_type<const ov::op::v1::ReduceMax>(n))
+            return false;
+        const auto reduce = ov::as_type_ptr<const ov::op::util::ArithmeticReductionKeepDims>(n);
+        const auto& pshape = n->get_input_partial_shape(0);
+        if (!reduce->get_keep_dims() || pshape.is_dynamic() || !reduce->reduction_axes_constant())
+            return false;
+        const auto axes = reduce->get_reduction_axes();
+        return axes.size() == 1 && *axes.begin() == pshape.size() - 1;
+    };
+
     auto is_supported_broadcast_op = [](const std::shared_ptr<const Node> &n) -> bool {
         // Broadcast is supported only for MHA tokenization where there are needed and special checks
         if (auto broadcast_v1 = ov::as_type_ptr<const ov::op::v1::Broadcast>(n)) {
@@ -180,6 +194,7 @@ auto is_supported_op(const std::shared_ptr<const Node> &n) -> bool {
            is_supported_ternary_eltwise_op(n) ||
            is_supported_transpose(n) ||
            is_supported_softmax(n) ||
+           is_supported_reduce_op(n) ||
            is_supported_matmul(n) ||
            is_supported_broadcast_op(n);
 }
@@ -193,6 +208,10 @@ auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
                         (ov::is_type<const opset1::Transpose>(n) ||
                          ov::is_type<const opset1::Broadcast>(n)));
     };
+    // Reduction axes are integer Constant which is kept inside body and isn't processed by the kernel
+    auto is_reduce_axes = [&n](const Input<const Node>& in) -> bool {
+        return ov::is_type<const ov::op::util::ArithmeticReductionKeepDims>(n) && in.get_index() == 1;
+    };
     const auto&  inputs = n->inputs();
     const auto&  outputs = n->outputs();
     // todo: Is this check necessary? Remove if not
@@ -203,7 +222,7 @@ auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
             }
         }
     }
-    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
+    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return  is_reduce_axes(in) || supported(in.get_tensor());}) &&
            std::all_of(outputs.begin(), outputs.end(), [&](const Output<const Node>& out) {return  supported(out.get_tensor());});
 }
 
@@ -0,0 +1,58 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/pass/reduce_to_snippets_reduce.hpp"
+
+#include "snippets/itt.hpp"
+#include "snippets/op/reduce.hpp"
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reduce_max.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+
+ov::snippets::pass::ReduceToSnippetsReduce::ReduceToSnippetsReduce() {
+    MATCHER_SCOPE(ReduceToSnippetsReduce);
+
+    auto m_reduce = ov::pass::pattern::wrap_type<ov::op::v1::ReduceSum, ov::op::v1::ReduceMax, ov::op::v1::ReduceMean>(
+        {ov::pass::pattern::any_input(), ov::pass::pattern::wrap_type<ov::op::v0::Constant>()});
+
+    auto callback = [](ov::pass::pattern::Matcher &m) {
+        OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::op::ReduceToSnippetsReduce")
+        const auto root = m.get_match_root();
+        const auto reduce = ov::as_type_ptr<ov::op::util::ArithmeticReductionKeepDims>(root);
+        if (!reduce || root->get_input_partial_shape(0).is_dynamic())
+            return false;
+
+        const auto axes = reduce->get_reduction_axes();
+        OPENVINO_ASSERT(axes.size() == 1 && reduce->get_keep_dims(), "Snippets support only Reduce by one axis with kept dimensions");
+        const auto axis = *axes.begin();
+
+        std::shared_ptr<snippets::op::ReduceBase> snippets_reduce;
+        if (ov::is_type<ov::op::v1::ReduceMax>(root)) {
+            snippets_reduce = std::make_shared<snippets::op::ReduceMax>(root->input_value(0), axis);
+        } else {
+            snippets_reduce = std::make_shared<snippets::op::ReduceSum>(root->input_value(0), axis);
+        }
+        snippets::op::ReduceBase::compute_and_set_reduce_subtensors(snippets_reduce);
+
+        std::shared_ptr<ov::Node> result = snippets_reduce;
+        if (ov::is_type<ov::op::v1::ReduceMean>(root)) {
+            // Divide is expensive operation, so the mean is computed as the sum multiplied by 1 / N
+            const auto size = root->get_input_shape(0)[axis];
+            const auto scale = ov::op::v0::Constant::create(root->get_output_element_type(0), ov::Shape{}, {1.f / static_cast<float>(size)});
+            result = std::make_shared<ov::op::v1::Multiply>(snippets_reduce, scale);
+        }
+        result->set_friendly_name(root->get_friendly_name());
+        ov::copy_runtime_info(root, {snippets_reduce, result});
+        ov::replace_node(root, result);
+        return true;
+    };
+
+    register_matcher(std::make_shared<ov::pass::pattern::Matcher>(m_reduce, matcher_name), callback);
+}
@@ -159,4 +159,47 @@ TEST(Snippets_TailProcessingTransformation, BlockedTail_CleanUpPtrShifts) {
     reference[7] = { std::vector<int64_t>(3, 0), std::vector<int64_t>(3, 0)};  // Tail Blocked
 
     validate(linear_ir, reference);
-}
\ No newline at end of file
+}
+
+TEST(Snippets_TailProcessingTransformation, RuntimeWorkAmounts) {
+    ov::Shape inputShape0 = {1, 2, 16, 20};
+    ov::Shape inputShape1 = {1, 2, 16, 20};
+    Config config;
+    config.m_runtime_work_amounts = true;
+    LinearIR linear_ir(ov::test::snippets::AddFunction({inputShape0, inputShape1}).getOriginal(), config);
+    auto expr_it = std::find_if(linear_ir.cbegin(), linear_ir.cend(),
+                                [](const ExpressionPtr& expr) { return ov::is_type<ov::op::v1::Add>(expr->get_node()); });
+    ASSERT_TRUE(expr_it != linear_ir.cend());
+    const auto add = *expr_it;
+    const auto loop_entry_points = std::vector<ExpressionPort>{add->get_input_port(0), add->get_input_port(1)};
+    const auto loop_exit_points = std::vector<ExpressionPort>{add->get_output_port(0)};
+    linear_ir.get_loop_manager()->mark_loop(expr_it, std::next(expr_it), 20, vector_size, 0, loop_entry_points, loop_exit_points);
+
+    pass::PassPipeline pass_pipeline;
+    init_pipeline(pass_pipeline);
+    pass_pipeline.register_pass<pass::InsertTailLoop>();
+    pass_pipeline.run(linear_ir);
+
+    // [Inserted Loop number, [ptr_increments, final_offsets]
+    std::map<size_t, std::pair<std::vector<int64_t>, std::vector<int64_t>>> reference;
+    reference[0] = { std::vector<int64_t>(3, 1), std::vector<int64_t>(3, 0)};  // Vector Inner
+    reference[1] = { std::vector<int64_t>(3, 1), std::vector<int64_t>(3, -1)};  // Tail Inner: per unit of work amount
+
+    validate(linear_ir, reference);
+
+    std::vector<std::shared_ptr<ov::snippets::op::LoopEnd>> loop_ends;
+    for (const auto& expr : linear_ir) {
+        if (const auto loop_end = ov::as_type_ptr<ov::snippets::op::LoopEnd>(expr->get_node()))
+            loop_ends.push_back(loop_end);
+    }
+    ASSERT_EQ(loop_ends.size(), 2u);
+    for (const auto& loop_end : loop_ends) {
+        ASSERT_TRUE(loop_end->has_runtime_work_amount());
+        ASSERT_EQ(loop_end->get_runtime_work_amount_idx(), 0u);
+        ASSERT_FALSE(loop_end->get_evaluate_once());
+    }
+    ASSERT_EQ(loop_ends[0]->get_increment(), vector_size);
+    ASSERT_EQ(loop_ends[0]->get_runtime_work_amount_divisor(), 0u);
+    ASSERT_EQ(loop_ends[1]->get_increment(), 1u);
+    ASSERT_EQ(loop_ends[1]->get_runtime_work_amount_divisor(), vector_size);
+}
@@ -0,0 +1,128 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "lowering_utils.hpp"
+
+#include "snippets/lowered/linear_ir.hpp"
+#include "snippets/lowered/loop_manager.hpp"
+#include "snippets/lowered/pass/mark_loops.hpp"
+#include "snippets/lowered/pass/reduce_decomposition.hpp"
+#include "snippets/lowered/pass/fuse_loops.hpp"
+#include "snippets/lowered/pass/move_result_out_of_loop.hpp"
+#include "snippets/lowered/pass/insert_buffers.hpp"
+#include "snippets/lowered/pass/insert_load_store.hpp"
+#include "snippets/lowered/pass/validate_loops.hpp"
+#include "snippets/lowered/pass/init_loops.hpp"
+#include "snippets/lowered/pass/insert_loops.hpp"
+#include "snippets/lowered/pass/assign_registers.hpp"
+
+#include "snippets/snippets_isa.hpp"
+
+
+using namespace ov::snippets::lowered;
+
+namespace {
+
+constexpr static size_t vector_size = 16;
+
+template <typename Reduce>
+std::shared_ptr<ov::Model> make_reduce_model(const ov::Shape& shape) {
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto reduce = std::make_shared<Reduce>(data, shape.size() - 1);
+    ov::snippets::op::ReduceBase::compute_and_set_reduce_subtensors(reduce);
+    auto result = std::make_shared<ov::op::v0::Result>(reduce);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{data});
+}
+
+void run_pipeline(LinearIR& linear_ir) {
+    auto generator = std::make_shared<ov::test::snippets::DummyGenerator>();
+    auto reg_type_mapper = [&generator](const std::shared_ptr<ov::Node>& op) {
+        return generator->get_op_reg_type(op);
+    };
+    pass::PassPipeline pipeline;
+    pipeline.register_pass<pass::MarkLoops>(vector_size);
+    pipeline.register_pass<pass::ReduceDecomposition>(vector_size);
+    pipeline.register_pass<pass::FuseLoops>();
+    pipeline.register_pass<pass::MoveResultOutOfLoop>();
+    pipeline.register_pass<pass::InsertBuffers>(2);
+    pipeline.register_pass<pass::InsertLoadStore>(vector_size);
+    pipeline.register_pass<pass::ValidateLoops>();
+    pipeline.register_pass<pass::InitLoops>();
+    pipeline.register_pass<pass::InsertLoops>();
+    pipeline.register_pass<pass::AssignRegisters>(reg_type_mapper);
+    pipeline.run(linear_ir);
+}
+
+template <typename T>
+std::vector<ExpressionPtr> find_exprs(const LinearIR& linear_ir) {
+    std::vector<ExpressionPtr> exprs;
+    for (const auto& expr : linear_ir) {
+        if (ov::is_type<T>(expr->get_node()))
+            exprs.push_back(expr);
+    }
+    return exprs;
+}
+
+template <typename Reduce, typename Accumulation, typename Horizon>
+void check_decomposition(const ov::Shape& shape, size_t loop_depth, uint32_t fill_value) {
+    Config config;
+    config.m_loop_depth = loop_depth;
+    LinearIR linear_ir(make_reduce_model<Reduce>(shape), config);
+    run_pipeline(linear_ir);
+
+    ASSERT_TRUE(find_exprs<ov::snippets::op::ReduceBase>(linear_ir).empty());
+    // the accumulator lives in the register, the whole row is processed in one loop, so no memory Buffer is needed
+    ASSERT_TRUE(find_exprs<ov::snippets::op::Buffer>(linear_ir).empty());
+
+    const auto vector_buffers = find_exprs<ov::snippets::op::VectorBuffer>(linear_ir);
+    const auto fills = find_exprs<ov::snippets::op::Fill>(linear_ir);
+    const auto accumulations = find_exprs<Accumulation>(linear_ir);
+    const auto horizons = find_exprs<Horizon>(linear_ir);
+    ASSERT_EQ(vector_buffers.size(), 1u);
+    ASSERT_EQ(fills.size(), 1u);
+    ASSERT_EQ(accumulations.size(), 1u);
+    ASSERT_EQ(horizons.size(), 1u);
+
+    const auto fill = ov::as_type_ptr<ov::snippets::op::Fill>(fills.front()->get_node());
+    ASSERT_EQ(fill->get_fill_value(), fill_value);
+    // the tail of the accumulation loop is filled by the initial value
+    ASSERT_GT(accumulations.front()->get_node()->input(0).get_rt_info().count("set_fill"), 0u);
+
+    // the accumulation loop iterates over the reduced dimension, Horizon op is out of it
+    const auto& loop_manager = linear_ir.get_loop_manager();
+    const auto accumulation_loop_ids = accumulations.front()->get_loop_ids();
+    const auto horizon_loop_ids = horizons.front()->get_loop_ids();
+    ASSERT_EQ(accumulation_loop_ids.size(), horizon_loop_ids.size() + 1);
+    const auto accumulation_loop_id = std::find_if(accumulation_loop_ids.cbegin(), accumulation_loop_ids.cend(), [&](size_t id) {
+        return std::find(horizon_loop_ids.cbegin(), horizon_loop_ids.cend(), id) == horizon_loop_ids.cend();
+    });
+    ASSERT_TRUE(accumulation_loop_id != accumulation_loop_ids.cend());
+    const auto accumulation_loop = loop_manager->get_loop_info(*accumulation_loop_id);
+    ASSERT_EQ(accumulation_loop->work_amount, shape.back());
+    ASSERT_EQ(accumulation_loop->increment, vector_size);
+
+    // VectorBuffer, Fill, the accumulation and Horizon op share the accumulator register
+    const auto accumulator = vector_buffers.front()->get_reg_info().second.front();
+    ASSERT_EQ(fills.front()->get_reg_info().second.front(), accumulator);
+    ASSERT_EQ(accumulations.front()->get_reg_info().second.front(), accumulator);
+    ASSERT_EQ(horizons.front()->get_reg_info().second.front(), accumulator);
+}
+
+}  // namespace
+
+TEST(Snippets_ReduceDecomposition, ReduceSum) {
+    check_decomposition<ov::snippets::op::ReduceSum, ov::op::v1::Add, ov::snippets::op::HorizonSum>({2, 3, 37}, 2, 0x00000000);
+}
+
+TEST(Snippets_ReduceDecomposition, ReduceMax) {
+    check_decomposition<ov::snippets::op::ReduceMax, ov::op::v1::Maximum, ov::snippets::op::HorizonMax>({2, 3, 37}, 2, 0xff7fffff);
+}
+
+TEST(Snippets_ReduceDecomposition, ReduceWithoutOuterLoops) {
+    // Horizon op and the Store of its result are not in any loop, so the accumulator register assignment
+    // must stop at Result instead of following its outputs
+    check_decomposition<ov::snippets::op::ReduceSum, ov::op::v1::Add, ov::snippets::op::HorizonSum>({1, 37}, 1, 0x00000000);
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include <snippets/snippets_isa.hpp>
+#include <snippets/pass/reduce_to_snippets_reduce.hpp>
+
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov;
+
+TEST_F(TransformationTestsF, ReduceSumToSnippetsReduce) {
+    {
+        auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, Shape{2, 3, 240});
+        auto axes = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{-1});
+        auto reduce = std::make_shared<ov::op::v1::ReduceSum>(data, axes, true);
+        model = std::make_shared<Model>(NodeVector{reduce}, ParameterVector{data});
+
+        manager.register_pass<snippets::pass::ReduceToSnippetsReduce>();
+    }
+    {
+        auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, Shape{2, 3, 240});
+        auto reduce = std::make_shared<snippets::op::ReduceSum>(data, 2);
+        model_ref = std::make_shared<Model>(NodeVector{reduce}, ParameterVector{data});
+    }
+}
+
+TEST_F(TransformationTestsF, ReduceMaxToSnippetsReduce) {
+    {
+        auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, Shape{2, 3, 240});
+        auto axes = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{2});
+        auto reduce = std::make_shared<ov::op::v1::ReduceMax>(data, axes, true);
+        model = std::make_shared<Model>(NodeVector{reduce}, ParameterVector{data});
+
+        manager.register_pass<snippets::pass::ReduceToSnippetsReduce>();
+    }
+    {
+        auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, Shape{2, 3, 240});
+        auto reduce = std::make_shared<snippets::op::ReduceMax>(data, 2);
+        model_ref = std::make_shared<Model>(NodeVector{reduce}, ParameterVector{data});
+    }
+}
+
+TEST_F(TransformationTestsF, ReduceMeanToSnippetsReduce) {
+    {
+        auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, Shape{2, 3, 240});
+        auto axes = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{-1});
+        auto reduce = std::make_shared<ov::op::v1::ReduceMean>(data, axes, true);
+        model = std::make_shared<Model>(NodeVector{reduce}, ParameterVector{data});
+
+        manager.register_pass<snippets::pass::ReduceToSnippetsReduce>();
+    }
+    {
+        auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, Shape{2, 3, 240});
+        auto reduce = std::make_shared<snippets::op::ReduceSum>(data, 2);
+        auto scale = std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{}, std::vector<float>{1.f / 240});
+        auto mean = std::make_shared<ov::op::v1::Multiply>(reduce, scale);
+        model_ref = std::make_shared<Model>(NodeVector{mean}, ParameterVector{data});
+    }
+}
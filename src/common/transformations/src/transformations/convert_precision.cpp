@@ -872,63 +872,63 @@ inline int32_t convert_value<uint32_t, int32_t>(uint32_t val) {
 }
 
 namespace {
+// the smaller constants are converted right away, they are mostly the shapes and the axes which are read
+// by the shape inference anyway
+constexpr size_t lazy_conversion_min_byte_size = 1 << 16;
+
 template <ov::element::Type_t PREC_FROM, ov::element::Type_t PREC_TO>
-std::shared_ptr<ov::Node> change_constant_precision(std::shared_ptr<opset4::Constant>& constant) {
+void convert_constant_data(const opset4::Constant& constant, void* data) {
     using src_type = typename element_type_traits<PREC_FROM>::value_type;
     using dst_type = typename element_type_traits<PREC_TO>::value_type;
 
-    const auto* src_data = constant->get_data_ptr<src_type>();
-    const auto size = shape_size(constant->get_shape());
-
-    auto new_constant = std::make_shared<opset4::Constant>(PREC_TO, constant->get_shape());
-    new_constant->output(0).set_names(constant->output(0).get_names());
-    auto* dst_data = const_cast<dst_type*>(reinterpret_cast<const dst_type*>(new_constant->get_data_ptr()));
-    if (dst_data == nullptr)
-        OPENVINO_THROW("Can't get destination data pointer");
-
+    const auto* src_data = constant.get_data_ptr<src_type>();
+    const auto size = shape_size(constant.get_shape());
+    auto* dst_data = static_cast<dst_type*>(data);
     for (size_t i = 0; i < size; ++i) {
         dst_data[i] = convert_value<src_type, dst_type>(src_data[i]);
     }
-    return new_constant;
 }
 
 template <>
-std::shared_ptr<Node> change_constant_precision<ov::element::Type_t::f32, ov::element::Type_t::f16>(
-    std::shared_ptr<opset4::Constant>& constant) {
+void convert_constant_data<ov::element::Type_t::f32, ov::element::Type_t::f16>(const opset4::Constant& constant,
+                                                                                void* data) {
     using src_type = typename element_type_traits<ov::element::Type_t::f32>::value_type;
     using dst_type = typename element_type_traits<ov::element::Type_t::f16>::value_type;
 
-    const auto* src_data = constant->get_data_ptr<src_type>();
-    const auto size = shape_size(constant->get_shape());
-
-    auto new_constant = std::make_shared<opset4::Constant>(ov::element::Type_t::f16, constant->get_shape());
-    new_constant->output(0).set_names(constant->output(0).get_names());
-    auto* dst_data = const_cast<dst_type*>(reinterpret_cast<const dst_type*>(new_constant->get_data_ptr()));
-    if (dst_data == nullptr)
-        OPENVINO_THROW("Can't get destination data pointer");
-
-    ngraph::runtime::reference::convert_from_f32_to_f16_with_clamp(src_data, dst_data, size);
-
-    return new_constant;
+    ngraph::runtime::reference::convert_from_f32_to_f16_with_clamp(constant.get_data_ptr<src_type>(),
+                                                                   static_cast<dst_type*>(data),
+                                                                   shape_size(constant.get_shape()));
 }
 
 template <>
-std::shared_ptr<Node> change_constant_precision<ov::element::Type_t::f16, ov::element::Type_t::f32>(
-    std::shared_ptr<opset4::Constant>& constant) {
+void convert_constant_data<ov::element::Type_t::f16, ov::element::Type_t::f32>(const opset4::Constant& constant,
+                                                                                void* data) {
     using src_type = typename element_type_traits<ov::element::Type_t::f16>::value_type;
     using dst_type = typename element_type_traits<ov::element::Type_t::f32>::value_type;
 
-    const auto* src_data = constant->get_data_ptr<src_type>();
-    const auto size = shape_size(constant->get_shape());
+    ngraph::runtime::reference::convert<src_type, dst_type>(constant.get_data_ptr<src_type>(),
+                                                             static_cast<dst_type*>(data),
+                                                             shape_size(constant.get_shape()));
+}
 
-    auto new_constant = std::make_shared<opset4::Constant>(ov::element::Type_t::f32, constant->get_shape());
+template <ov::element::Type_t PREC_FROM, ov::element::Type_t PREC_TO>
+std::shared_ptr<ov::Node> change_constant_precision(std::shared_ptr<opset4::Constant>& constant) {
+    std::shared_ptr<opset4::Constant> new_constant;
+    if (constant->get_byte_size() >= lazy_conversion_min_byte_size) {
+        // the data is converted once it is read, so the weights mapped from the file are not touched by the
+        // transformation and are not copied if the plugin reads the source constant itself
+        new_constant = std::make_shared<opset4::Constant>(PREC_TO,
+                                                          constant->get_shape(),
+                                                          constant,
+                                                          convert_constant_data<PREC_FROM, PREC_TO>);
+    } else {
+        new_constant = std::make_shared<opset4::Constant>(PREC_TO, constant->get_shape());
+        auto* dst_data = const_cast<void*>(new_constant->get_data_ptr());
+        if (dst_data == nullptr)
+            OPENVINO_THROW("Can't get destination data pointer");
+        convert_constant_data<PREC_FROM, PREC_TO>(*constant, dst_data);
+    }
     new_constant->output(0).set_names(constant->output(0).get_names());
-    auto* dst_data = const_cast<dst_type*>(reinterpret_cast<const dst_type*>(new_constant->get_data_ptr()));
-    if (dst_data == nullptr)
-        OPENVINO_THROW("Can't get destination data pointer");
-
-    ngraph::runtime::reference::convert<src_type, dst_type>(src_data, dst_data, size);
-
     return new_constant;
 }
 
@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+namespace op {
+namespace v0 {
+class Constant;
+}  // namespace v0
+}  // namespace op
+
+namespace util {
+
+/// \brief Computes a 64-bit hash of the data content (XXH64 algorithm).
+/// \param data  Pointer to the data.
+/// \param size  Size of the data in bytes.
+/// \param seed  Initial hash value.
+/// \return The hash value.
+OPENVINO_API uint64_t hash_xxh64(const void* data, size_t size, uint64_t seed = 0);
+
+/// \brief Computes a 64-bit hash of the data content suitable for big buffers like constants.
+/// The data is split into the fixed size blocks which are hashed in parallel, then the block hashes are hashed
+/// together, so the result does not depend on the number of threads. Buffers smaller than one block are hashed with
+/// hash_xxh64 directly.
+/// \param data  Pointer to the data.
+/// \param size  Size of the data in bytes.
+/// \param seed  Initial hash value, the hashes with the different seeds may be combined into a stronger one.
+/// \return The hash value.
+OPENVINO_API uint64_t hash_data(const void* data, size_t size, uint64_t seed = 0);
+
+/// \brief Computes hash_data of the constant data. The value is cached in the runtime info of the constant, so the
+/// repeated calls for the constant and for its clones sharing the data do not read the data again.
+/// \param constant  The constant.
+/// \return The hash value.
+OPENVINO_API uint64_t hash_constant_data(const ov::op::v0::Constant& constant);
+
+}  // namespace util
+}  // namespace ov
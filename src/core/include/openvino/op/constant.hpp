@@ -6,6 +6,7 @@
 
 #include <cmath>
 #include <cstring>
+#include <functional>
 
 #ifndef IN_OV_COMPONENT
 #    define IN_OV_COMPONENT
@@ -182,6 +183,24 @@ public:
     }
     OPENVINO_SUPPRESS_DEPRECATED_END
 
+    /// \brief Function which writes the data of the lazy constant from the data of its source
+    using LazyTransform = std::function<void(const Constant& source, void* data)>;
+
+    /// \brief Constructs a constant whose data is the data of the source constant converted to the element type
+    ///        of this constant on the first access to the data. Until then the constant holds only the source and
+    ///        the transform, so e.g. the weights mapped from the file are not read and not copied by the
+    ///        transformations which only change the precision of the constant.
+    ///
+    /// \param type The element type of the tensor constant.
+    /// \param shape The shape of the tensor constant, it must be the shape of the source.
+    /// \param source The constant which provides the data for the transform.
+    /// \param transform The function which writes the converted data of the source, it may be called from any
+    ///                  thread which accesses the data, but only once.
+    Constant(const element::Type& type,
+             const Shape& shape,
+             const std::shared_ptr<const Constant>& source,
+             LazyTransform transform);
+
     Constant(const Constant& other);
     Constant(const Constant& other, const Shape& new_shape);
     Constant& operator=(const Constant&) = delete;
@@ -366,6 +385,9 @@ public:
 
     const void* get_data_ptr() const {
         OPENVINO_SUPPRESS_DEPRECATED_START
+        // only the buffer of the lazy constant has the size but no data until the first access
+        if (m_data && !m_data->get_ptr() && m_data->size() != 0)
+            return get_lazy_data_ptr();
         return (m_data ? m_data->get_ptr() : nullptr);
         OPENVINO_SUPPRESS_DEPRECATED_END
     }
@@ -390,6 +412,15 @@ public:
     }
     std::string convert_value_to_string(size_t index) const;
 
+    /// \brief Returns true if the data of the constant is produced from the source constant by the transform
+    ///        which has not been run yet.
+    bool is_lazy() const;
+
+    /// \brief Returns the source constant of the lazy constant, or nullptr if the data is already produced.
+    ///        Plugins may convert the source to their own memory directly without producing the data of this
+    ///        constant.
+    std::shared_ptr<const Constant> get_lazy_source() const;
+
     /**
      * \brief Allows to avoid buffer allocation on the visit_attributes call
      */
@@ -607,10 +638,11 @@ private:
 
     void allocate_buffer(bool memset_allocation);
 
+    // runs the transform of the lazy constant once and returns the produced data
+    const void* get_lazy_data_ptr() const;
+
     void* get_data_ptr_nc() {
-        OPENVINO_SUPPRESS_DEPRECATED_START
-        return (m_data ? m_data->get_ptr() : nullptr);
-        OPENVINO_SUPPRESS_DEPRECATED_END
+        return const_cast<void*>(get_data_ptr());
     }
 
     template <element::Type_t ET>
@@ -14,11 +14,18 @@ namespace pass {
  * @brief Constant folding iterates over the function and tries to evaluate nodes
  *        with constant inputs. Such nodes are then replaced with new Constants containing
  *        the result of a folded operation.
+ *
+ *        By default the independent nodes with constant inputs are evaluated in parallel in waves,
+ *        and the big elementwise nodes (e.g. Convert of the weights) are split into parallel chunks.
  * @ingroup ov_pass_cpp_api
  */
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_RTTI("ConstantFolding");
+    ConstantFolding() = default;
+    /// \param parallel  false to fold the nodes one by one in the topological order
+    explicit ConstantFolding(bool parallel) : m_parallel(parallel) {}
+
     bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
 
 protected:
@@ -26,6 +33,10 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Replaces the outputs of the folded node, returns true if the graph is changed.
+    bool replace_folded_outputs(const std::shared_ptr<Node>& node, const OutputVector& replacements);
+
+    bool m_parallel = true;
 };
 
 /**
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <numeric>
 #include <utility>
@@ -11,6 +12,7 @@
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
 #include "ngraph/shape_util.hpp"
+#include "openvino/reference/utils/parallel.hpp"
 
 namespace ov {
 namespace reference {
@@ -44,25 +46,48 @@ inline void numpy_autobroadcast_binop(const T* arg0,
                                       const size_t axis,
                                       const size_t stride,
                                       Functor elementwise_functor) {
-    using ngraph::CoordinateIterator;
-    for (CoordinateIterator it(output_shape), ite = CoordinateIterator::end();;) {
-        for (size_t i = 0; i < stride; ++i)
-            *out++ = elementwise_functor(arg0[i * A0], arg1[i * A1]);
+    // every step computes `stride` contiguous output elements, the steps iterate over the output coordinates of the
+    // axes [0, axis], so the ranges of the steps are computed in parallel
+    const size_t steps = shape_size(output_shape.begin(), output_shape.begin() + axis + 1);
+    const size_t min_steps = std::max<size_t>(parallel_min_work / std::max<size_t>(stride, 1), 1);
+    parallel_ranges(steps, min_steps, [&](size_t begin, size_t end) {
+        Coordinate coordinate(axis + 1);
+        size_t offset0 = 0, offset1 = 0;
+        for (size_t i = axis + 1, index = begin; i > 0; i--) {
+            coordinate[i - 1] = index % output_shape[i - 1];
+            index /= output_shape[i - 1];
+            if (value_with_padding_or(shape0, padding0, i - 1, 1) != 1)
+                offset0 += coordinate[i - 1] * strides0[i - 1];
+            if (value_with_padding_or(shape1, padding1, i - 1, 1) != 1)
+                offset1 += coordinate[i - 1] * strides1[i - 1];
+        }
+
+        const T* in0 = arg0 + offset0;
+        const T* in1 = arg1 + offset1;
+        U* dst = out + begin * stride;
+        for (size_t step = begin;;) {
+            for (size_t i = 0; i < stride; ++i)
+                *dst++ = elementwise_functor(in0[i * A0], in1[i * A1]);
 
-        arg0 += A0 ? stride : 1;
-        arg1 += A1 ? stride : 1;
+            if (++step == end)
+                break;
 
-        auto p = it.advance(axis);
+            in0 += A0 ? stride : 1;
+            in1 += A1 ? stride : 1;
 
-        if (it == ite)
-            break;
+            auto p = axis;
+            while (++coordinate[p] == output_shape[p]) {
+                coordinate[p] = 0;
+                --p;
+            }
 
-        if (value_with_padding_or(shape0, padding0, p, 1) == 1)
-            arg0 -= strides0[p];
+            if (value_with_padding_or(shape0, padding0, p, 1) == 1)
+                in0 -= strides0[p];
 
-        if (value_with_padding_or(shape1, padding1, p, 1) == 1)
-            arg1 -= strides1[p];
-    }
+            if (value_with_padding_or(shape1, padding1, p, 1) == 1)
+                in1 -= strides1[p];
+        }
+    });
 }
 
 inline size_t calculate_fixed_axis(size_t axis, const size_t* strides) {
@@ -99,9 +124,11 @@ void autobroadcast_binop(const T* arg0,
                          Functor elementwise_functor) {
     switch (broadcast_spec.m_type) {
     case op::AutoBroadcastType::NONE:
-        for (size_t i = 0; i < shape_size(arg0_shape); i++) {
-            out[i] = static_cast<U>(elementwise_functor(arg0[i], arg1[i]));
-        }
+        parallel_ranges(shape_size(arg0_shape), parallel_min_work, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                out[i] = static_cast<U>(elementwise_functor(arg0[i], arg1[i]));
+            }
+        });
         break;
     case op::AutoBroadcastType::NUMPY:
         // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -157,8 +184,10 @@ void autobroadcast_binop(const T* arg0,
             }
 
             if (axis == 0) {
-                for (size_t i = 0, end = strides0[0]; i < end; ++i)
-                    out[i] = elementwise_functor(arg0[i], arg1[i]);
+                parallel_ranges(strides0[0], parallel_min_work, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i)
+                        out[i] = elementwise_functor(arg0[i], arg1[i]);
+                });
             } else if (strides0[axis] == 1 && value_with_padding_or(arg0_shape, padding0, axis, 1) == 1) {
                 axis = calculate_fixed_axis(axis, strides0);
 
@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <numeric>
 
 #include "ngraph/shape.hpp"
+#include "openvino/reference/utils/parallel.hpp"
 #include "utils/span.hpp"
 
 namespace ngraph {
@@ -32,16 +34,20 @@ void gather(const T* const data,
     int64_t batch_indices_mul = shape_size(span(indices_shape).subspan(batch_dims));
 
     int64_t axis_size = data_shape[axis];
-    int64_t data_offset, out_offset, idx;
     // for out of bound indices is filled with zeros
     std::fill(out, out + shape_size(out_shape), T{0});
 
-    for (int64_t batch = 0; batch < batch_size; batch++)
-        for (int64_t outer_idx = 0; outer_idx < outer_size; outer_idx++) {
-            data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
-            out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
+    // the outer slices are written to the disjoint parts of the output, so they are gathered in parallel
+    const size_t slice_work = std::max<size_t>(static_cast<size_t>(indices_size * inner_size), 1);
+    const size_t min_items = std::max<size_t>(parallel_min_work / slice_work, 1);
+    parallel_ranges(static_cast<size_t>(batch_size * outer_size), min_items, [&](size_t begin, size_t end) {
+        for (size_t slice = begin; slice < end; slice++) {
+            const int64_t batch = static_cast<int64_t>(slice) / outer_size;
+            const int64_t outer_idx = static_cast<int64_t>(slice) % outer_size;
+            const int64_t data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
+            const int64_t out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
             for (int64_t i = 0; i < indices_size; i++) {
-                idx = indices[i + batch_indices_mul * batch];
+                int64_t idx = indices[i + batch_indices_mul * batch];
                 if (idx < 0)
                     idx += axis_size;
                 // for out of bound values have to be filled with zeros
@@ -54,6 +60,7 @@ void gather(const T* const data,
                 std::copy(src_begin, src_end, out_ptr);
             }
         }
+    });
 }
 
 }  // namespace reference
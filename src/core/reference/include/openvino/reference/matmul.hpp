@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 #include <utility>
@@ -12,6 +13,7 @@
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/shape_util.hpp"
 #include "openvino/reference/broadcast.hpp"
+#include "openvino/reference/utils/parallel.hpp"
 
 namespace ngraph {
 namespace runtime {
@@ -35,16 +37,20 @@ void dot(const T* arg0,
     const size_t J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
     const size_t K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
 
-    for (size_t i = 0; i < I_dim; ++i) {
-        for (size_t k = 0; k < K_dim; ++k) {
-            const size_t a_idx = i * K_dim + k;
-            for (size_t j = 0; j < J_dim; ++j) {
-                const size_t b_idx = k * J_dim + j;
-                const size_t out_idx = i * J_dim + j;
-                out[out_idx] += arg0[a_idx] * arg1[b_idx];
+    // the rows of the output are independent, so they are computed in parallel
+    const size_t row_work = std::max<size_t>(K_dim * J_dim, 1);
+    parallel_ranges(I_dim, std::max<size_t>(parallel_min_work / row_work, 1), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            for (size_t k = 0; k < K_dim; ++k) {
+                const size_t a_idx = i * K_dim + k;
+                for (size_t j = 0; j < J_dim; ++j) {
+                    const size_t b_idx = k * J_dim + j;
+                    const size_t out_idx = i * J_dim + j;
+                    out[out_idx] += arg0[a_idx] * arg1[b_idx];
+                }
             }
         }
-    }
+    });
 }
 
 std::vector<size_t> get_transpose_order(const Shape& input_shape);
@@ -208,14 +214,19 @@ void matmul(const T* arg0,
     const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
     const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
     const size_t output_offset = shape_size(dot_output_shape);
-    for (size_t i = 0; i < output_batch_size; i++) {
-        details::dot(arg0_data + i * arg0_offset,
-                     arg1_data + i * arg1_offset,
-                     out + i * output_offset,
-                     dot_arg0_shape,
-                     dot_arg1_shape,
-                     dot_output_shape);
-    }
+    const size_t batch_work = std::max<size_t>(shape_size(dot_arg0_shape) * dot_arg1_shape.back(), 1);
+    parallel_ranges(output_batch_size,
+                    std::max<size_t>(parallel_min_work / batch_work, 1),
+                    [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; i++) {
+                            details::dot(arg0_data + i * arg0_offset,
+                                         arg1_data + i * arg1_offset,
+                                         out + i * output_offset,
+                                         dot_arg0_shape,
+                                         dot_arg1_shape,
+                                         dot_output_shape);
+                        }
+                    });
 }
 }  // namespace reference
 }  // namespace runtime
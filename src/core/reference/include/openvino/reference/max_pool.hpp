@@ -4,10 +4,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel.hpp"
 
 namespace ngraph {
 namespace runtime {
@@ -22,92 +24,99 @@ void max_pool(const T* arg,
               const Shape& padding_below,
               const Shape& padding_above) {
     NGRAPH_SUPPRESS_DEPRECATED_START
-    // At the outermost level we will walk over every output coordinate O.
-    CoordinateTransform output_transform(out_shape);
-
-    for (const Coordinate& out_coord : output_transform) {
-        // Our output coordinate O will have the form:
-        //
-        //   (N,chan,i_1,...,i_n)
-
-        size_t batch_index = out_coord[0];
-        size_t channel = out_coord[1];
-
-        // For the input data we need to iterate the coordinate:
-        //
-        //   I:
-        //
-        // over the range (noninclusive on the right):
-        //
-        //   (N,chan,s_1*i_1,s_2*i_2,...,s_n*i_n) ->
-        //
-        //     (N+1,chan+1,s_1*i_1 + window_shape_1,...,s_n*i_n + window_shape_n)
-        //
-        // with unit stride.
-        //
-        // We iterate this over the *padded* data, so below we will need to check for
-        // coordinates that fall in the padding area.
-
-        size_t n_spatial_dimensions = arg_shape.size() - 2;
-
-        Coordinate input_batch_transform_start(2 + n_spatial_dimensions);
-        Coordinate input_batch_transform_end(2 + n_spatial_dimensions);
-        Strides input_batch_transform_source_strides(2 + n_spatial_dimensions, 1);
-        AxisVector input_batch_transform_source_axis_order(2 + n_spatial_dimensions);
-        CoordinateDiff input_batch_transform_padding_below(2 + n_spatial_dimensions);
-        CoordinateDiff input_batch_transform_padding_above(2 + n_spatial_dimensions);
-
-        input_batch_transform_start[0] = batch_index;
-        input_batch_transform_end[0] = batch_index + 1;
-        input_batch_transform_start[1] = channel;
-        input_batch_transform_end[1] = channel + 1;
-        input_batch_transform_padding_below[0] = 0;
-        input_batch_transform_padding_below[1] = 0;
-        input_batch_transform_padding_above[0] = 0;
-        input_batch_transform_padding_above[1] = 0;
-
-        for (size_t i = 2; i < n_spatial_dimensions + 2; i++) {
-            size_t window_shape_this_dim = window_shape[i - 2];
-            size_t movement_stride = window_movement_strides[i - 2];
-
-            input_batch_transform_start[i] = movement_stride * out_coord[i];
-            input_batch_transform_end[i] = input_batch_transform_start[i] + window_shape_this_dim;
-            // If a window (kernel) is out of arg shape bounds, trim it to fit
-            auto padded_upper_bound = arg_shape[i] + padding_below[i - 2] + padding_above[i - 2];
-            if (input_batch_transform_end[i] > padded_upper_bound) {
-                input_batch_transform_end[i] = padded_upper_bound;
+    // At the outermost level we will walk over every output coordinate O. Every output element is computed by one
+    // thread, so the output elements are split between the threads.
+    const size_t min_items = std::max<size_t>(parallel_min_work / std::max<size_t>(shape_size(window_shape), 1), 1);
+    parallel_ranges(shape_size(out_shape), min_items, [&](size_t begin, size_t end) {
+        Coordinate out_coord(out_shape.size());
+        for (size_t out_index = begin; out_index < end; out_index++) {
+            for (size_t i = out_shape.size(), index = out_index; i > 0; i--) {
+                out_coord[i - 1] = index % out_shape[i - 1];
+                index /= out_shape[i - 1];
+            }
+            // Our output coordinate O will have the form:
+            //
+            //   (N,chan,i_1,...,i_n)
+
+            size_t batch_index = out_coord[0];
+            size_t channel = out_coord[1];
+
+            // For the input data we need to iterate the coordinate:
+            //
+            //   I:
+            //
+            // over the range (noninclusive on the right):
+            //
+            //   (N,chan,s_1*i_1,s_2*i_2,...,s_n*i_n) ->
+            //
+            //     (N+1,chan+1,s_1*i_1 + window_shape_1,...,s_n*i_n + window_shape_n)
+            //
+            // with unit stride.
+            //
+            // We iterate this over the *padded* data, so below we will need to check for
+            // coordinates that fall in the padding area.
+
+            size_t n_spatial_dimensions = arg_shape.size() - 2;
+
+            Coordinate input_batch_transform_start(2 + n_spatial_dimensions);
+            Coordinate input_batch_transform_end(2 + n_spatial_dimensions);
+            Strides input_batch_transform_source_strides(2 + n_spatial_dimensions, 1);
+            AxisVector input_batch_transform_source_axis_order(2 + n_spatial_dimensions);
+            CoordinateDiff input_batch_transform_padding_below(2 + n_spatial_dimensions);
+            CoordinateDiff input_batch_transform_padding_above(2 + n_spatial_dimensions);
+
+            input_batch_transform_start[0] = batch_index;
+            input_batch_transform_end[0] = batch_index + 1;
+            input_batch_transform_start[1] = channel;
+            input_batch_transform_end[1] = channel + 1;
+            input_batch_transform_padding_below[0] = 0;
+            input_batch_transform_padding_below[1] = 0;
+            input_batch_transform_padding_above[0] = 0;
+            input_batch_transform_padding_above[1] = 0;
+
+            for (size_t i = 2; i < n_spatial_dimensions + 2; i++) {
+                size_t window_shape_this_dim = window_shape[i - 2];
+                size_t movement_stride = window_movement_strides[i - 2];
+
+                input_batch_transform_start[i] = movement_stride * out_coord[i];
+                input_batch_transform_end[i] = input_batch_transform_start[i] + window_shape_this_dim;
+                // If a window (kernel) is out of arg shape bounds, trim it to fit
+                auto padded_upper_bound = arg_shape[i] + padding_below[i - 2] + padding_above[i - 2];
+                if (input_batch_transform_end[i] > padded_upper_bound) {
+                    input_batch_transform_end[i] = padded_upper_bound;
+                }
+                input_batch_transform_padding_below[i] = padding_below[i - 2];
+                input_batch_transform_padding_above[i] = padding_above[i - 2];
             }
-            input_batch_transform_padding_below[i] = padding_below[i - 2];
-            input_batch_transform_padding_above[i] = padding_above[i - 2];
-        }
 
-        for (size_t i = 0; i < arg_shape.size(); i++) {
-            input_batch_transform_source_axis_order[i] = i;
-        }
+            for (size_t i = 0; i < arg_shape.size(); i++) {
+                input_batch_transform_source_axis_order[i] = i;
+            }
 
-        CoordinateTransform input_batch_transform(arg_shape,
-                                                  input_batch_transform_start,
-                                                  input_batch_transform_end,
-                                                  input_batch_transform_source_strides,
-                                                  input_batch_transform_source_axis_order,
-                                                  input_batch_transform_padding_below,
-                                                  input_batch_transform_padding_above);
+            CoordinateTransform input_batch_transform(arg_shape,
+                                                      input_batch_transform_start,
+                                                      input_batch_transform_end,
+                                                      input_batch_transform_source_strides,
+                                                      input_batch_transform_source_axis_order,
+                                                      input_batch_transform_padding_below,
+                                                      input_batch_transform_padding_above);
 
-        // As we go, we compute the maximum value:
-        //
-        //   output[O] = max(output[O],arg[I])
+            // As we go, we compute the maximum value:
+            //
+            //   output[O] = max(output[O],arg[I])
 
-        T result = std::numeric_limits<T>::lowest();
+            T result = std::numeric_limits<T>::lowest();
 
-        for (const Coordinate& input_batch_coord : input_batch_transform) {
-            if (input_batch_transform.has_source_coordinate(input_batch_coord)) {
-                T x = arg[input_batch_transform.index(input_batch_coord)];
-                result = x > result ? x : result;
+            for (const Coordinate& input_batch_coord : input_batch_transform) {
+                if (input_batch_transform.has_source_coordinate(input_batch_coord)) {
+                    T x = arg[input_batch_transform.index(input_batch_coord)];
+                    result = x > result ? x : result;
+                }
             }
-        }
 
-        out[output_transform.index(out_coord)] = result;
-    }
+            out[out_index] = result;
+        }
+    });
     NGRAPH_SUPPRESS_DEPRECATED_END
 }
 
@@ -341,10 +350,21 @@ void max_pool(const Values_t* data,
     const auto out_batch_elems = shape_size(std::begin(out_shape) + 1, std::end(out_shape));
     const auto out_channel_elems = shape_size(std::begin(out_shape) + 2, std::end(out_shape));
 
-    for (size_t b = 0; b < data_shape[0]; ++b) {
-        const Indices_t batch_indices_offset = static_cast<Indices_t>(b * data_batch_elems);
+    NGRAPH_CHECK(data_shape.size() >= 3 && data_shape.size() <= 5,
+                 "Unsupported input shape ",
+                 data_shape,
+                 " passed to the MaxPool reference implementation. Supported shapes: 3D, 4D and 5D.");
+
+    // the channels are independent, so they are pooled in parallel
+    const size_t channels = data_shape[1];
+    const size_t channel_work = std::max<size_t>(out_channel_elems * shape_size(kernel), 1);
+    const size_t min_items = std::max<size_t>(parallel_min_work / channel_work, 1);
+    parallel_ranges(data_shape[0] * channels, min_items, [&](size_t begin, size_t end) {
+        for (size_t channel_idx = begin; channel_idx < end; ++channel_idx) {
+            const size_t b = channel_idx / channels;
+            const size_t c = channel_idx % channels;
+            const Indices_t batch_indices_offset = static_cast<Indices_t>(b * data_batch_elems);
 
-        for (size_t c = 0; c < data_shape[1]; ++c) {
             // calculate the buffer offsets for a given channel "c" then execute an appropriate
             // kernel for each processed channel
             const Values_t* data_channel_first_elem = data + b * data_batch_elems + c * data_channel_elems;
@@ -390,14 +410,9 @@ void max_pool(const Values_t* data,
                                                          pads_begin,
                                                          pads_end,
                                                          indices_offset);
-            } else {
-                NGRAPH_CHECK(false,
-                             "Unsupported input shape ",
-                             data_shape,
-                             " passed to the MaxPool reference implementation. Supported shapes: 3D, 4D and 5D.");
             }
         }
-    }
+    });
 
     // adjust the calculated indices to the requested range (specified by the axis attribute) if needed
     if (axis != 0) {
@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ov {
+namespace reference {
+/// \brief The amount of the scalar operations which is worth to be run on a separate thread
+constexpr size_t parallel_min_work = 1 << 15;
+
+namespace details {
+void parallel_ranges(size_t work_amount, size_t min_items, const std::function<void(size_t, size_t)>& func);
+}  // namespace details
+
+/// \brief Splits the range [0, work_amount) into the contiguous subranges and calls func(begin, end) for them on
+///        the threads of the OpenVINO threading backend.
+///
+/// The kernels split the work by the output elements, every output element is computed by one thread in the same
+/// order of operations as in the serial loop, so the results are bit-exact with the serial execution.
+///
+/// \param work_amount The number of the work items.
+/// \param min_items The minimal number of the work items per thread, the work is not split if it is smaller.
+/// \param func The function called for the subranges.
+template <typename Func>
+void parallel_ranges(size_t work_amount, size_t min_items, Func&& func) {
+    // the small tensors (e.g. shape subgraphs) are processed in place without touching the threading backend
+    if (work_amount < 2 * min_items) {
+        if (work_amount != 0)
+            func(size_t(0), work_amount);
+        return;
+    }
+    details::parallel_ranges(work_amount, min_items, func);
+}
+}  // namespace reference
+}  // namespace ov
+
+// Proxy calls for dependant components transition to ov::reference namespace
+namespace ngraph {
+namespace runtime {
+namespace reference {
+using ov::reference::parallel_min_work;
+using ov::reference::parallel_ranges;
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/reference/utils/parallel.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ov {
+namespace reference {
+namespace details {
+void parallel_ranges(size_t work_amount, size_t min_items, const std::function<void(size_t, size_t)>& func) {
+    const size_t max_threads = static_cast<size_t>(std::max(parallel_get_max_threads(), 1));
+    const size_t threads = std::min(max_threads, work_amount / std::max<size_t>(min_items, 1));
+    if (threads <= 1) {
+        func(0, work_amount);
+        return;
+    }
+    // the exceptions can't leave the parallel region of some threading backends, so they are rethrown here
+    std::vector<std::exception_ptr> exceptions(threads);
+    ov::parallel_nt(static_cast<int>(threads), [&](const int ithr, const int nthr) {
+        size_t begin = 0, end = 0;
+        ov::splitter(work_amount, static_cast<size_t>(nthr), static_cast<size_t>(ithr), begin, end);
+        if (begin >= end)
+            return;
+        try {
+            func(begin, end);
+        } catch (...) {
+            exceptions[ithr] = std::current_exception();
+        }
+    });
+    for (const auto& exception : exceptions) {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+}
+}  // namespace details
+}  // namespace reference
+}  // namespace ov
@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/hash_util.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+
+namespace {
+constexpr uint64_t prime64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t prime64_3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t prime64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t prime64_5 = 0x27D4EB2F165667C5ULL;
+
+// the block size is fixed, so the hash value does not depend on the number of threads
+constexpr size_t parallel_block_size = 1 << 20;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t xxh_round(uint64_t acc, uint64_t input) {
+    acc += input * prime64_2;
+    acc = rotl(acc, 31);
+    return acc * prime64_1;
+}
+
+inline uint64_t merge_round(uint64_t acc, uint64_t val) {
+    acc ^= xxh_round(0, val);
+    return acc * prime64_1 + prime64_4;
+}
+}  // namespace
+
+uint64_t ov::util::hash_xxh64(const void* data, size_t size, uint64_t seed) {
+    auto p = static_cast<const uint8_t*>(data);
+    const auto end = p + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        // four independent lanes let the CPU process 32 bytes per iteration
+        const auto limit = end - 32;
+        uint64_t v1 = seed + prime64_1 + prime64_2;
+        uint64_t v2 = seed + prime64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime64_1;
+        do {
+            v1 = xxh_round(v1, read64(p));
+            v2 = xxh_round(v2, read64(p + 8));
+            v3 = xxh_round(v3, read64(p + 16));
+            v4 = xxh_round(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = merge_round(h, v1);
+        h = merge_round(h, v2);
+        h = merge_round(h, v3);
+        h = merge_round(h, v4);
+    } else {
+        h = seed + prime64_5;
+    }
+
+    h += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= xxh_round(0, read64(p));
+        h = rotl(h, 27) * prime64_1 + prime64_4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * prime64_1;
+        h = rotl(h, 23) * prime64_2 + prime64_3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        h ^= (*p) * prime64_5;
+        h = rotl(h, 11) * prime64_1;
+    }
+
+    h ^= h >> 33;
+    h *= prime64_2;
+    h ^= h >> 29;
+    h *= prime64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+uint64_t ov::util::hash_data(const void* data, size_t size, uint64_t seed) {
+    if (size <= parallel_block_size) {
+        return hash_xxh64(data, size, seed);
+    }
+
+    const auto bytes = static_cast<const uint8_t*>(data);
+    const size_t blocks = (size + parallel_block_size - 1) / parallel_block_size;
+    std::vector<uint64_t> block_hashes(blocks);
+    ov::parallel_for(blocks, [&](size_t i) {
+        const size_t offset = i * parallel_block_size;
+        block_hashes[i] = hash_xxh64(bytes + offset, std::min(parallel_block_size, size - offset), seed + i);
+    });
+    return hash_xxh64(block_hashes.data(), blocks * sizeof(uint64_t), seed + static_cast<uint64_t>(size));
+}
@@ -7,11 +7,13 @@
 #include <cmath>
 #include <cstdio>
 #include <cstring>
+#include <mutex>
 #include <ngraph/validation_util.hpp>
 #include <sstream>
 
 #include "itt.hpp"
 #include "ngraph/log.hpp"
+#include "openvino/core/hash_util.hpp"
 #include "ngraph/op/util/attr_types.hpp"
 #include "ngraph/util.hpp"
 
@@ -33,6 +35,84 @@ static inline string to_cpp_string(T value) {
     return rc;
 }
 
+OPENVINO_SUPPRESS_DEPRECATED_START
+namespace {
+// The buffer of the lazy constant. It has the size of the data but no data pointer, and holds the source constant and
+// the transform until the data is produced on the first access. The produced data is kept in a separate buffer, so
+// the data pointer of this one stays empty and all the accesses go through get_data().
+class LazyBuffer : public ngraph::runtime::AlignedBuffer {
+public:
+    LazyBuffer(const shared_ptr<const ov::op::v0::Constant>& source,
+               ov::op::v0::Constant::LazyTransform transform,
+               size_t size,
+               size_t alignment)
+        : m_source(source),
+          m_transform(std::move(transform)),
+          m_alignment(alignment) {
+        m_byte_size = size;
+    }
+
+    const shared_ptr<ngraph::runtime::AlignedBuffer>& get_data() {
+        if (!m_ready) {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            if (!m_ready) {
+                auto data = make_shared<ngraph::runtime::AlignedBuffer>(m_byte_size, m_alignment);
+                m_transform(*m_source, data->get_ptr());
+                m_data = std::move(data);
+                // the source is not needed anymore, so e.g. the mapped weights can be released
+                m_source.reset();
+                m_transform = nullptr;
+                m_ready = true;
+            }
+        }
+        return m_data;
+    }
+
+    bool is_ready() const {
+        return m_ready;
+    }
+
+    shared_ptr<const ov::op::v0::Constant> get_source() const {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_source;
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    std::atomic_bool m_ready{false};
+    shared_ptr<const ov::op::v0::Constant> m_source;
+    ov::op::v0::Constant::LazyTransform m_transform;
+    size_t m_alignment;
+    shared_ptr<ngraph::runtime::AlignedBuffer> m_data;
+};
+}  // namespace
+OPENVINO_SUPPRESS_DEPRECATED_END
+
+namespace {
+// The hash of the constant data cached in the runtime info of the constant. It is neither copied to the other nodes
+// nor serialized. The data pointer and the size it was computed for are kept, so the clone of the constant
+// sharing the same data reuses it, while a node which got the runtime info with other data recomputes it.
+class ConstantDataHash : public ov::RuntimeAttribute {
+public:
+    OPENVINO_RTTI("ConstantDataHash");
+    ConstantDataHash() = default;
+    ConstantDataHash(const void* data, size_t size, uint64_t value) : m_data(data), m_size(size), m_value(value) {}
+    bool is_copyable() const override {
+        return false;
+    }
+
+    const void* m_data = nullptr;
+    size_t m_size = 0;
+    uint64_t m_value = 0;
+};
+
+// guards the cached hash in the runtime info of the constants
+std::mutex data_hash_mutex;
+// incremented under data_hash_mutex when the data of any constant is rewritten, so a hash computed concurrently with
+// the rewrite is not cached
+uint64_t data_hash_version = 0;
+}  // namespace
+
 ov::op::v0::Constant::Constant(const shared_ptr<ngraph::runtime::Tensor>& tensor) {
     m_element_type = tensor->get_element_type();
     m_shape = tensor->get_shape();
@@ -205,6 +285,18 @@ ov::op::v0::Constant::Constant(bool memset_allocation, const element::Type& type
     constructor_validate_and_infer_types();
 }
 
+ov::op::v0::Constant::Constant(const element::Type& type,
+                               const ov::Shape& shape,
+                               const std::shared_ptr<const Constant>& source,
+                               LazyTransform transform)
+    : m_element_type(type),
+      m_shape(shape) {
+    NGRAPH_CHECK(source && transform, "Lazy constant requires the source constant and the transform");
+    NGRAPH_CHECK(source->get_shape() == shape, "Lazy constant must have the shape of the source constant");
+    m_data = make_shared<LazyBuffer>(source, std::move(transform), mem_size(), host_alignment());
+    constructor_validate_and_infer_types();
+}
+
 void ov::op::v0::Constant::allocate_buffer(bool memset_allocation) {
     m_data = make_shared<ngraph::runtime::AlignedBuffer>(mem_size(), host_alignment());
     if (memset_allocation) {
@@ -239,6 +331,23 @@ ov::op::v0::Constant::Constant(const Constant& other, const ov::Shape& new_shape
 
 ov::op::v0::Constant::~Constant() = default;
 
+OPENVINO_SUPPRESS_DEPRECATED_START
+const void* ov::op::v0::Constant::get_lazy_data_ptr() const {
+    const auto lazy = dynamic_cast<LazyBuffer*>(m_data.get());
+    return lazy ? lazy->get_data()->get_ptr() : nullptr;
+}
+
+bool ov::op::v0::Constant::is_lazy() const {
+    const auto lazy = dynamic_cast<const LazyBuffer*>(m_data.get());
+    return lazy && !lazy->is_ready();
+}
+
+std::shared_ptr<const ov::op::v0::Constant> ov::op::v0::Constant::get_lazy_source() const {
+    const auto lazy = dynamic_cast<const LazyBuffer*>(m_data.get());
+    return lazy ? lazy->get_source() : nullptr;
+}
+OPENVINO_SUPPRESS_DEPRECATED_END
+
 string ov::op::v0::Constant::convert_value_to_string(size_t index) const {
     string rc;
 #if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
@@ -550,11 +659,50 @@ bool ov::op::v0::Constant::visit_attributes(AttributeVisitor& visitor) {
         // Filling in a fresh constant
         allocate_buffer(false);
     }
+    if (const auto lazy = dynamic_cast<LazyBuffer*>(m_data.get())) {
+        // the visitor works with the buffer itself, so the data is produced here
+        const auto data = lazy->get_data();
+        m_data = data;
+    }
     visitor.on_attribute("value", m_data);
     update_identical_flags(false, false);
+    {
+        // the data has been rewritten, so the cached hash is not valid anymore
+        std::lock_guard<std::mutex> lock{data_hash_mutex};
+        ++data_hash_version;
+        get_rt_info().erase(ConstantDataHash::get_type_info_static());
+    }
     return true;
 }
 
+uint64_t ov::util::hash_constant_data(const ov::op::v0::Constant& constant) {
+    const auto data = constant.get_data_ptr();
+    const auto size = constant.get_byte_size();
+    const auto& key = ConstantDataHash::get_type_info_static();
+    // the runtime info is modified by the const method, like the other caches of the constant
+    auto& rt_info = const_cast<ov::op::v0::Constant&>(constant).get_rt_info();
+
+    uint64_t version;
+    {
+        std::lock_guard<std::mutex> lock{data_hash_mutex};
+        const auto found = rt_info.find(key);
+        if (found != rt_info.end()) {
+            const auto& cached = found->second.as<ConstantDataHash>();
+            if (cached.m_data == data && cached.m_size == size)
+                return cached.m_value;
+        }
+        version = data_hash_version;
+    }
+
+    // the data is hashed without the lock, so the different constants are hashed in parallel
+    const auto value = hash_data(data, size);
+
+    std::lock_guard<std::mutex> lock{data_hash_mutex};
+    if (version == data_hash_version)
+        rt_info[key] = ConstantDataHash(data, size, value);
+    return value;
+}
+
 bool ov::op::v0::Constant::evaluate(const HostTensorVector& outputs, const HostTensorVector& inputs) const {
     OV_OP_SCOPE(v0_Constant_evaluate);
     auto output = outputs[0];
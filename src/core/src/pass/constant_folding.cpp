@@ -4,10 +4,16 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <atomic>
+#include <unordered_set>
+
 #include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/parameter.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/shape_of_base.hpp"
@@ -48,42 +54,210 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+namespace {
+// the folded outputs of the nodes evaluated in parallel are kept till the wave is applied to the graph,
+// so the wave is limited by their size
+constexpr size_t parallel_wave_bytes = 256 << 20;
+constexpr size_t parallel_wave_nodes = 1024;
+// elementwise nodes bigger than this are split into the chunks evaluated in parallel,
+// the chunk is a multiple of 8 elements, so the chunks of u1/u4/i4 tensors start at a byte boundary
+constexpr size_t parallel_elementwise_elements = 1 << 18;
+constexpr size_t parallel_chunk_elements = 1 << 16;
+
+bool has_constant_inputs(const ov::Node& node) {
+    for (const auto& input : node.input_values()) {
+        if (!ov::is_type<ov::op::v0::Constant>(input.get_node()))
+            return false;
+    }
+    return true;
+}
+
+size_t output_bytes(const ov::Node& node) {
+    size_t bytes = 0;
+    for (const auto& output : node.outputs())
+        bytes += (ov::shape_size(output.get_shape()) * output.get_element_type().bitwidth() + 7) >> 3;
+    return bytes;
+}
+
+/**
+ * \brief Checks if the node may be folded in the wave: all inputs are constants and the output shapes are known,
+ * so the node does not depend on the other nodes of the wave and the size of its result is known.
+ */
+bool can_fold_in_parallel(const ov::Node& node) {
+    if (node.get_input_size() == 0 || ov::is_type<ov::op::util::MultiSubGraphOp>(&node) ||
+        !has_constant_inputs(node)) {
+        return false;
+    }
+    for (const auto& output : node.outputs()) {
+        if (output.get_partial_shape().is_dynamic())
+            return false;
+    }
+    return true;
+}
+
+bool is_big_elementwise(const ov::Node& node) {
+    if (!ov::is_type<ov::op::v0::Convert>(&node) && !ov::op::util::is_unary_elementwise_arithmetic(&node) &&
+        !ov::op::util::is_binary_elementwise_arithmetic(&node) &&
+        !ov::op::util::is_binary_elementwise_comparison(&node) && !ov::op::util::is_binary_elementwise_logical(&node)) {
+        return false;
+    }
+    if (node.get_output_size() != 1 || node.get_output_partial_shape(0).is_dynamic() ||
+        ov::shape_size(node.get_output_shape(0)) < parallel_elementwise_elements ||
+        ov::pass::constant_folding_is_disabled(&node) || !node.has_evaluate()) {
+        return false;
+    }
+    // no broadcast, so the flat chunks of the inputs and the output correspond to each other
+    for (const auto& input : node.input_values()) {
+        if (input.get_shape() != node.get_output_shape(0))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * \brief Evaluates the big elementwise node by the flat chunks of the inputs, in parallel if requested.
+ */
+bool evaluate_elementwise_by_chunks(const ov::Node& node,
+                                    const std::vector<std::shared_ptr<const ov::op::v0::Constant>>& inputs,
+                                    void* output,
+                                    bool parallel) {
+    const auto& output_type = node.get_output_element_type(0);
+    const auto size = ov::shape_size(node.get_output_shape(0));
+
+    const auto chunk_ptr = [](const void* data, const ov::element::Type& type, size_t offset) {
+        return static_cast<char*>(const_cast<void*>(data)) + offset * type.bitwidth() / 8;
+    };
+    std::atomic_bool failed{false};
+    const auto evaluate_chunk = [&](size_t chunk) {
+        const size_t offset = chunk * parallel_chunk_elements;
+        const ov::Shape chunk_shape{std::min(parallel_chunk_elements, size - offset)};
+        ov::TensorVector input_tensors;
+        for (const auto& input : inputs) {
+            const auto& type = input->get_element_type();
+            input_tensors.emplace_back(type, chunk_shape, chunk_ptr(input->get_data_ptr(), type, offset));
+        }
+        ov::TensorVector output_tensors{ov::Tensor(output_type, chunk_shape, chunk_ptr(output, output_type, offset))};
+        if (!node.evaluate(output_tensors, input_tensors))
+            failed = true;
+    };
+    const size_t chunks = (size + parallel_chunk_elements - 1) / parallel_chunk_elements;
+    if (parallel) {
+        ov::parallel_for(chunks, evaluate_chunk);
+    } else {
+        for (size_t chunk = 0; chunk < chunks; chunk++)
+            evaluate_chunk(chunk);
+    }
+    return !failed;
+}
+
+bool fold_elementwise_in_parallel(const std::shared_ptr<ov::Node>& node, ov::OutputVector& replacements) {
+    ov::NodeVector input_nodes;
+    std::vector<std::shared_ptr<const ov::op::v0::Constant>> inputs;
+    for (const auto& input : node->input_values()) {
+        input_nodes.push_back(input.get_node_shared_ptr());
+        inputs.push_back(ov::as_type_ptr<ov::op::v0::Constant>(input.get_node_shared_ptr()));
+    }
+    ov::Tensor output(node->get_output_element_type(0), node->get_output_shape(0));
+    if (!evaluate_elementwise_by_chunks(*node, inputs, output.data(), true))
+        return false;
+
+    replacements[0] = std::make_shared<ov::op::v0::Constant>(output);
+    ov::copy_runtime_info(input_nodes, replacements[0].get_node_shared_ptr());
+    return true;
+}
+
+/**
+ * \brief Folds the big Convert of a constant to the lazy constant, so e.g. the decompression of the weights
+ * mapped from the file happens only when the plugin reads the converted data.
+ */
+bool fold_convert_lazily(const std::shared_ptr<ov::Node>& node, ov::OutputVector& replacements, bool parallel) {
+    const auto source = ov::as_type_ptr<ov::op::v0::Constant>(node->get_input_node_shared_ptr(0));
+    // the transform keeps the copy of the Convert detached from the graph rather than the node itself
+    const auto convert = node->clone_with_new_inputs(
+        {std::make_shared<ov::op::v0::Parameter>(source->get_element_type(), source->get_shape())});
+    auto transform = [convert, parallel](const ov::op::v0::Constant& source, void* data) {
+        const auto input = std::static_pointer_cast<const ov::op::v0::Constant>(source.shared_from_this());
+        OPENVINO_ASSERT(evaluate_elementwise_by_chunks(*convert, {input}, data, parallel),
+                        "Can't evaluate the lazily folded ",
+                        convert->get_type_name());
+    };
+    replacements[0] = std::make_shared<ov::op::v0::Constant>(node->get_output_element_type(0),
+                                                             node->get_output_shape(0),
+                                                             source,
+                                                             std::move(transform));
+    ov::copy_runtime_info(source, replacements[0].get_node_shared_ptr());
+    return true;
+}
+
+bool fold_node(const std::shared_ptr<ov::Node>& node, ov::OutputVector& replacements, bool parallel) {
+    if (is_big_elementwise(*node) && has_constant_inputs(*node)) {
+        if (ov::is_type<ov::op::v0::Convert>(node))
+            return fold_convert_lazily(node, replacements, parallel);
+        if (parallel && fold_elementwise_in_parallel(node, replacements))
+            return true;
+    }
+    return node->constant_fold(replacements, node->input_values());
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
 
-    for (const auto& node : model->get_ordered_ops()) {
-        if (rewritten) {
+    // The nodes with constant inputs are collected into the wave which is evaluated in parallel once a node depends
+    // on the wave. The replacements are applied to the graph in the topological order, so the result is the same
+    // as of the serial folding.
+    std::vector<std::shared_ptr<Node>> wave;
+    std::unordered_set<const Node*> wave_nodes;
+    size_t wave_bytes = 0;
+    const auto apply_wave = [&]() {
+        std::vector<OutputVector> replacements(wave.size());
+        std::vector<char> folded(wave.size(), false);
+        ov::parallel_for(wave.size(), [&](size_t i) {
+            replacements[i].resize(wave[i]->get_output_size());
+            folded[i] = fold_node(wave[i], replacements[i], true);
+        });
+        for (size_t i = 0; i < wave.size(); i++) {
+            if (folded[i])
+                rewritten |= replace_folded_outputs(wave[i], replacements[i]);
+        }
+        wave.clear();
+        wave_nodes.clear();
+        wave_bytes = 0;
+    };
+
+    auto ordered_ops = model->get_ordered_ops();
+    for (auto& ordered_op : ordered_ops) {
+        // the node is released once it is processed, so the replaced nodes and the intermediate constants they hold
+        // are freed during the pass rather than after it
+        auto node = std::move(ordered_op);
+        if (m_parallel && !wave.empty()) {
+            const auto inputs = node->inputs();
+            const bool depends_on_wave = std::any_of(inputs.begin(), inputs.end(), [&](const Input<Node>& input) {
+                return wave_nodes.count(input.get_source_output().get_node()) != 0;
+            });
+            if (depends_on_wave)
+                apply_wave();
+        }
+
+        if (rewritten || !wave.empty()) {
             node->validate_and_infer_types();
         }
 
-        OutputVector replacements(node->get_output_size());
+        if (m_parallel && can_fold_in_parallel(*node)) {
+            wave.push_back(node);
+            wave_nodes.insert(node.get());
+            wave_bytes += output_bytes(*node);
+            if (wave_bytes >= parallel_wave_bytes || wave.size() >= parallel_wave_nodes)
+                apply_wave();
+            continue;
+        }
 
-        if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(node, replacement.get_node_shared_ptr());
+        OutputVector replacements(node->get_output_size());
 
-                    rewritten = true;
-                }
-            }
+        if (fold_node(node, replacements, m_parallel)) {
+            rewritten |= replace_folded_outputs(node, replacements);
         } else {
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
             if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
@@ -94,7 +268,38 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
             }
         }
     }
+    if (!wave.empty())
+        apply_wave();
+
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::replace_folded_outputs(const std::shared_ptr<Node>& node,
+                                                       const OutputVector& replacements) {
+    OPENVINO_ASSERT(!constant_folding_is_disabled(node),
+                    "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                    node);
+    OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
+                    "constant_fold_default returned incorrect number of replacements for ",
+                    node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+            replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
 
+            node_output.replace(replacement);
+            // Copy runtime info from source nodes
+            // when it was not propogated during pre-calculation
+            copy_runtime_info_from_input_values(node);
+            // Propagate runtime info attributes to replacement
+            copy_runtime_info(node, replacement.get_node_shared_ptr());
+
+            rewritten = true;
+        }
+    }
     return rewritten;
 }
 
@@ -14,10 +14,13 @@
 
 #include "openvino/core/coordinate_diff.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/hash_util.hpp"
 #include "openvino/core/meta_data.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/reference/convert.hpp"
@@ -64,32 +67,24 @@ std::string translate_type_name(const std::string& name) {
     return name;
 }
 
-size_t hash_combine(const void* v, int64_t size) {
-    constexpr auto cel_size = sizeof(size_t);
-    auto seed = static_cast<size_t>(size);
-    const auto data = static_cast<const size_t*>(v);
-    const auto d_end = std::next(data, size / cel_size);
-    // The constant value used as a magic number has been
-    // traditionally used e.g. in boost library's hash_combine.
-    // It happens to be derived from the golden ratio.
-    for (auto d = data; d != d_end; ++d) {
-        seed ^= *d + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-    size_t last_bytes{0};
-    std::memcpy(&last_bytes, d_end, size % cel_size);
-    seed ^= last_bytes + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    return seed;
-}
+// the big constants are compressed to fp16 by the blocks in parallel
+constexpr size_t compression_block = 1 << 16;
 
 class ConstantWriter {
 public:
     using FilePosition = int64_t;
-    using HashValue = size_t;
-    using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
+    using HashValue = uint64_t;
+    struct WrittenData {
+        FilePosition offset;
+        void const* ptr;
+        size_t size;
+    };
+    using ConstWritePositions = std::unordered_map<HashValue, WrittenData>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
+    ConstantWriter(std::ostream& bin_data, bool enable_compression = true, bool hash_only = false)
         : m_binary_output(bin_data),
           m_enable_compression(enable_compression),
+          m_hash_only(hash_only),
           m_blob_offset(bin_data.tellp()) {}
 
     FilePosition write(const char* ptr,
@@ -101,6 +96,17 @@ public:
         const auto offset = write_pos - m_blob_offset;
         *new_size = size;
 
+        if (m_hash_only) {
+            // The output only feeds the hash of the model, so the hash of the data stands for the data itself. The
+            // hashes cached in the constants are used, the data is neither read again nor compressed.
+            if (compress_to_fp16)
+                *new_size = size / src_type.size() * ov::element::f16.size();
+            const HashValue hash = get_hash(ptr, size);
+            m_binary_output.write(reinterpret_cast<const char*>(&hash), sizeof(hash));
+            m_binary_output.write(reinterpret_cast<const char*>(&compress_to_fp16), sizeof(compress_to_fp16));
+            return offset;
+        }
+
         if (!m_enable_compression || compress_to_fp16) {
             write_with_optional_fp16_compression(ptr, size, new_size, compress_to_fp16, src_type);
             return offset;
@@ -114,24 +120,63 @@ public:
         // can avoid comparing FP32 weights, but it would require comparing with data from a file, because on-the-fly
         // converted FP16 constants are not kept in memory.
 
-        // This hash is weak (but efficient) and must be replace with some other
-        // more stable hash algorithm. For example current hash algorithms gives
-        // the same hash for {2, 2} and {0, 128} arrays. So we have to compare
-        // values when finding a match in hash map.
-        const HashValue hash = hash_combine(ptr, size);
+        // The 64-bit content hash makes the collisions of the different data practically impossible, so the data
+        // is compared only for the real duplicates which are not the same buffer
+        const HashValue hash = get_hash(ptr, size);
         const auto found = m_hash_to_file_positions.find(hash);
-        if (found != end(m_hash_to_file_positions) &&
-            memcmp(static_cast<void const*>(ptr), found->second.second, size) == 0) {
-            return found->second.first;
+        if (found != end(m_hash_to_file_positions) && found->second.size == size &&
+            (found->second.ptr == ptr || memcmp(static_cast<void const*>(ptr), found->second.ptr, size) == 0)) {
+            return found->second.offset;
         }
 
         write_with_optional_fp16_compression(ptr, size, new_size, compress_to_fp16, src_type);
-        m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr)}});
+        m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr), size}});
 
         return offset;
     }
 
+    /**
+     * @brief Hashes the data of the model constants in parallel before the serialization streams them out one by
+     * one. The hash is cached in the constant, so the following serializations and the model hash calculations
+     * of the same model reuse it.
+     */
+    void hash_constants(const ov::Model& model) {
+        if (!m_enable_compression && !m_hash_only)
+            return;
+        std::vector<std::shared_ptr<ov::op::v0::Constant>> constants;
+        collect_constants(model, constants, m_hash_only);
+
+        std::vector<HashValue> hashes(constants.size());
+        ov::parallel_for(constants.size(), [&](size_t i) {
+            hashes[i] = ov::util::hash_constant_data(*constants[i]);
+        });
+        for (size_t i = 0; i < constants.size(); i++)
+            m_data_hashes[constants[i]->get_data_ptr()] = {constants[i]->get_byte_size(), hashes[i]};
+    }
+
 private:
+    static void collect_constants(const ov::Model& model,
+                                  std::vector<std::shared_ptr<ov::op::v0::Constant>>& constants,
+                                  bool with_fp16_compressed) {
+        for (const auto& node : model.get_ordered_ops()) {
+            if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node)) {
+                // the constants compressed to fp16 on the fly are not deduplicated
+                if (with_fp16_compressed || !is_fp16_compression_postponed(constant->get_rt_info()))
+                    constants.push_back(constant);
+            } else if (auto sub_graph = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node)) {
+                for (size_t i = 0; i < sub_graph->get_internal_subgraphs_size(); i++)
+                    collect_constants(*sub_graph->get_function(static_cast<int>(i)), constants, with_fp16_compressed);
+            }
+        }
+    }
+
+    HashValue get_hash(const char* ptr, size_t size) const {
+        const auto found = m_data_hashes.find(ptr);
+        if (found != m_data_hashes.end() && found->second.first == size)
+            return found->second.second;
+        return ov::util::hash_data(ptr, size);
+    }
+
     void write_with_optional_fp16_compression(const char* ptr,
                                               size_t size,
                                               size_t* new_size,
@@ -147,6 +192,10 @@ private:
         }
     }
 
+    static size_t blocks_count(size_t elements) {
+        return (elements + compression_block - 1) / compression_block;
+    }
+
     std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                   size_t size,
                                                   ov::element::Type src_type,
@@ -157,7 +206,13 @@ private:
             auto new_ptr = std::unique_ptr<char[]>(new char[*compressed_size]);
             auto dst_data = reinterpret_cast<ov::float16*>(new_ptr.get());
             auto src_data = reinterpret_cast<const float*>(ptr);
-            ngraph::runtime::reference::convert_from_f32_to_f16_with_clamp(src_data, dst_data, num_src_elements);
+            ov::parallel_for(blocks_count(num_src_elements), [&](size_t block) {
+                const auto begin = block * compression_block;
+                ngraph::runtime::reference::convert_from_f32_to_f16_with_clamp(
+                    src_data + begin,
+                    dst_data + begin,
+                    std::min(compression_block, num_src_elements - begin));
+            });
             return new_ptr;
         } else if (src_type == ov::element::f64) {
             auto new_ptr = std::unique_ptr<char[]>(new char[*compressed_size]);
@@ -165,18 +220,22 @@ private:
             auto src_data = reinterpret_cast<const double*>(ptr);
 
             // Reference implementation for fp64 to fp16 conversoin
-            for (size_t i = 0; i < num_src_elements; ++i) {
-                // if abs value is smaller than the smallest positive fp16, but not zero
-                if (std::abs(src_data[i]) < ov::float16::from_bits(0x0001) && src_data[i] != 0.0f) {
-                    dst_data[i] = 0;
-                } else if (src_data[i] > std::numeric_limits<ov::float16>::max()) {
-                    dst_data[i] = std::numeric_limits<ov::float16>::max();
-                } else if (src_data[i] < std::numeric_limits<ov::float16>::lowest()) {
-                    dst_data[i] = std::numeric_limits<ov::float16>::lowest();
-                } else {
-                    dst_data[i] = static_cast<ov::float16>(src_data[i]);
+            ov::parallel_for(blocks_count(num_src_elements), [&](size_t block) {
+                const auto begin = block * compression_block;
+                const auto end = std::min(begin + compression_block, num_src_elements);
+                for (size_t i = begin; i < end; i++) {
+                    // if abs value is smaller than the smallest positive fp16, but not zero
+                    if (std::abs(src_data[i]) < ov::float16::from_bits(0x0001) && src_data[i] != 0.0f) {
+                        dst_data[i] = 0;
+                    } else if (src_data[i] > std::numeric_limits<ov::float16>::max()) {
+                        dst_data[i] = std::numeric_limits<ov::float16>::max();
+                    } else if (src_data[i] < std::numeric_limits<ov::float16>::lowest()) {
+                        dst_data[i] = std::numeric_limits<ov::float16>::lowest();
+                    } else {
+                        dst_data[i] = static_cast<ov::float16>(src_data[i]);
+                    }
                 }
-            }
+            });
             return new_ptr;
         } else {
             OPENVINO_THROW("[ INTERNAL ERROR ] Not supported source type for weights compression: ", src_type);
@@ -184,8 +243,11 @@ private:
     }
 
     ConstWritePositions m_hash_to_file_positions;
+    // data pointer -> (size, hash) of the constants hashed in advance
+    std::unordered_map<const void*, std::pair<size_t, HashValue>> m_data_hashes;
     std::ostream& m_binary_output;
     bool m_enable_compression;
+    bool m_hash_only;
     FilePosition m_blob_offset;  // blob offset inside output stream
 };
 
@@ -1137,6 +1199,8 @@ std::string valid_xml_path(const std::string& path) {
     return path;
 }
 
+constexpr size_t bin_file_buffer_size = 4 << 20;
+
 std::string provide_bin_path(const std::string& xmlPath, const std::string& binPath) {
     if (!binPath.empty()) {
         return binPath;
@@ -1154,7 +1218,8 @@ void serializeFunc(std::ostream& xml_file,
                    std::shared_ptr<ov::Model> model,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                   bool deterministic = false) {
+                   bool deterministic = false,
+                   bool hash_only = false) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = model->get_rt_info();
@@ -1175,7 +1240,8 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
+    ConstantWriter constant_write_handler(bin_file, true, hash_only);
+    constant_write_handler.hash_constants(*model);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, model);
 
@@ -1196,7 +1262,11 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
         if (xmlDir != m_xmlPath)
             ov::util::create_directory_recursive(xmlDir);
 
-        std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
+        // the big buffer merges the writes of the small constants, the big ones are written directly
+        std::vector<char> bin_buffer(bin_file_buffer_size);
+        std::ofstream bin_file;
+        bin_file.rdbuf()->pubsetbuf(bin_buffer.data(), bin_buffer.size());
+        bin_file.open(m_binPath, std::ios::out | std::ios::binary);
         OPENVINO_ASSERT(bin_file, "Can't open bin file: \"" + m_binPath + "\"");
 
         // create xml file
@@ -1315,6 +1385,7 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ov::Model>& model
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
     ConstantWriter constant_write_handler(m_stream);
+    constant_write_handler.hash_constants(*model);
     XmlSerializer visitor(net_node, name, m_custom_opsets, constant_write_handler, version);
     std::shared_ptr<ov::Model> fun = model;
     visitor.on_attribute(name, fun);
@@ -1357,18 +1428,7 @@ public:
     }
 
     std::streamsize xsputn(const char* s, std::streamsize n) override {
-        auto* intS = (const std::streamsize*)s;
-        std::streamsize n64 = n / static_cast<std::streamsize>(sizeof(std::streamsize));
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
-        }
-
-        std::streamsize rest = n % static_cast<std::streamsize>(sizeof(std::streamsize));
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
-        }
+        m_res = hash_combine(m_res, ov::util::hash_data(s, static_cast<size_t>(n)));
         return n;
     }
 };
@@ -1381,8 +1441,8 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
     std::ostream xml(&xmlHash);
     std::ostream bin(&binHash);
 
-    // Determinism is important for hash calculation
-    serializeFunc(xml, bin, model, Serialize::Version::UNSPECIFIED, {}, true);
+    // Determinism is important for hash calculation, the constants are represented by the hashes of their data
+    serializeFunc(xml, bin, model, Serialize::Version::UNSPECIFIED, {}, true, true);
 
     uint64_t seed = 0;
     seed = hash_combine(seed, xmlHash.getResult());
@@ -6,10 +6,13 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 
 #include "common_test_utils/type_prop.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/hash_util.hpp"
 
 using namespace ov;
 using namespace std;
@@ -1783,3 +1786,69 @@ TEST(constant, lazy_bitwise_identical) {
     // '10' times is guaranteed to be faster here (typical value is ~200'000)
     EXPECT_GT(bitwise_check_count_only, bitwise_check_count * 10);
 }
+
+TEST(constant, data_hash) {
+    auto shape = Shape{3, 1000, 1000};
+    std::vector<float> data(shape_size(shape));
+    std::iota(data.begin(), data.end(), 0.f);
+
+    auto constant1 = std::make_shared<op::v0::Constant>(element::f32, shape, data.data());
+    auto constant2 = std::make_shared<op::v0::Constant>(element::f32, shape, data.data());
+    data.back() = -1.f;
+    auto constant3 = std::make_shared<op::v0::Constant>(element::f32, shape, data.data());
+
+    EXPECT_TRUE(constant1->get_rt_info().empty());
+    const auto hash = util::hash_constant_data(*constant1);
+    EXPECT_EQ(hash, util::hash_data(constant1->get_data_ptr(), constant1->get_byte_size()));
+    // the hash is cached in the runtime info of the constant
+    EXPECT_EQ(constant1->get_rt_info().size(), 1u);
+    EXPECT_EQ(hash, util::hash_constant_data(*constant1));
+    EXPECT_EQ(hash, util::hash_constant_data(*constant2));
+    EXPECT_NE(hash, util::hash_constant_data(*constant3));
+
+    // the copy has its own cache
+    op::v0::Constant copy(*constant1);
+    EXPECT_TRUE(copy.get_rt_info().empty());
+    EXPECT_EQ(hash, util::hash_constant_data(copy));
+
+    // the cached hash is used only for the data it was computed for
+    constant3->get_rt_info() = constant1->get_rt_info();
+    EXPECT_NE(hash, util::hash_constant_data(*constant3));
+    EXPECT_EQ(util::hash_constant_data(*constant3),
+              util::hash_data(constant3->get_data_ptr(), constant3->get_byte_size()));
+}
+
+TEST(constant, lazy_transform) {
+    auto source = std::make_shared<op::v0::Constant>(element::i32, Shape{2, 3}, std::vector<int32_t>{1, 2, 3, 4, 5, 6});
+    size_t transforms = 0;
+    auto transform = [&transforms](const op::v0::Constant& source, void* data) {
+        transforms++;
+        const auto values = source.cast_vector<float>();
+        std::copy(values.begin(), values.end(), static_cast<float*>(data));
+    };
+    // the lazy constant is the conversion of the source, so the shapes must match
+    EXPECT_THROW(op::v0::Constant(element::f32, Shape{3, 2}, source, transform), ov::Exception);
+    auto constant = std::make_shared<op::v0::Constant>(element::f32, Shape{2, 3}, source, transform);
+    std::weak_ptr<op::v0::Constant> weak_source = source;
+    source.reset();
+
+    // the shape, the type and the size are known without running the transform
+    EXPECT_EQ(constant->get_output_element_type(0), element::f32);
+    EXPECT_EQ(constant->get_output_shape(0), (Shape{2, 3}));
+    EXPECT_EQ(constant->get_byte_size(), 6 * sizeof(float));
+    EXPECT_TRUE(constant->is_lazy());
+    EXPECT_EQ(constant->get_lazy_source(), weak_source.lock());
+    EXPECT_EQ(transforms, 0);
+
+    // the copy shares the pending transform, so it is run only once
+    op::v0::Constant copy(*constant);
+    EXPECT_EQ(constant->get_vector<float>(), (std::vector<float>{1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(copy.get_vector<float>(), (std::vector<float>{1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(copy.get_data_ptr(), constant->get_data_ptr());
+    EXPECT_EQ(transforms, 1);
+
+    // the source is released once the data is produced
+    EXPECT_FALSE(constant->is_lazy());
+    EXPECT_EQ(constant->get_lazy_source(), nullptr);
+    EXPECT_TRUE(weak_source.expired());
+}
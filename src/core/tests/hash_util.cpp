@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/hash_util.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+
+using namespace std;
+using namespace ov;
+
+namespace {
+// Table-driven CRC64 (ECMA-182) previously used for the CPU weights sharing keys, the benchmark baseline
+class Crc64 {
+public:
+    Crc64() {
+        for (uint64_t i = 0; i < 256; i++) {
+            uint64_t c = i;
+            for (int j = 0; j < 8; j++)
+                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
+            table[i] = c;
+        }
+    }
+    uint64_t hash(const uint8_t* data, size_t size) const {
+        uint64_t crc = 0;
+        for (size_t idx = 0; idx < size; idx++)
+            crc = table[static_cast<uint8_t>(crc) ^ data[idx]] ^ (crc >> 8);
+        return ~crc;
+    }
+
+private:
+    uint64_t table[256];
+};
+
+std::vector<uint8_t> make_random_data(size_t size) {
+    std::vector<uint8_t> data(size);
+    std::mt19937 rng(2112);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    for (auto& v : data)
+        v = static_cast<uint8_t>(distribution(rng));
+    return data;
+}
+
+template <typename F>
+double throughput_gbps(size_t size, F&& f) {
+    using namespace std::chrono;
+    auto start = steady_clock::now();
+    f();
+    auto seconds = duration_cast<duration<double>>(steady_clock::now() - start).count();
+    return static_cast<double>(size) / seconds / 1e9;
+}
+}  // namespace
+
+TEST(hash_util, xxh64_reference_values) {
+    EXPECT_EQ(util::hash_xxh64("", 0), 0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(util::hash_xxh64("abc", 3), 0x44BC2CF5AD770999ULL);
+}
+
+TEST(hash_util, small_data_is_xxh64) {
+    auto data = make_random_data(1000);
+    EXPECT_EQ(util::hash_data(data.data(), data.size()), util::hash_xxh64(data.data(), data.size()));
+}
+
+TEST(hash_util, big_data_content_sensitive) {
+    auto data = make_random_data((5 << 20) + 3);
+    const auto hash = util::hash_data(data.data(), data.size());
+    EXPECT_EQ(hash, util::hash_data(data.data(), data.size()));
+
+    // the change of any block or of the size changes the hash
+    data[data.size() / 2] ^= 1;
+    EXPECT_NE(hash, util::hash_data(data.data(), data.size()));
+    data[data.size() / 2] ^= 1;
+    EXPECT_NE(hash, util::hash_data(data.data(), data.size() - 1));
+
+    // the swap of two equal size blocks changes the hash
+    std::swap_ranges(data.begin(), data.begin() + (1 << 20), data.begin() + (1 << 20));
+    EXPECT_NE(hash, util::hash_data(data.data(), data.size()));
+}
+
+TEST(hash_util, seed_changes_hash) {
+    for (const size_t size : {size_t{1000}, size_t{(5 << 20) + 3}}) {
+        auto data = make_random_data(size);
+        EXPECT_EQ(util::hash_data(data.data(), size), util::hash_data(data.data(), size, 0));
+        EXPECT_NE(util::hash_data(data.data(), size), util::hash_data(data.data(), size, 1)) << size;
+    }
+}
+
+// the throughput depends on the machine and its load, so the benchmark is only run on demand
+TEST(benchmark, DISABLED_hash_data) {
+    const size_t size = 128 << 20;
+    auto data = make_random_data(size);
+    Crc64 crc64;
+
+    uint64_t result = 0;
+    auto crc64_gbps = throughput_gbps(size, [&] {
+        result ^= crc64.hash(data.data(), size);
+    });
+    auto xxh64_gbps = throughput_gbps(size, [&] {
+        result ^= util::hash_xxh64(data.data(), size);
+    });
+    auto parallel_gbps = throughput_gbps(size, [&] {
+        result ^= util::hash_data(data.data(), size);
+    });
+
+    std::cout << "Hashing " << (size >> 20) << " MB, GB/s: crc64 " << crc64_gbps << ", xxh64 " << xxh64_gbps
+              << ", parallel xxh64 (" << parallel_get_max_threads() << " threads) " << parallel_gbps << " [" << result
+              << "]\n";
+}
@@ -6,12 +6,20 @@
 
 #include <gmock/gmock.h>
 
+#include <chrono>
+#include <cstring>
+
 #include "common_test_utils/all_close_f.hpp"
 #include "common_test_utils/ngraph_test_utils.hpp"
 #include "common_test_utils/test_tools.hpp"
 #include "openvino/op/acosh.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
 #include "openvino/op/loop.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
 #include "transformations/common_optimizations/disable_shapeof_constant_folding.hpp"
 #include "transformations/utils/utils.hpp"
 
@@ -3925,3 +3933,111 @@ TEST(constant_folding, parameter_with_unspecified_type_from_host_tensor) {
     auto model = std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{param});
     EXPECT_NO_THROW(run_constant_folding(model));
 }
+
+namespace {
+// Weights decompression chains: Convert(u4 -> f32) -> Subtract(zero point) -> Multiply(scale) -> Transpose
+std::shared_ptr<ov::Model> make_decompression_model(size_t chains, const Shape& shape) {
+    ResultVector results;
+    for (size_t i = 0; i < chains; i++) {
+        std::vector<uint8_t> weights_data((shape_size(shape) + 1) / 2);
+        for (size_t j = 0; j < weights_data.size(); j++)
+            weights_data[j] = static_cast<uint8_t>(j * 7 + i);
+        auto weights = make_shared<ov::op::v0::Constant>(element::u4, shape, weights_data.data());
+        weights->set_friendly_name("weights_" + std::to_string(i));
+        auto convert = make_shared<ov::op::v0::Convert>(weights, element::f32);
+        auto zero_point = ov::op::v0::Constant::create(element::f32, Shape{}, {8});
+        auto subtract = make_shared<ov::op::v1::Subtract>(convert, zero_point);
+        auto scale = make_shared<ov::op::v0::Constant>(element::f32, shape, 0.5f + static_cast<float>(i));
+        auto multiply = make_shared<ov::op::v1::Multiply>(subtract, scale);
+        auto order = ov::op::v0::Constant::create(element::i64, Shape{2}, {1, 0});
+        auto transpose = make_shared<ov::op::v1::Transpose>(multiply, order);
+        transpose->set_friendly_name("transpose_" + std::to_string(i));
+        results.push_back(make_shared<ov::op::v0::Result>(transpose));
+    }
+    return make_shared<ov::Model>(results, ParameterVector{});
+}
+
+void expect_same_results(const std::shared_ptr<ov::Model>& actual, const std::shared_ptr<ov::Model>& expected) {
+    ASSERT_EQ(actual->get_results().size(), expected->get_results().size());
+    for (size_t i = 0; i < expected->get_results().size(); i++) {
+        auto actual_const = get_result_constant(actual, i);
+        auto expected_const = get_result_constant(expected, i);
+        ASSERT_TRUE(actual_const);
+        ASSERT_TRUE(expected_const);
+        EXPECT_EQ(expected_const->get_friendly_name(), actual_const->get_friendly_name());
+        EXPECT_EQ(ov::getFusedNamesVector(expected_const), ov::getFusedNamesVector(actual_const));
+        ASSERT_EQ(expected_const->get_byte_size(), actual_const->get_byte_size());
+        EXPECT_EQ(0,
+                  std::memcmp(expected_const->get_data_ptr(),
+                              actual_const->get_data_ptr(),
+                              expected_const->get_byte_size()));
+    }
+}
+
+double fold_time_ms(const std::shared_ptr<ov::Model>& model, bool parallel) {
+    const auto start = std::chrono::steady_clock::now();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(parallel);
+    pass_manager.run_passes(model);
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+TEST(constant_folding, parallel_matches_serial) {
+    // the size is not a multiple of the parallel chunk, so the last chunks of the u4 and f32 tensors are partial
+    auto model = make_decompression_model(3, Shape{515, 1031});
+    auto serial_model = model->clone();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ov::pass::InitNodeInfo>();
+    pass_manager.run_passes(model);
+    pass_manager.run_passes(serial_model);
+
+    fold_time_ms(model, true);
+    fold_time_ms(serial_model, false);
+
+    ASSERT_EQ(count_ops_of_type<ov::op::v0::Constant>(model), 3);
+    expect_same_results(model, serial_model);
+    EXPECT_EQ(get_result_constant(model)->get_friendly_name(), "transpose_0");
+    // the first u4 element of the second chain is the high half of the byte 0x01: (0 - 8) * 1.5
+    EXPECT_EQ(get_result_constant_data<float>(model, 1)[0], -12.0f);
+}
+
+TEST(constant_folding, big_convert_is_folded_lazily) {
+    const Shape shape{512, 1024};
+    std::vector<ov::float16> values(shape_size(shape));
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = ov::float16(static_cast<float>(i % 1000) / 4);
+    auto weights = op::v0::Constant::create(element::f16, shape, values);
+    auto convert = std::make_shared<op::v0::Convert>(weights, element::f32);
+    convert->set_friendly_name("convert");
+    auto model = std::make_shared<Model>(convert, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(model);
+
+    auto folded = get_result_constant(model);
+    ASSERT_TRUE(folded);
+    EXPECT_EQ(folded->get_friendly_name(), "convert");
+    // the weights are converted only once the data is read
+    ASSERT_TRUE(folded->is_lazy());
+    EXPECT_EQ(folded->get_lazy_source(), weights);
+    const auto data = folded->get_vector<float>();
+    EXPECT_FALSE(folded->is_lazy());
+    for (size_t i = 0; i < data.size(); i++)
+        ASSERT_EQ(data[i], static_cast<float>(values[i])) << i;
+}
+
+// The model has about 2 GB of folded constants, run with --gtest_also_run_disabled_tests
+TEST(benchmark, DISABLED_constant_folding_big_constants) {
+    auto model = make_decompression_model(8, Shape{8192, 8192});
+    auto serial_model = model->clone();
+
+    const auto serial_ms = fold_time_ms(serial_model, false);
+    const auto parallel_ms = fold_time_ms(model, true);
+
+    std::cout << "Constant folding of " << ov::shape_size(Shape{8192, 8192}) * 8 * sizeof(float) / (1 << 20)
+              << " MB of decompressed weights, ms: serial " << serial_ms << ", parallel ("
+              << parallel_get_max_threads() << " threads) " << parallel_ms << "\n";
+    expect_same_results(model, serial_model);
+}
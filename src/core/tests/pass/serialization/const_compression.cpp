@@ -213,3 +213,44 @@ TEST_F(SerializationConstantCompressionTest, IdenticalConstantsDifferentTypesI32
 
     ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(int32_t));
 }
+
+TEST_F(SerializationConstantCompressionTest, NonIdenticalConstantsWeakHashCollision) {
+    constexpr int unique_const_count = 2;
+    const ov::Shape shape{2};
+
+    // the arrays had the same hash before the serializer switched to the content hash
+    auto A = ov::opset8::Constant::create(ov::element::u8, shape, {2, 2});
+    auto B = ov::opset8::Constant::create(ov::element::u8, shape, {0, 128});
+
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{A, B}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(model);
+
+    std::ifstream xml_1(m_out_xml_path_1, std::ios::binary);
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(uint8_t));
+}
+
+TEST_F(SerializationConstantCompressionTest, IdenticalBigConstants) {
+    constexpr int unique_const_count = 2;
+    // bigger than the block of the parallel hash
+    const ov::Shape shape{3, 1 << 20};
+
+    std::vector<uint8_t> data(ov::shape_size(shape));
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<uint8_t>(i * 31);
+    auto A = std::make_shared<ov::opset8::Constant>(ov::element::u8, shape, data.data());
+    auto B = std::make_shared<ov::opset8::Constant>(ov::element::u8, shape, data.data());
+    data.back() ^= 1;
+    auto C = std::make_shared<ov::opset8::Constant>(ov::element::u8, shape, data.data());
+
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{A, B, C}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(model);
+
+    std::ifstream xml_1(m_out_xml_path_1, std::ios::binary);
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(uint8_t));
+}
@@ -12,6 +12,7 @@
 #include "ngraph/opsets/opset1.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
+#include "openvino/core/parallel.hpp"
 #include "rt_info_deserializer.hpp"
 #include "transformations/rt_info/attributes.hpp"
 #include "utils.hpp"
@@ -19,6 +20,25 @@
 
 using namespace ov;
 
+namespace {
+/// \brief Runs the function for the indices in parallel and rethrows the exception of the first failed index,
+/// so the error doesn't depend on the scheduling
+void run_in_parallel(size_t count, const std::function<void(size_t)>& func) {
+    std::vector<std::exception_ptr> exceptions(count);
+    ov::parallel_for(count, [&](size_t i) {
+        try {
+            func(i);
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+    });
+    for (const auto& exception : exceptions) {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+}
+}  // namespace
+
 XmlDeserializer::IoMap XmlDeserializer::updated_io_map(const pugi::xml_node& node, const pugi::xml_node& body_node) {
     if (body_node.empty()) {
         IE_THROW() << "Missing body part.";
@@ -422,21 +442,30 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         GenericLayerParams params;
     };
 
-    std::map<size_t /*layer-id*/, NodeParams> params;
+    std::unordered_map<size_t /*layer-id*/, NodeParams> params;
 
     std::vector<size_t /*layer-id*/> outputs;
     std::unordered_set<std::string> opName;
 
     std::vector<size_t> order;
-    std::set<size_t> dfs_used_nodes;
-    std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
+    std::unordered_set<size_t> dfs_used_nodes;
+    std::unordered_map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
+
+    // The generic parameters of the layers are parsed in parallel, the DOM is only read there
+    std::vector<pugi::xml_node> layer_nodes;
+    FOREACH_CHILD (node, root.child("layers"), "layer") { layer_nodes.push_back(node); }
+    std::vector<GenericLayerParams> layer_params(layer_nodes.size());
+    run_in_parallel(layer_nodes.size(), [&](size_t i) {
+        layer_params[i] = parse_generic_params(layer_nodes[i]);
+    });
+
     // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parse_generic_params(node);
+    params.reserve(layer_nodes.size());
+    for (size_t i = 0; i < layer_nodes.size(); i++) {
+        auto& node_param = layer_params[i];
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
@@ -447,6 +476,8 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
             order.push_back(node_param.layerId);
             edges[node_param.layerId] = {};
         }
+        const auto layer_id = node_param.layerId;
+        params[layer_id] = {layer_nodes[i], std::move(node_param)};
     }
 
     // Read all edges and store them for further usage
@@ -458,24 +489,58 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         edges[toLayer].push_back({fromLayer, fromPort, toPort});
     }
 
-    // Run DFS starting from outputs to get nodes topological order
-    std::function<void(size_t)> dfs = [&edges, &order, &dfs_used_nodes, &dfs](const size_t id) {
-        if (dfs_used_nodes.count(id))
-            return;
-        dfs_used_nodes.insert(id);
-        for (auto& edge : edges[id]) {
-            dfs(edge.fromLayerId);
+    // Run DFS starting from outputs to get nodes topological order.
+    // The DFS uses the explicit stack, so the long chains of layers don't overflow the call stack.
+    std::vector<std::pair<size_t /*layer-id*/, size_t /*next edge*/>> dfs_stack;
+    for (const auto output : outputs) {
+        if (!dfs_used_nodes.insert(output).second)
+            continue;
+        dfs_stack.emplace_back(output, 0);
+        while (!dfs_stack.empty()) {
+            const auto id = dfs_stack.back().first;
+            const auto& layer_edges = edges[id];
+            auto& next_edge = dfs_stack.back().second;
+            if (next_edge < layer_edges.size()) {
+                const auto from_id = layer_edges[next_edge++].fromLayerId;
+                if (dfs_used_nodes.insert(from_id).second)
+                    dfs_stack.emplace_back(from_id, 0);
+            } else {
+                order.push_back(id);
+                dfs_stack.pop_back();
+            }
         }
-        order.push_back(id);
-    };
-    std::for_each(outputs.begin(), outputs.end(), dfs);
+    }
 
     // OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
 
     FunctionNodes func_nodes;
-    std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+    std::unordered_map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
+    // The constants don't depend on the other layers, so they are created in parallel before the graph is connected.
+    // The other nodes are attached to the outputs of their inputs on the creation, so they are created one by one.
+    std::vector<size_t> independent_layers;
+    for (const auto layer_id : order) {
+        const auto params_it = params.find(layer_id);
+        const auto edges_it = edges.find(layer_id);
+        if (params_it == params.end() || edges_it == edges.end() || !edges_it->second.empty())
+            continue;
+        const auto& generic_params = params_it->second.params;
+        // the custom extensions are not required to be thread-safe
+        if (generic_params.type == "Const" &&
+            !m_extensions.count(ov::DiscreteTypeInfo("Constant", generic_params.version.c_str()))) {
+            independent_layers.push_back(layer_id);
+        }
+    }
+    std::vector<std::shared_ptr<ngraph::Node>> independent_nodes(independent_layers.size());
+    run_in_parallel(independent_layers.size(), [&](size_t i) {
+        const auto& p = params.at(independent_layers[i]);
+        independent_nodes[i] = create_node({}, p.xml, weights, p.params);
+    });
+    for (size_t i = 0; i < independent_layers.size(); i++) {
+        id_to_node[independent_layers[i]] = std::move(independent_nodes[i]);
+    }
+
     //  Following topological order create nGraph operations
     for (auto& layer_id : order) {
         auto& p = params[layer_id];
@@ -484,10 +549,11 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
             continue;
         ngraph::OutputVector inputs(edgeIt->second.size());
         for (auto& e : edgeIt->second) {
-            auto input_node = id_to_node[e.fromLayerId];
-            if (!input_node) {
+            const auto input_it = id_to_node.find(e.fromLayerId);
+            if (input_it == id_to_node.end() || !input_it->second) {
                 IE_THROW() << "Attempt to access node " << e.fromLayerId << " that not in graph.";
             }
+            const auto& input_node = input_it->second;
             auto& p_output = params[e.fromLayerId].params;
             size_t const realInputPortId = p.params.get_real_input_port_id(e.toPortId);
             if (realInputPortId >= inputs.size())
@@ -496,8 +562,9 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
             inputs[realInputPortId] = input_node->output(p_output.get_real_output_port_id(e.fromPortId));
         }
 
-        auto node = create_node(inputs, p.xml, weights, p.params);
-        id_to_node[layer_id] = node;
+        auto& node = id_to_node[layer_id];
+        if (!node)
+            node = create_node(inputs, p.xml, weights, p.params);
 
         // Check that output shape after OpenVINO node validation the same as in IR
         // because IR always right!
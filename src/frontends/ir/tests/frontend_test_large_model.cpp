@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+#include "frontend_test.hpp"
+#include "openvino/op/constant.hpp"
+
+namespace {
+constexpr size_t channels = 16;
+
+void write_port(std::ostringstream& xml, size_t id, const char* precision) {
+    xml << "<port id=\"" << id << "\"";
+    if (precision)
+        xml << " precision=\"" << precision << "\"";
+    xml << "><dim>1</dim><dim>" << channels << "</dim></port>";
+}
+
+/**
+ * @brief Generates the IR of the chain of `blocks` Add layers, every Add has its own constant, so the model has
+ * about 2 * blocks operations. All the constants share the same weights.
+ */
+std::string make_chain_ir(size_t blocks) {
+    std::ostringstream xml;
+    xml << "<net name=\"chain\" version=\"11\"><layers>";
+    xml << "<layer id=\"0\" name=\"input\" type=\"Parameter\" version=\"opset1\">"
+        << "<data element_type=\"f32\" shape=\"1," << channels << "\"/><output>";
+    write_port(xml, 0, "FP32");
+    xml << "</output></layer>";
+    for (size_t i = 0; i < blocks; i++) {
+        const size_t const_id = 2 * i + 1, add_id = 2 * i + 2;
+        xml << "<layer id=\"" << const_id << "\" name=\"const_" << i << "\" type=\"Const\" version=\"opset1\">"
+            << "<data element_type=\"f32\" shape=\"1," << channels << "\" offset=\"0\" size=\""
+            << channels * sizeof(float) << "\"/><output>";
+        write_port(xml, 0, "FP32");
+        xml << "</output></layer>";
+        xml << "<layer id=\"" << add_id << "\" name=\"add_" << i << "\" type=\"Add\" version=\"opset1\">"
+            << "<data auto_broadcast=\"numpy\"/><input>";
+        write_port(xml, 0, nullptr);
+        write_port(xml, 1, nullptr);
+        xml << "</input><output>";
+        write_port(xml, 2, "FP32");
+        xml << "</output></layer>";
+    }
+    xml << "<layer id=\"" << 2 * blocks + 1 << "\" name=\"output\" type=\"Result\" version=\"opset1\"><input>";
+    write_port(xml, 0, nullptr);
+    xml << "</input></layer></layers><edges>";
+    for (size_t i = 0; i < blocks; i++) {
+        xml << "<edge from-layer=\"" << (i == 0 ? 0 : 2 * i) << "\" from-port=\"" << (i == 0 ? 0 : 2)
+            << "\" to-layer=\"" << 2 * i + 2 << "\" to-port=\"0\"/>";
+        xml << "<edge from-layer=\"" << 2 * i + 1 << "\" from-port=\"0\" to-layer=\"" << 2 * i + 2
+            << "\" to-port=\"1\"/>";
+    }
+    xml << "<edge from-layer=\"" << 2 * blocks << "\" from-port=\"2\" to-layer=\"" << 2 * blocks + 1
+        << "\" to-port=\"0\"/>";
+    xml << "</edges></net>";
+    return xml.str();
+}
+
+ov::Tensor make_chain_weights() {
+    ov::Tensor weights(ov::element::u8, ov::Shape{channels * sizeof(float)});
+    auto* data = reinterpret_cast<float*>(weights.data());
+    for (size_t i = 0; i < channels; i++)
+        data[i] = static_cast<float>(i);
+    return weights;
+}
+}  // namespace
+
+TEST(IRFrontendLargeModelTests, long_chain_model_reading) {
+    // the chain is deep enough to overflow the stack of the recursive topological sort
+    const size_t blocks = 50000;
+    ov::Core core;
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = core.read_model(make_chain_ir(blocks), make_chain_weights()));
+    ASSERT_TRUE(!!model);
+
+    EXPECT_EQ(model->get_ops().size(), 2 * blocks + 2);
+    auto node = model->get_results()[0]->get_input_node_shared_ptr(0);
+    for (size_t i = blocks; i > 0; i--) {
+        ASSERT_EQ(node->get_friendly_name(), "add_" + std::to_string(i - 1));
+        auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node->get_input_node_shared_ptr(1));
+        ASSERT_TRUE(constant);
+        ASSERT_EQ(constant->get_friendly_name(), "const_" + std::to_string(i - 1));
+        ASSERT_EQ(constant->get_vector<float>()[channels - 1], static_cast<float>(channels - 1));
+        node = node->get_input_node_shared_ptr(0);
+    }
+    EXPECT_EQ(node, model->get_parameters()[0]);
+}
+
+// Measures read_model of the synthetic IR with 200k+ operations, run with --gtest_also_run_disabled_tests
+TEST(IRFrontendLargeModelTests, DISABLED_read_model_benchmark) {
+    const size_t blocks = 100000;
+    const auto xml = make_chain_ir(blocks);
+    const auto weights = make_chain_weights();
+    ov::Core core;
+
+    const size_t iterations = 5;
+    double best_ms = 0;
+    for (size_t i = 0; i < iterations; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        auto model = core.read_model(xml, weights);
+        const auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        ASSERT_EQ(model->get_ops().size(), 2 * blocks + 2);
+        best_ms = i == 0 ? ms : std::min(best_ms, ms);
+    }
+    std::cout << "read_model of " << 2 * blocks + 2 << " operations (" << xml.size() / (1 << 20)
+              << " MB of XML), best of " << iterations << ": " << best_ms << " ms\n";
+}
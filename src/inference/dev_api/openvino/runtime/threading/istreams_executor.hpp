@@ -117,6 +117,8 @@ public:
         std::vector<std::vector<int>> _stream_processor_ids;
         bool _cpu_reservation = false;
         bool _streams_changed = false;
+        bool _work_stealing = false;  //!< Every stream thread has own tasks queue and steals the tasks of other
+                                      //!< streams (the NUMA node neighbours first) instead of one shared queue
 
         /**
          * @brief      A constructor with arguments
@@ -17,6 +17,7 @@
 #include "file_utils.h"
 #include "itt.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "openvino/core/hash_util.hpp"
 #include "openvino/pass/manager.hpp"
 #include "transformations/fix_rt_info.hpp"
 #include "transformations/hash.hpp"
@@ -170,16 +171,7 @@ std::string ModelCache::compute_hash(const std::string& modelStr,
     // tensor data
     if (tensor) {
         seed = hash_combine(seed, tensor.get_size());
-
-        auto ptr = static_cast<size_t*>(tensor.data());
-        size_t size = tensor.get_size() / sizeof(size_t);
-        for (size_t i = 0; i < size; i++)
-            seed = hash_combine(seed, ptr[i]);
-        auto size_done = size * sizeof(size_t);
-        auto ptr_left = static_cast<uint8_t*>(tensor.data()) + size_done;
-        size_t size_left = tensor.get_size() - size_done;
-        for (size_t i = 0; i < size_left; i++)
-            seed = hash_combine(seed, ptr_left[i]);
+        seed = hash_combine(seed, ov::util::hash_data(tensor.data(), tensor.get_size()));
     }
 
     // compile options
@@ -4,7 +4,9 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -24,6 +26,11 @@ namespace ov {
 namespace threading {
 // maybe there are two CPUStreamsExecutors in the same thread.
 thread_local std::map<void*, std::shared_ptr<std::thread::id>> t_stream_count_map;
+// the executor and the tasks queue of the current stream thread (work stealing mode only)
+thread_local const void* t_worker_executor = nullptr;
+thread_local size_t t_worker_queue = 0;
+// the number of the attempts to find a task before an idle stream thread sleeps on the condition variable
+constexpr int work_stealing_spin_count = 128;
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
@@ -386,6 +393,14 @@ struct CPUStreamsExecutor::Impl {
         std::mutex _stream_map_mutex;
     };
 
+    // the tasks queue of a stream thread in the work stealing mode
+    struct WorkerQueue {
+        std::mutex _mutex;
+        std::deque<Task> _tasks;
+        std::atomic<size_t> _size{0};
+        std::vector<size_t> _victims;  // the queues to steal the tasks from, the same NUMA node first
+    };
+
     explicit Impl(const Config& config)
         : _config{config},
           _streams(
@@ -432,9 +447,16 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        if (_config._work_stealing && _config._streams > 0) {
+            InitWorkerQueues();
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                if (!_workerQueues.empty()) {
+                    WorkStealingLoop(streamId);
+                    return;
+                }
                 for (bool stopped = false; !stopped;) {
                     Task task;
                     {
@@ -456,7 +478,127 @@ struct CPUStreamsExecutor::Impl {
         _streams.set_thread_ids_map(_threads);
     }
 
+    void InitWorkerQueues() {
+        const size_t numQueues = _config._streams;
+        // the same distribution of the streams over the NUMA nodes as in the Stream constructor
+        const size_t streamsPerNode = (numQueues + _usedNumaNodes.size() - 1) / _usedNumaNodes.size();
+        auto numaNode = [&](size_t queueIdx) {
+            return _usedNumaNodes.at(queueIdx / streamsPerNode);
+        };
+        for (size_t i = 0; i < numQueues; i++) {
+            _workerQueues.emplace_back(new WorkerQueue);
+        }
+        for (size_t i = 0; i < numQueues; i++) {
+            auto& victims = _workerQueues[i]->_victims;
+            std::vector<size_t> remote;
+            for (size_t j = 1; j < numQueues; j++) {
+                const size_t victim = (i + j) % numQueues;
+                if (numaNode(victim) == numaNode(i)) {
+                    victims.push_back(victim);
+                } else {
+                    remote.push_back(victim);
+                }
+            }
+            victims.insert(victims.end(), remote.begin(), remote.end());
+        }
+    }
+
+    bool PopTask(WorkerQueue& queue, Task& task, bool steal) {
+        if (0 == queue._size) {
+            return false;
+        }
+        // the busy queue is skipped by the thief, there are other queues to look into
+        std::unique_lock<std::mutex> lock(queue._mutex, std::defer_lock);
+        if (steal) {
+            if (!lock.try_lock()) {
+                return false;
+            }
+        } else {
+            lock.lock();
+        }
+        if (queue._tasks.empty()) {
+            return false;
+        }
+        // the oldest task is taken by both the owner and the thief to keep the tasks order close to FIFO
+        task = std::move(queue._tasks.front());
+        queue._tasks.pop_front();
+        queue._size--;
+        _numQueuedTasks--;
+        return true;
+    }
+
+    // the busy queues are skipped by the thief unless all the queues are drained before the exit
+    bool GetTask(size_t queueIdx, Task& task, bool drain) {
+        auto& queue = *_workerQueues[queueIdx];
+        if (PopTask(queue, task, false)) {
+            return true;
+        }
+        for (auto victim : queue._victims) {
+            if (PopTask(*_workerQueues[victim], task, !drain)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void WorkStealingLoop(size_t queueIdx) {
+        t_worker_executor = this;
+        t_worker_queue = queueIdx;
+        for (;;) {
+            Task task;
+            const bool stopped = _isStopped;
+            if (GetTask(queueIdx, task, stopped)) {
+                Execute(task, *(_streams.local()));
+                continue;
+            }
+            // the tasks queued before the stop are executed as the ones of the common queue are
+            if (stopped) {
+                if (0 == _numQueuedTasks) {
+                    break;
+                }
+                std::this_thread::yield();
+                continue;
+            }
+            // the next task usually comes soon under the high load, so the thread spins a bit before sleeping
+            for (int i = 0; i < work_stealing_spin_count && 0 == _numQueuedTasks && !_isStopped; i++) {
+                std::this_thread::yield();
+            }
+            if (_numQueuedTasks > 0) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(_mutex);
+            _numSleepingWorkers++;
+            _queueCondVar.wait(lock, [&] {
+                return _numQueuedTasks > 0 || _isStopped;
+            });
+            _numSleepingWorkers--;
+        }
+    }
+
+    void EnqueueToWorker(Task task) {
+        // the tasks created by a stream thread (e.g. the next stage of the pipeline) are put into its own queue
+        // to reuse the data in the caches, the rest are distributed over the queues in the round-robin fashion
+        const size_t queueIdx =
+            t_worker_executor == this ? t_worker_queue : _nextWorkerQueue++ % _workerQueues.size();
+        auto& queue = *_workerQueues[queueIdx];
+        {
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            queue._tasks.emplace_back(std::move(task));
+            queue._size++;
+        }
+        _numQueuedTasks++;
+        if (_numSleepingWorkers > 0) {
+            // the worker increments the counter under the mutex, so it waits on the condition variable already
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _queueCondVar.notify_one();
+        }
+    }
+
     void Enqueue(Task task) {
+        if (!_workerQueues.empty()) {
+            EnqueueToWorker(std::move(task));
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
@@ -501,7 +643,11 @@ struct CPUStreamsExecutor::Impl {
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
-    bool _isStopped = false;
+    std::atomic<bool> _isStopped{false};
+    std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+    std::atomic<size_t> _nextWorkerQueue{0};
+    std::atomic<size_t> _numQueuedTasks{0};
+    std::atomic<int> _numSleepingWorkers{0};
     std::vector<int> _usedNumaNodes;
     CustomThreadLocal _streams;
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
@@ -5,6 +5,8 @@
 #include <gtest/gtest.h>
 #include <ie_system_conf.h>
 
+#include <algorithm>
+#include <chrono>
 #include <future>
 #include <ie_parallel.hpp>
 #include <thread>
@@ -244,6 +246,16 @@ static auto Executors = ::testing::Values(
                                      threads / streams,
                                      IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams,
+                                        threads / streams,
+                                        IStreamsExecutor::ThreadBindingType::NONE};
+        config._work_stealing = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     });
@@ -277,6 +289,79 @@ static auto AsyncExecutors = ::testing::Values(
                                      streams,
                                      threads / streams,
                                      IStreamsExecutor::ThreadBindingType::NONE});
+    },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams,
+                                        threads / streams,
+                                        IStreamsExecutor::ThreadBindingType::NONE};
+        config._work_stealing = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+TEST(CPUStreamsExecutorTests, workStealingExecutorRunsQueuedTasksBeforeDestruction) {
+    constexpr int num_tasks = 200;
+    std::atomic_int done = {0};
+    {
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 2, 1, IStreamsExecutor::ThreadBindingType::NONE};
+        config._work_stealing = true;
+        CPUStreamsExecutor executor(config);
+        for (int i = 0; i < num_tasks; i++) {
+            executor.run([&done] {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                ++done;
+            });
+        }
+        // the executor is destroyed while most of the tasks are still queued
+    }
+    ASSERT_EQ(num_tasks, done);
+}
+
+// measures the latency from the run() call till the task start and the throughput of the tiny tasks
+// submitted by several threads for the shared queue and the work stealing modes, is run manually
+TEST(benchmark, DISABLED_cpu_streams_executor_queue) {
+    constexpr size_t num_tasks = 100000;
+    constexpr size_t num_producers = 4;
+    using clock = std::chrono::high_resolution_clock;
+
+    for (bool work_stealing : {false, true}) {
+        const auto streams = getNumberOfCPUCores();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE};
+        config._work_stealing = work_stealing;
+        auto executor = std::make_shared<CPUStreamsExecutor>(config);
+
+        std::vector<clock::time_point> enqueued(num_tasks);
+        std::vector<double> latencies(num_tasks);
+        std::atomic<size_t> done{0};
+        std::promise<void> all_done;
+
+        const auto start = clock::now();
+        std::vector<std::thread> producers;
+        for (size_t p = 0; p < num_producers; p++) {
+            producers.emplace_back([&, p] {
+                for (size_t i = p; i < num_tasks; i += num_producers) {
+                    enqueued[i] = clock::now();
+                    executor->run([&, i] {
+                        latencies[i] = std::chrono::duration<double, std::micro>(clock::now() - enqueued[i]).count();
+                        if (++done == num_tasks)
+                            all_done.set_value();
+                    });
+                }
+            });
+        }
+        for (auto& producer : producers)
+            producer.join();
+        all_done.get_future().wait();
+        const auto duration = std::chrono::duration<double>(clock::now() - start).count();
+
+        std::sort(latencies.begin(), latencies.end());
+        std::cout << (work_stealing ? "work stealing" : "shared queue") << " (" << streams
+                  << " streams): " << static_cast<size_t>(num_tasks / duration) << " tasks/s, enqueue to start latency"
+                  << " p50 " << latencies[num_tasks / 2] << " us, p99 " << latencies[num_tasks * 99 / 100] << " us"
+                  << std::endl;
+    }
+}
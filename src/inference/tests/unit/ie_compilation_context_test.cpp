@@ -301,6 +301,29 @@ TEST(NetworkContext, HashWithDifferentResults) {
     ASSERT_EQ(ModelCache::compute_hash(net2, {}), ModelCache::compute_hash(net3, {}));
 }
 
+TEST(NetworkContext, HashWithConstantData) {
+    auto net1 = create_simple_function();
+    auto net2 = create_simple_function();
+    auto net3 = create_simple_function();
+    std::shared_ptr<ov::op::v0::Constant> constant;
+    for (const auto& op : net3->get_ops()) {
+        if (op->get_friendly_name() == "mul_constant")
+            constant = ov::as_type_ptr<ov::op::v0::Constant>(op);
+    }
+    ASSERT_TRUE(constant);
+    auto new_constant = ngraph::opset6::Constant::create(constant->get_element_type(), constant->get_shape(), {5});
+    new_constant->set_friendly_name(constant->get_friendly_name());
+    new_constant->get_output_tensor(0).set_names(constant->get_output_tensor(0).get_names());
+    ov::replace_node(constant, new_constant);
+
+    const auto hash1 = ModelCache::compute_hash(net1, {});
+    ASSERT_EQ(hash1, ModelCache::compute_hash(net2, {}));
+    ASSERT_NE(hash1, ModelCache::compute_hash(net3, {}));
+    // the hash of the constant data is cached in the constant and reused by the following calculations
+    ASSERT_EQ(new_constant->get_rt_info().count("ConstantDataHash"), 1u);
+    ASSERT_EQ(hash1, ModelCache::compute_hash(net1, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext, HashOfSameMultiThreading) {
     auto net1 = create_simple_function();
@@ -23,6 +23,11 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
             std::pair<AsyncInferRequest*, ov::threading::Task> t;
             t.first = _this;
             t.second = std::move(task);
+            // the user tensors are copied to the batched tensor by the submitting thread, so the copies of the
+            // different requests go in parallel and overlap with collecting the batch. It is safe as the batched
+            // request can not be running: all its slots (including this one) must be submitted for the execution
+            _this->m_sync_request->copy_inputs_if_needed();
+            CompiledModel::on_request_arrival(*workerInferRequest);
             workerInferRequest->_tasks.push(t);
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = static_cast<int>(workerInferRequest->_tasks.size());
@@ -39,6 +44,7 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                        if (batchReq->_exception_ptr)  // when the batchN execution failed
                            std::rethrow_exception(batchReq->_exception_ptr);
                        // in the case of non-batched execution the tensors were set explicitly
+                       // and the outputs of the partial batch are copied on its completion
                        if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED ==
                            this->m_sync_request->m_batched_request_status) {
                            this->m_sync_request->copy_outputs_if_needed();
@@ -48,18 +54,25 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
 
 std::vector<ov::ProfilingInfo> AsyncInferRequest::get_profiling_info() const {
     check_state();
-    if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+    switch (m_sync_request->m_batched_request_status) {
+    case SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED:
+    case SyncInferRequest::eExecutionFlavor::SUB_BATCH_EXECUTED:
+        // the info of the (sub-)batched request which executed this one
         return m_sync_request->get_profiling_info();
-    else
+    default:
         return m_request_without_batch->get_profiling_info();
+    }
 }
 
 std::vector<ov::SoPtr<ov::IVariableState>> AsyncInferRequest::query_state() const {
     check_state();
-    if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+    switch (m_sync_request->m_batched_request_status) {
+    case SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED:
+    case SyncInferRequest::eExecutionFlavor::SUB_BATCH_EXECUTED:
         return m_sync_request->query_state();
-    else
+    default:
         return m_request_without_batch->query_state();
+    }
 }
 
 void AsyncInferRequest::infer_thread_unsafe() {
@@ -5,10 +5,27 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "compiled_model.hpp"
 
+#include <cmath>
+#include <future>
+
 #include "async_infer_request.hpp"
 
 namespace ov {
 namespace autobatch_plugin {
+namespace {
+// weight of the new sample in the exponential moving averages of the adaptive timeout statistics
+constexpr double sample_weight = 0.1;
+
+void update_average(std::atomic<double>& average, double sample) {
+    const double current = average.load();
+    average = current == 0.0 ? sample : current + sample_weight * (sample - current);
+}
+
+double elapsed_ms(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
 CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              const ov::AnyMap& config,
@@ -17,18 +34,23 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::set<std::string>& batched_outputs,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                             const ov::SoPtr<ov::IRemoteContext>& context)
+                             const ov::SoPtr<ov::IRemoteContext>& context,
+                             const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>>& compiled_models_with_sub_batch)
     : ov::ICompiledModel(model, plugin, context),
       m_config(config),
       m_batched_inputs(batched_inputs),
       m_batched_outputs(batched_outputs),
       m_compiled_model_with_batch(compiled_model_with_batch),
-      m_compiled_model_without_batch(compiled_model_without_batch) {
+      m_compiled_model_without_batch(compiled_model_without_batch),
+      m_compiled_models_with_sub_batch(compiled_models_with_sub_batch) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
     m_device_info = device_info;
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    m_current_time_out = m_time_out.load();
+    auto adaptive = config.find(adaptive_timeout.name());
+    m_adaptive_time_out = adaptive != config.end() && adaptive->second.as<bool>();
 }
 
 CompiledModel::~CompiledModel() {
@@ -64,10 +86,15 @@ CompiledModel::GetWorkerInferRequest() const {
             workerRequestPtr->_infer_request_batched._so = m_compiled_model_with_batch._so;
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
+        for (auto it = m_compiled_models_with_sub_batch.rbegin(); it != m_compiled_models_with_sub_batch.rend(); ++it) {
+            ov::SoPtr<ov::IAsyncInferRequest> request = {it->second->create_infer_request(), it->second._so};
+            workerRequestPtr->_sub_batch_requests.push_back({request, static_cast<int>(it->first)});
+        }
         workerRequestPtr->_infer_request_batched->set_callback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                update_average(workerRequestPtr->_batch_latency_ms, elapsed_ms(workerRequestPtr->_batch_start));
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
@@ -82,7 +109,7 @@ CompiledModel::GetWorkerInferRequest() const {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    status = workerRequestPtr->_cond.wait_for(lock, get_timeout(*workerRequestPtr));
                 }
                 if (m_terminate) {
                     break;
@@ -95,35 +122,21 @@ CompiledModel::GetWorkerInferRequest() const {
                         for (int n = 0; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             workerRequestPtr->_completion_tasks[n] = std::move(t.second);
-                            t.first->m_sync_request->copy_inputs_if_needed();
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        m_num_full_batches++;
+                        workerRequestPtr->_batch_start = std::chrono::steady_clock::now();
                         workerRequestPtr->_infer_request_batched->start_async();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
-                        std::atomic<int> arrived = {0};
-                        std::promise<void> all_completed;
-                        auto all_completed_future = all_completed.get_future();
+                        // timeout to collect the batch is over, popping all tasks collected by the moment of the
+                        // time-out and execute them with the smaller batches
+                        m_num_timeouts++;
+                        std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks(sz);
                         for (int n = 0; n < sz; n++) {
-                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->m_request_without_batch->set_callback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
-                                    if (p)
-                                        t.first->m_sync_request->m_exception_ptr = p;
-                                    t.second();
-                                    if (sz == ++arrived) {
-                                        all_completed.set_value();
-                                    }
-                                });
-                            t.first->m_sync_request->m_batched_request_status =
-                                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
-                            t.first->m_sync_request->set_tensors_to_another_request(t.first->m_request_without_batch);
-                            t.first->m_request_without_batch->start_async();
+                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(tasks[n]));
                         }
-                        all_completed_future.get();
+                        execute_partial_batch(*workerRequestPtr, tasks);
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -133,6 +146,98 @@ CompiledModel::GetWorkerInferRequest() const {
     return {m_worker_requests.back(), static_cast<int>(batch_id)};
 }
 
+void CompiledModel::on_request_arrival(WorkerInferRequest& worker) {
+    const int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count();
+    const int64_t last = worker._last_arrival_us.exchange(now);
+    if (last)
+        update_average(worker._arrival_interval_ms, static_cast<double>(now - last) / 1000.0);
+}
+
+std::chrono::milliseconds CompiledModel::get_timeout(const WorkerInferRequest& worker) const {
+    std::uint32_t time_out = m_time_out;
+    const double arrival_interval_ms = worker._arrival_interval_ms;
+    if (m_adaptive_time_out && arrival_interval_ms > 0.0) {
+        // it makes no sense to wait less than the batch execution takes, as the device is busy anyway
+        const double expected_fill_ms = arrival_interval_ms * worker._batch_size;
+        double adaptive_ms = 0.0;
+        if (2.0 * expected_fill_ms <= time_out) {
+            // the batch is likely to be collected in time, so waiting for it with the margin
+            adaptive_ms = std::max(2.0 * expected_fill_ms, worker._batch_latency_ms.load());
+        } else {
+            // the batch would not be collected in time, so collecting only the requests arriving soon
+            adaptive_ms = std::max(2.0 * arrival_interval_ms, worker._batch_latency_ms.load());
+        }
+        time_out = std::min(time_out, static_cast<std::uint32_t>(std::max(1.0, std::ceil(adaptive_ms))));
+    }
+    m_current_time_out = time_out;
+    return std::chrono::milliseconds(time_out);
+}
+
+void CompiledModel::execute_partial_batch(
+    WorkerInferRequest& worker,
+    std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>& tasks) const {
+    const int sz = static_cast<int>(tasks.size());
+    std::atomic<int> arrived = {0};
+    std::promise<void> all_completed;
+    auto all_completed_future = all_completed.get_future();
+    auto on_completed = [sz, &arrived, &all_completed](int num) {
+        if (sz == (arrived += num)) {
+            all_completed.set_value();
+        }
+    };
+
+    // the largest fitting sub-batches first, each sub-batch request is used once
+    int n = 0;
+    for (auto& sub_batch : worker._sub_batch_requests) {
+        const int count = sub_batch._batch_size;
+        if (sz - n < count)
+            continue;
+        const int first = n;
+        n += count;
+        auto sub_batch_request = &sub_batch._infer_request;
+        for (int i = 0; i < count; i++) {
+            auto& sync_request = tasks[first + i].first->m_sync_request;
+            sync_request->copy_inputs_to_request(*sub_batch_request, i);
+            sync_request->m_sub_batch_request = *sub_batch_request;
+            sync_request->m_batched_request_status =
+                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::SUB_BATCH_EXECUTED;
+        }
+        (*sub_batch_request)
+            ->set_callback([&tasks, first, count, sub_batch_request, &on_completed](std::exception_ptr p) {
+                for (int i = 0; i < count; i++) {
+                    auto& t = tasks[first + i];
+                    if (p)
+                        t.first->m_sync_request->m_exception_ptr = p;
+                    else
+                        t.first->m_sync_request->copy_outputs_from_request(*sub_batch_request, i);
+                    t.second();
+                }
+                on_completed(count);
+            });
+        m_num_sub_batches++;
+        (*sub_batch_request)->start_async();
+    }
+
+    // the rest is executed with batch1
+    for (; n < sz; n++) {
+        auto& t = tasks[n];
+        t.first->m_request_without_batch->set_callback([&t, &on_completed](std::exception_ptr p) {
+            if (p)
+                t.first->m_sync_request->m_exception_ptr = p;
+            t.second();
+            on_completed(1);
+        });
+        t.first->m_sync_request->m_batched_request_status =
+            ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+        t.first->m_sync_request->set_tensors_to_another_request(t.first->m_request_without_batch);
+        m_num_requests_without_batch++;
+        t.first->m_request_without_batch->start_async();
+    }
+    all_completed_future.get();
+}
+
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
     if (!m_compiled_model_with_batch) {
         auto res = m_compiled_model_without_batch->create_infer_request();
@@ -208,7 +313,8 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                                             METRIC_KEY(SUPPORTED_METRICS),
                                             ov::model_name.name(),
                                             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-                                            ov::execution_devices.name()};
+                                            ov::execution_devices.name(),
+                                            statistics.name()};
         } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
             return std::vector<std::string>{ov::auto_batch_timeout.name()};
         } else if (name == ov::execution_devices) {
@@ -222,10 +328,17 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{METRIC_KEY(SUPPORTED_CONFIG_KEYS), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RO}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{statistics.name(), ov::PropertyMutability::RO}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
+        } else if (name == statistics) {
+            return decltype(statistics)::value_type{{"full_batches", m_num_full_batches.load()},
+                                                    {"partial_batches", m_num_sub_batches.load()},
+                                                    {"requests_without_batch", m_num_requests_without_batch.load()},
+                                                    {"timeouts", m_num_timeouts.load()},
+                                                    {"timeout_ms", m_current_time_out.load()}};
         } else if (name == ov::device::properties) {
             ov::AnyMap all_devices = {};
             ov::AnyMap device_properties = {};
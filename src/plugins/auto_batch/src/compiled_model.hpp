@@ -5,6 +5,8 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <thread>
 
@@ -20,9 +22,16 @@ class AsyncInferRequest;
 
 class CompiledModel : public ov::ICompiledModel {
 public:
+    struct SubBatchInferRequest {
+        ov::SoPtr<ov::IAsyncInferRequest> _infer_request;
+        int _batch_size;
+    };
+
     struct WorkerInferRequest {
         ov::SoPtr<ov::IAsyncInferRequest> _infer_request_batched;
         int _batch_size;
+        // requests with the smaller batch sizes (in the descending order) to execute the partial batches
+        std::vector<SubBatchInferRequest> _sub_batch_requests;
         ov::threading::ThreadSafeQueueWithSize<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
             _tasks;
         std::vector<ov::threading::Task> _completion_tasks;
@@ -30,6 +39,11 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
+        // the statistics for the adaptive timeout
+        std::atomic<int64_t> _last_arrival_us = {0};
+        std::atomic<double> _arrival_interval_ms = {0.0};
+        std::atomic<double> _batch_latency_ms = {0.0};
+        std::chrono::steady_clock::time_point _batch_start;
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -40,7 +54,8 @@ public:
                   const std::set<std::string>& batched_outputs,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                  const ov::SoPtr<ov::IRemoteContext>& context);
+                  const ov::SoPtr<ov::IRemoteContext>& context,
+                  const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>>& compiled_models_with_sub_batch = {});
 
     void set_property(const ov::AnyMap& properties) override;
 
@@ -54,6 +69,9 @@ public:
 
     virtual ~CompiledModel();
 
+    // updates the arrival rate statistics of the worker, called on every request submission
+    static void on_request_arrival(WorkerInferRequest& worker);
+
 protected:
     std::shared_ptr<ov::ISyncInferRequest> create_sync_infer_request() const override;
     static unsigned int ParseTimeoutValue(const std::string&);
@@ -63,17 +81,30 @@ protected:
 
     std::pair<std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>, int> GetWorkerInferRequest()
         const;
+    std::chrono::milliseconds get_timeout(const WorkerInferRequest& worker) const;
+    void execute_partial_batch(WorkerInferRequest& worker,
+                               std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>&
+                                   tasks) const;
     mutable std::vector<std::shared_ptr<WorkerInferRequest>> m_worker_requests;
     mutable std::mutex m_worker_requests_mutex;
 
     mutable std::atomic_size_t m_num_requests_created = {0};
     std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    bool m_adaptive_time_out = false;
+
+    // the batching statistics
+    mutable std::atomic_uint64_t m_num_full_batches = {0};
+    mutable std::atomic_uint64_t m_num_sub_batches = {0};
+    mutable std::atomic_uint64_t m_num_requests_without_batch = {0};
+    mutable std::atomic_uint64_t m_num_timeouts = {0};
+    mutable std::atomic<std::uint32_t> m_current_time_out = {0};  // in ms
 
     const std::set<std::string> m_batched_inputs;
     const std::set<std::string> m_batched_outputs;
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
+    std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>> m_compiled_models_with_sub_batch;  // by the batch size
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
@@ -26,7 +26,9 @@ OPENVINO_SUPPRESS_DEPRECATED_START
 std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
                                                  ov::device::priorities.name(),
                                                  ov::auto_batch_timeout.name(),
-                                                 ov::cache_dir.name()};
+                                                 ov::cache_dir.name(),
+                                                 partial_batching.name(),
+                                                 adaptive_timeout.name()};
 OPENVINO_SUPPRESS_DEPRECATED_END
 
 inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_config) {
@@ -284,52 +286,69 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), c.first))
             compiled_model_config.insert(c);
     }
-    ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
-    auto reshaped = model->clone();
-    if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
-        try {
-            auto inputs = reshaped->inputs();
-            std::map<ov::Output<ov::Node>, ov::PartialShape> partial_shapes;
-            for (auto& input : inputs) {
-                auto input_shape = input.get_shape();
-                if (batched_inputs.find(ov::op::util::get_ie_output_name(input)) != batched_inputs.end()) {
-                    input_shape[0] = meta_device.device_batch_size;
-                }
-                partial_shapes.insert({input, ov::PartialShape(input_shape)});
+    auto compile_with_batch = [&](uint32_t batch_size) {
+        auto reshaped = model->clone();
+        auto inputs = reshaped->inputs();
+        std::map<ov::Output<ov::Node>, ov::PartialShape> partial_shapes;
+        for (auto& input : inputs) {
+            auto input_shape = input.get_shape();
+            if (batched_inputs.find(ov::op::util::get_ie_output_name(input)) != batched_inputs.end()) {
+                input_shape[0] = batch_size;
             }
+            partial_shapes.insert({input, ov::PartialShape(input_shape)});
+        }
+
+        reshaped->reshape(partial_shapes);
 
-            reshaped->reshape(partial_shapes);
-
-            OPENVINO_SUPPRESS_DEPRECATED_START
-            for (auto&& input : reshaped->inputs()) {
-                auto& rt_info = input.get_rt_info();
-                auto it = rt_info.find("ie_legacy_td");
-                if (it != rt_info.end()) {
-                    auto td = it->second.as<InferenceEngine::TensorDesc>();
-                    rt_info["ie_legacy_td"] =
-                        InferenceEngine::TensorDesc(td.getPrecision(), input.get_shape(), td.getLayout());
-                }
+        OPENVINO_SUPPRESS_DEPRECATED_START
+        for (auto&& input : reshaped->inputs()) {
+            auto& rt_info = input.get_rt_info();
+            auto it = rt_info.find("ie_legacy_td");
+            if (it != rt_info.end()) {
+                auto td = it->second.as<InferenceEngine::TensorDesc>();
+                rt_info["ie_legacy_td"] =
+                    InferenceEngine::TensorDesc(td.getPrecision(), input.get_shape(), td.getLayout());
             }
-            for (auto&& result : reshaped->get_results()) {
-                auto output = result->input_value(0);
-                auto& rt_info = output.get_rt_info();
-                auto it = rt_info.find("ie_legacy_td");
-                if (it != rt_info.end()) {
-                    auto td = it->second.as<InferenceEngine::TensorDesc>();
-                    rt_info["ie_legacy_td"] =
-                        InferenceEngine::TensorDesc(td.getPrecision(), output.get_shape(), td.getLayout());
-                }
+        }
+        for (auto&& result : reshaped->get_results()) {
+            auto output = result->input_value(0);
+            auto& rt_info = output.get_rt_info();
+            auto it = rt_info.find("ie_legacy_td");
+            if (it != rt_info.end()) {
+                auto td = it->second.as<InferenceEngine::TensorDesc>();
+                rt_info["ie_legacy_td"] =
+                    InferenceEngine::TensorDesc(td.getPrecision(), output.get_shape(), td.getLayout());
             }
-            OPENVINO_SUPPRESS_DEPRECATED_END
+        }
+        OPENVINO_SUPPRESS_DEPRECATED_END
 
-            compiled_model_with_batch = context
-                                            ? core->compile_model(reshaped, context, device_config_no_auto_batch)
-                                            : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+        return context ? core->compile_model(reshaped, context, device_config_no_auto_batch)
+                       : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+    };
+
+    ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
+    std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>> compiled_models_with_sub_batch;
+    if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
+        try {
+            compiled_model_with_batch = compile_with_batch(meta_device.device_batch_size);
         } catch (const ov::Exception&) {
             meta_device.device_batch_size = 1;
         }
     }
 
+    const auto partial = full_properties.find(partial_batching.name());
+    if (compiled_model_with_batch && partial != full_properties.end() && partial->second.as<bool>()) {
+        // the ladder of the power-of-two batch sizes (in the descending order) used to execute the partial batches
+        uint32_t sub_batch = 1u << static_cast<uint32_t>(std::floor(std::log2(meta_device.device_batch_size - 1)));
+        for (; sub_batch > 1; sub_batch /= 2) {
+            try {
+                compiled_models_with_sub_batch[sub_batch] = compile_with_batch(sub_batch);
+            } catch (const ov::Exception&) {
+                break;
+            }
+        }
+    }
+
     ov::SoPtr<ov::IRemoteContext> device_context;
     if (!context) {
         OPENVINO_SUPPRESS_DEPRECATED_START
@@ -353,7 +372,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
                                            batched_outputs,
                                            compiled_model_with_batch,
                                            compiled_model_without_batch,
-                                           device_context);
+                                           device_context,
+                                           compiled_models_with_sub_batch);
 }
 
 ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
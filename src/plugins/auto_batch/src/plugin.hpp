@@ -18,6 +18,26 @@
 namespace ov {
 namespace autobatch_plugin {
 
+/**
+ * @brief Enables the execution of the requests collected by the moment of the timeout with the largest fitting
+ * sub-batches instead of one by one. The model is additionally compiled for the power-of-two batch sizes smaller than
+ * the device batch size.
+ */
+static constexpr ov::Property<bool> partial_batching{"AUTO_BATCH_PARTIAL_BATCHING"};
+
+/**
+ * @brief Enables the timeout adaptation to the observed requests arrival rate and the batch execution latency.
+ * The ov::auto_batch_timeout value is used as the upper bound.
+ */
+static constexpr ov::Property<bool> adaptive_timeout{"AUTO_BATCH_ADAPTIVE_TIMEOUT"};
+
+/**
+ * @brief Read-only compiled model property with the batching statistics: the numbers of the full batches, the partial
+ * sub-batches, the requests executed without batching, the expired timeouts and the current timeout (ms)
+ */
+static constexpr ov::Property<std::map<std::string, uint64_t>, ov::PropertyMutability::RO> statistics{
+    "AUTO_BATCH_STATISTICS"};
+
 struct DeviceInformation {
     std::string device_name;
     ov::AnyMap device_config;
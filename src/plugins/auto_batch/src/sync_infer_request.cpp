@@ -5,6 +5,7 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "sync_infer_request.hpp"
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "transformations/utils/utils.hpp"
@@ -12,6 +13,22 @@
 namespace ov {
 namespace autobatch_plugin {
 
+// the big tensors (e.g. images) are copied by several threads, each one copies at least this number of bytes
+constexpr size_t parallel_copy_chunk = 256 * 1024;
+
+inline void parallel_memcpy(char* dst, const char* src, size_t size) {
+    const size_t chunks = size / parallel_copy_chunk;
+    if (chunks < 2) {
+        memcpy(dst, src, size);
+        return;
+    }
+    ov::parallel_for(chunks, [&](size_t i) {
+        const size_t offset = i * parallel_copy_chunk;
+        const size_t count = i == chunks - 1 ? size - offset : parallel_copy_chunk;
+        memcpy(dst + offset, src + offset, count);
+    });
+}
+
 inline ov::SoPtr<ov::ITensor> create_shared_tensor_on_batched_tensor(ov::SoPtr<ov::ITensor> batched_tensor,
                                                                      std::string name,
                                                                      const std::set<std::string>& batched_names,
@@ -116,13 +133,13 @@ void SyncInferRequest::copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
-            memcpy(ptrDst + offset, ptrSrc, szSrc);
+            parallel_memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
         ptrdiff_t offset = szSrc != szDst ? m_batch_id * szSrc / m_batch_size : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
-            memcpy(ptrDst, ptrSrc + offset, szDst);
+            parallel_memcpy(ptrDst, ptrSrc + offset, szDst);
     }
 }
 
@@ -134,20 +151,54 @@ void SyncInferRequest::copy_outputs_if_needed() {
     }
 }
 
+void SyncInferRequest::copy_inputs_to_request(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id) {
+    for (const auto& it : get_inputs()) {
+        // this request is already in BUSY state, so using the internal functions safely
+        auto src = get_tensor(it);
+        auto dst = req->get_tensor(it);
+        auto ptrDst = static_cast<char*>(dst->data());
+        auto ptrSrc = static_cast<char*>(src->data());
+        const size_t szSrc = src->get_byte_size();
+        // the inputs without the batch dim are the same for all the requests
+        const size_t offset = szSrc != dst->get_byte_size() ? batch_id * szSrc : 0;
+        if ((ptrDst + offset) != ptrSrc)
+            parallel_memcpy(ptrDst + offset, ptrSrc, szSrc);
+    }
+}
+
+void SyncInferRequest::copy_outputs_from_request(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id) {
+    for (const auto& it : get_outputs()) {
+        // this request is already in BUSY state, so using the internal functions safely
+        auto src = req->get_tensor(it);
+        auto dst = get_tensor(it);
+        auto ptrDst = static_cast<char*>(dst->data());
+        auto ptrSrc = static_cast<char*>(src->data());
+        const size_t szDst = dst->get_byte_size();
+        const size_t offset = szDst != src->get_byte_size() ? batch_id * szDst : 0;
+        if ((ptrSrc + offset) != ptrDst)
+            parallel_memcpy(ptrDst, ptrSrc + offset, szDst);
+    }
+}
+
 void SyncInferRequest::infer() {
     OPENVINO_NOT_IMPLEMENTED;
 }
 
 std::vector<ov::SoPtr<ov::IVariableState>> SyncInferRequest::query_state() const {
-    auto states = m_batched_request_wrapper->_infer_request_batched->query_state();
+    const auto& request = eExecutionFlavor::SUB_BATCH_EXECUTED == m_batched_request_status
+                              ? m_sub_batch_request
+                              : m_batched_request_wrapper->_infer_request_batched;
+    auto states = request->query_state();
     for (auto&& state : states) {
         if (!state._so)
-            state._so = m_batched_request_wrapper->_infer_request_batched._so;
+            state._so = request._so;
     }
     return states;
 }
 
 std::vector<ov::ProfilingInfo> SyncInferRequest::get_profiling_info() const {
+    if (eExecutionFlavor::SUB_BATCH_EXECUTED == m_batched_request_status)
+        return m_sub_batch_request->get_profiling_info();
     return m_batched_request_wrapper->_infer_request_batched->get_profiling_info();
 }
 }  // namespace autobatch_plugin
@@ -27,6 +27,11 @@ public:
 
     void copy_outputs_if_needed();
 
+    // Partial batch impl specific: copies the data to/from the batch_id slot of the request with another batch size
+    void copy_inputs_to_request(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id);
+
+    void copy_outputs_from_request(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id);
+
     void infer() override;
 
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
@@ -35,11 +40,15 @@ public:
 
     std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest> m_batched_request_wrapper;
 
+    // the request with a smaller batch which executed this one (if SUB_BATCH_EXECUTED)
+    ov::SoPtr<ov::IAsyncInferRequest> m_sub_batch_request;
+
     std::exception_ptr m_exception_ptr;
 
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
+        SUB_BATCH_EXECUTED,
         TIMEOUT_EXECUTED
     } m_batched_request_status = eExecutionFlavor::NOT_EXECUTED;
 
@@ -212,7 +212,6 @@ public:
                         for (int n = 0; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             workerRequestPtr->_completion_tasks[n] = std::move(t.second);
-                            t.first->m_sync_request->copy_inputs_if_needed();
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
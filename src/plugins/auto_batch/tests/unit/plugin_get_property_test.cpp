@@ -25,7 +25,9 @@ using get_property_params = std::tuple<std::string,  // Get Property Name
                                        bool>;        // Throw exception
 
 const char supported_metric[] = "SUPPORTED_METRICS FULL_DEVICE_NAME SUPPORTED_CONFIG_KEYS";
-const char supported_config_keys[] = "AUTO_BATCH_DEVICE_CONFIG MULTI_DEVICE_PRIORITIES AUTO_BATCH_TIMEOUT CACHE_DIR";
+const char supported_config_keys[] =
+    "AUTO_BATCH_DEVICE_CONFIG MULTI_DEVICE_PRIORITIES AUTO_BATCH_TIMEOUT CACHE_DIR AUTO_BATCH_PARTIAL_BATCHING "
+    "AUTO_BATCH_ADAPTIVE_TIMEOUT";
 
 class GetPropertyTest : public ::testing::TestWithParam<get_property_params> {
 public:
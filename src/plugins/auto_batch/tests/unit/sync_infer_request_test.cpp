@@ -205,6 +205,37 @@ TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyInputTensorTestCase) {
     EXPECT_NO_THROW(req->copy_inputs_if_needed());
 }
 
+TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyUserInputTensorTestCase) {
+    prepare_input(m_model, m_batch_size);
+    create_worker(m_batch_size);
+
+    const size_t batch_id = m_batch_size - 1;
+    auto req = std::make_shared<SyncInferRequest>(m_auto_batch_compile_model,
+                                                  workerRequestPtr,
+                                                  static_cast<int>(batch_id),
+                                                  m_batch_size,
+                                                  m_batched_inputs,
+                                                  m_batched_outputs);
+    EXPECT_NE(req, nullptr);
+    m_auto_batch_infer_requests.emplace_back(req);
+
+    // the user tensors are not the views into the batched tensors, so they are copied
+    std::vector<ov::Tensor> user_tensors;
+    for (const auto& input : req->get_inputs()) {
+        auto tensor = req->get_tensor(input);
+        user_tensors.emplace_back(tensor->get_element_type(), tensor->get_shape());
+        std::memset(user_tensors.back().data(), 0x5a, user_tensors.back().get_byte_size());
+        req->set_tensor(input, ov::get_tensor_impl(user_tensors.back()));
+    }
+    EXPECT_NO_THROW(req->copy_inputs_if_needed());
+    for (const auto& input : req->get_inputs()) {
+        auto src = req->get_tensor(input);
+        auto dst = m_async_infer_request_with_batch->get_tensor(input);
+        const size_t offset = src->get_byte_size() != dst->get_byte_size() ? batch_id * src->get_byte_size() : 0;
+        EXPECT_EQ(std::memcmp(static_cast<char*>(dst->data()) + offset, src->data(), src->get_byte_size()), 0);
+    }
+}
+
 TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyOutputTensorTestCase) {
     prepare_input(m_model, m_batch_size);
     create_worker(m_batch_size);
@@ -221,6 +252,52 @@ TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyOutputTensorTestCase) {
     EXPECT_NO_THROW(req->copy_outputs_if_needed());
 }
 
+TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyToAnotherBatchRequestTestCase) {
+    prepare_input(m_model, m_batch_size);
+    create_worker(m_batch_size);
+
+    auto req = std::make_shared<SyncInferRequest>(m_auto_batch_compile_model,
+                                                  workerRequestPtr,
+                                                  0,
+                                                  m_batch_size,
+                                                  m_batched_inputs,
+                                                  m_batched_outputs);
+    EXPECT_NE(req, nullptr);
+    m_auto_batch_infer_requests.emplace_back(req);
+
+    // the batched request plays the role of the sub-batch request, the data goes to/from its last slot
+    const size_t slot = m_batch_size - 1;
+    ov::SoPtr<ov::IAsyncInferRequest> another_request = {m_async_infer_request_with_batch, {}};
+    for (const auto& input : req->get_inputs()) {
+        auto tensor = req->get_tensor(input);
+        std::memset(tensor->data(), 0x5a, tensor->get_byte_size());
+    }
+    EXPECT_NO_THROW(req->copy_inputs_to_request(another_request, slot));
+    for (const auto& input : req->get_inputs()) {
+        auto src = req->get_tensor(input);
+        auto dst = another_request->get_tensor(input);
+        EXPECT_EQ(std::memcmp(static_cast<char*>(dst->data()) + slot * src->get_byte_size(),
+                              src->data(),
+                              src->get_byte_size()),
+                  0);
+    }
+
+    for (const auto& output : req->get_outputs()) {
+        auto src = another_request->get_tensor(output);
+        auto dst = req->get_tensor(output);
+        std::memset(static_cast<char*>(src->data()) + slot * dst->get_byte_size(), 0x3c, dst->get_byte_size());
+    }
+    EXPECT_NO_THROW(req->copy_outputs_from_request(another_request, slot));
+    for (const auto& output : req->get_outputs()) {
+        auto src = another_request->get_tensor(output);
+        auto dst = req->get_tensor(output);
+        EXPECT_EQ(std::memcmp(static_cast<char*>(src->data()) + slot * dst->get_byte_size(),
+                              dst->data(),
+                              dst->get_byte_size()),
+                  0);
+    }
+}
+
 TEST_P(AutoBatchRequestTest, AutoBatchRequestGetProfilingInfoTestCase) {
     prepare_input(m_model, m_batch_size);
     create_worker(m_batch_size);
@@ -238,6 +315,39 @@ TEST_P(AutoBatchRequestTest, AutoBatchRequestGetProfilingInfoTestCase) {
     EXPECT_NO_THROW(req->get_profiling_info());
 }
 
+TEST_P(AutoBatchRequestTest, AutoBatchRequestSubBatchGetProfilingInfoTestCase) {
+    prepare_input(m_model, m_batch_size);
+    create_worker(m_batch_size);
+
+    auto req = std::make_shared<SyncInferRequest>(m_auto_batch_compile_model,
+                                                  workerRequestPtr,
+                                                  0,
+                                                  m_batch_size,
+                                                  m_batched_inputs,
+                                                  m_batched_outputs);
+    EXPECT_NE(req, nullptr);
+
+    auto sub_batch_sync_request = std::make_shared<NiceMock<MockISyncInferRequest>>(m_i_compile_model_with_batch);
+    auto sub_batch_async_request =
+        std::make_shared<NiceMock<MockIAsyncInferRequest>>(sub_batch_sync_request, m_executor, nullptr);
+    req->m_sub_batch_request = {sub_batch_async_request, {}};
+    req->m_batched_request_status = SyncInferRequest::eExecutionFlavor::SUB_BATCH_EXECUTED;
+
+    ov::ProfilingInfo info;
+    info.node_name = "sub_batch_node";
+    // the info comes from the sub-batch request which executed the request, not from the full batch one
+    EXPECT_CALL(*sub_batch_sync_request, get_profiling_info()).WillOnce(Return(std::vector<ov::ProfilingInfo>{info}));
+    EXPECT_CALL(*sub_batch_sync_request, query_state()).WillOnce(Return(std::vector<ov::SoPtr<ov::IVariableState>>{}));
+    EXPECT_CALL(*m_sync_infer_request_with_batch, get_profiling_info()).Times(0);
+    EXPECT_CALL(*m_sync_infer_request_with_batch, query_state()).Times(0);
+
+    std::vector<ov::ProfilingInfo> result;
+    EXPECT_NO_THROW(result = req->get_profiling_info());
+    ASSERT_EQ(result.size(), 1u);
+    EXPECT_EQ(result.front().node_name, "sub_batch_node");
+    EXPECT_NO_THROW(req->query_state());
+}
+
 std::vector<ov::element::Type_t> element_type{ov::element::Type_t::f16,
                                               ov::element::Type_t::f32,
                                               ov::element::Type_t::f64,
@@ -5,30 +5,72 @@
 #include "async_infer_request.hpp"
 
 struct RequestExecutor : ov::threading::ITaskExecutor {
-    explicit RequestExecutor(ov::SoPtr<ov::IAsyncInferRequest>& request) : m_request(request) {
+    RequestExecutor(ov::SoPtr<ov::IAsyncInferRequest>& request,
+                    const ov::hetero::PipelineStage::Ptr& stage = nullptr,
+                    const ov::hetero::PipelineStage::Ptr& prev_stage = nullptr,
+                    bool last_stage = false)
+        : m_request(request),
+          m_stage(stage),
+          m_prev_stage(prev_stage),
+          m_last_stage(last_stage) {
         m_request->set_callback([this](std::exception_ptr exception_ptr) mutable {
-            m_exception_ptr = exception_ptr;
-            auto task = std::move(m_task);
-            task();
+            finish(exception_ptr);
         });
     }
     void run(ov::threading::Task task) override {
         m_task = std::move(task);
-        m_request->start_async();
+        if (!m_stage) {
+            m_request->start_async();
+            return;
+        }
+        // the slot of the previous stage is released once the next stage takes the request
+        auto prev_stage = m_prev_stage;
+        m_stage->submit(
+            [this] {
+                try {
+                    m_request->start_async();
+                } catch (...) {
+                    finish(std::current_exception());
+                }
+            },
+            [prev_stage] {
+                if (prev_stage)
+                    prev_stage->complete();
+            });
     };
+    void finish(std::exception_ptr exception_ptr) {
+        m_exception_ptr = exception_ptr;
+        // the next stage is not run after the last stage or the failed one, so nobody else releases the slot
+        if (m_stage && (m_last_stage || exception_ptr))
+            m_stage->complete();
+        auto task = std::move(m_task);
+        task();
+    }
     ov::SoPtr<ov::IAsyncInferRequest>& m_request;
+    ov::hetero::PipelineStage::Ptr m_stage;
+    ov::hetero::PipelineStage::Ptr m_prev_stage;
+    bool m_last_stage;
     std::exception_ptr m_exception_ptr;
     ov::threading::Task m_task;
 };
 
 ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::hetero::InferRequest>& request,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
-                                                 const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
+                                                 const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
+                                                 const std::vector<PipelineStage::Ptr>& pipeline_stages)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
+    OPENVINO_ASSERT(pipeline_stages.empty() || pipeline_stages.size() == m_infer_request->m_subrequests.size());
     m_pipeline.clear();
-    for (auto&& request : m_infer_request->m_subrequests) {
-        auto request_executor = std::make_shared<RequestExecutor>(request);
+    for (size_t i = 0; i < m_infer_request->m_subrequests.size(); i++) {
+        auto& request = m_infer_request->m_subrequests[i];
+        auto request_executor =
+            pipeline_stages.empty()
+                ? std::make_shared<RequestExecutor>(request)
+                : std::make_shared<RequestExecutor>(request,
+                                                    pipeline_stages[i],
+                                                    i == 0 ? nullptr : pipeline_stages[i - 1],
+                                                    i + 1 == pipeline_stages.size());
         m_pipeline.emplace_back(request_executor, [request_executor] {
             if (nullptr != request_executor->m_exception_ptr) {
                 std::rethrow_exception(request_executor->m_exception_ptr);
@@ -5,8 +5,10 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
+#include "pipeline_stage.hpp"
 #include "sync_infer_request.hpp"
 
 namespace ov {
@@ -16,7 +18,8 @@ class AsyncInferRequest : public ov::IAsyncInferRequest {
 public:
     AsyncInferRequest(const std::shared_ptr<InferRequest>& request,
                       const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
-                      const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor);
+                      const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
+                      const std::vector<PipelineStage::Ptr>& pipeline_stages = {});
 
     ~AsyncInferRequest();
 
@@ -422,8 +422,9 @@ ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model
         // disable caching for subgraphs, because the whole HETERO model is cached
         auto device_config = metaDevices[m_compiled_submodels[id].device];
         device_config[ov::cache_dir.name()] = "";
-        // set exclusive_async_requests in case when model is split
-        if (orderedSubgraphs.size() > 1) {
+        // set exclusive_async_requests in case when model is split, the pipeline parallel mode limits the number
+        // of the running subrequests per stage itself and needs the stages to run in parallel
+        if (orderedSubgraphs.size() > 1 && m_cfg.pipeline_stage_requests == 0) {
             auto supported_internal_properties =
                 plugin->get_core()->get_property(m_compiled_submodels[id].device, ov::internal::supported_properties);
             if (std::find(supported_internal_properties.begin(),
@@ -440,6 +441,7 @@ ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model
     }
 
     set_inputs_and_outputs();
+    init_pipeline_stages();
 }
 
 ov::hetero::CompiledModel::CompiledModel(std::istream& model,
@@ -530,6 +532,7 @@ ov::hetero::CompiledModel::CompiledModel(std::istream& model,
         m_submodels_input_to_prev_output.emplace(in_pair, out_pair);
     }
     set_inputs_and_outputs();
+    init_pipeline_stages();
 }
 
 std::shared_ptr<ov::ISyncInferRequest> ov::hetero::CompiledModel::create_sync_infer_request() const {
@@ -542,7 +545,8 @@ std::shared_ptr<ov::IAsyncInferRequest> ov::hetero::CompiledModel::create_infer_
     auto async_infer_request = std::make_shared<ov::hetero::AsyncInferRequest>(
         std::static_pointer_cast<ov::hetero::InferRequest>(internal_request),
         get_task_executor(),
-        get_callback_executor());
+        get_callback_executor(),
+        m_pipeline_stages);
 
     return async_infer_request;
 }
@@ -676,7 +680,8 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
                                                     ov::optimal_number_of_infer_requests,
                                                     ov::execution_devices,
                                                     ov::loaded_from_cache,
-                                                    ov::hetero::number_of_submodels};
+                                                    ov::hetero::number_of_submodels,
+                                                    ov::hetero::pipeline_stages_statistics};
         return ro_properties;
     };
     const auto& to_string_vector = [](const std::vector<ov::PropertyName>& properties) {
@@ -692,6 +697,8 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
         add_ro_properties(ov::supported_properties.name(), supported_properties);
         add_ro_properties(ov::device::properties.name(), supported_properties);
         add_ro_properties(ov::device::priorities.name(), supported_properties);
+        add_ro_properties(ov::hetero::pipeline_stage_requests.name(), supported_properties);
+        add_ro_properties(ov::hetero::pipeline_queue_size.name(), supported_properties);
         return decltype(ov::supported_properties)::value_type(supported_properties);
     } else if (EXEC_NETWORK_METRIC_KEY(SUPPORTED_METRICS) == name) {
         auto metrics = default_ro_properties();
@@ -718,6 +725,12 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
     } else if (ov::loaded_from_cache == name) {
         return decltype(ov::loaded_from_cache)::value_type{m_loaded_from_cache};
     } else if (ov::optimal_number_of_infer_requests == name) {
+        if (!m_pipeline_stages.empty()) {
+            // enough requests to occupy all the slots of the stages and to fill the queues between them
+            const auto stages = static_cast<unsigned int>(m_pipeline_stages.size());
+            return decltype(ov::optimal_number_of_infer_requests)::value_type{
+                m_cfg.pipeline_stage_requests * stages + m_cfg.pipeline_queue_size * (stages - 1)};
+        }
         unsigned int value = 0u;
         for (const auto& comp_model_desc : m_compiled_submodels) {
             value = std::max(value,
@@ -737,6 +750,14 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
         return decltype(ov::execution_devices)::value_type{device_names};
     } else if (ov::hetero::number_of_submodels == name) {
         return decltype(ov::hetero::number_of_submodels)::value_type{m_compiled_submodels.size()};
+    } else if (ov::hetero::pipeline_stages_statistics == name) {
+        decltype(ov::hetero::pipeline_stages_statistics)::value_type statistics;
+        for (size_t i = 0; i < m_pipeline_stages.size(); i++) {
+            for (const auto& stage_statistics : m_pipeline_stages[i]->get_statistics())
+                statistics[std::string("subgraph") + std::to_string(i) + "." + stage_statistics.first] =
+                    stage_statistics.second;
+        }
+        return statistics;
     }
     return m_cfg.get(name);
     OPENVINO_SUPPRESS_DEPRECATED_END
@@ -750,6 +771,17 @@ const std::vector<ov::Output<const ov::Node>>& ov::hetero::CompiledModel::output
     return m_compiled_outputs;
 }
 
+void ov::hetero::CompiledModel::init_pipeline_stages() {
+    // a single submodel has nothing to overlap with
+    if (m_cfg.pipeline_stage_requests == 0 || m_compiled_submodels.size() < 2)
+        return;
+    for (size_t i = 0; i < m_compiled_submodels.size(); i++) {
+        // nothing precedes the first stage to backpressure, its queue is bounded by the number of the requests
+        const size_t queue_size = i == 0 ? 0 : m_cfg.pipeline_queue_size;
+        m_pipeline_stages.emplace_back(std::make_shared<PipelineStage>(m_cfg.pipeline_stage_requests, queue_size));
+    }
+}
+
 void ov::hetero::CompiledModel::set_inputs_and_outputs() {
     // Restore inputs/outputs from compiled submodels
     m_compiled_inputs.reserve(m_inputs_to_submodels_inputs.size());
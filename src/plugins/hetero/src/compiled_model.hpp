@@ -7,6 +7,7 @@
 #include "config.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/so_ptr.hpp"
+#include "pipeline_stage.hpp"
 
 namespace ov {
 namespace hetero {
@@ -45,6 +46,8 @@ private:
 
     void set_inputs_and_outputs();
 
+    void init_pipeline_stages();
+
     Configuration m_cfg;
     std::string m_name;
     const bool m_loaded_from_cache;
@@ -62,6 +65,8 @@ private:
         ov::SoPtr<ov::ICompiledModel> compiled_model;
     };
     std::vector<CompiledModelDesc> m_compiled_submodels;
+    // schedulers of the submodels in the pipeline parallel mode, empty if the mode is disabled
+    std::vector<PipelineStage::Ptr> m_pipeline_stages;
 };
 }  // namespace hetero
 }  // namespace ov
\ No newline at end of file
@@ -7,10 +7,11 @@
 #include "ie/ie_plugin_config.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "properties.hpp"
 
 using namespace ov::hetero;
 
-Configuration::Configuration() : dump_graph(false) {}
+Configuration::Configuration() : dump_graph(false), pipeline_stage_requests(0), pipeline_queue_size(1) {}
 
 Configuration::Configuration(const ov::AnyMap& config, const Configuration& defaultCfg, bool throwOnUnsupported) {
     OPENVINO_SUPPRESS_DEPRECATED_START
@@ -24,6 +25,10 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
             dump_graph = value.as<bool>();
         } else if ("TARGET_FALLBACK" == key || ov::device::priorities == key) {
             device_priorities = value.as<std::string>();
+        } else if (ov::hetero::pipeline_stage_requests == key) {
+            pipeline_stage_requests = value.as<uint32_t>();
+        } else if (ov::hetero::pipeline_queue_size == key) {
+            pipeline_queue_size = value.as<uint32_t>();
         } else {
             if (throwOnUnsupported)
                 OPENVINO_THROW("Property was not found: ", key);
@@ -39,6 +44,10 @@ ov::Any Configuration::get(const std::string& name) const {
         return {dump_graph};
     } else if (name == "TARGET_FALLBACK" || name == ov::device::priorities) {
         return {device_priorities};
+    } else if (name == ov::hetero::pipeline_stage_requests) {
+        return {pipeline_stage_requests};
+    } else if (name == ov::hetero::pipeline_queue_size) {
+        return {pipeline_queue_size};
     } else {
         OPENVINO_THROW("Property was not found: ", name);
     }
@@ -49,7 +58,9 @@ std::vector<ov::PropertyName> Configuration::get_supported() const {
     OPENVINO_SUPPRESS_DEPRECATED_START
     static const std::vector<ov::PropertyName> names = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
                                                         "TARGET_FALLBACK",
-                                                        ov::device::priorities};
+                                                        ov::device::priorities,
+                                                        ov::hetero::pipeline_stage_requests,
+                                                        ov::hetero::pipeline_queue_size};
     return names;
     OPENVINO_SUPPRESS_DEPRECATED_END
 }
@@ -58,7 +69,9 @@ ov::AnyMap Configuration::get_hetero_properties() const {
     OPENVINO_SUPPRESS_DEPRECATED_START
     return {{HETERO_CONFIG_KEY(DUMP_GRAPH_DOT), dump_graph},
             {"TARGET_FALLBACK", device_priorities},
-            {ov::device::priorities.name(), device_priorities}};
+            {ov::device::priorities.name(), device_priorities},
+            {ov::hetero::pipeline_stage_requests.name(), pipeline_stage_requests},
+            {ov::hetero::pipeline_queue_size.name(), pipeline_queue_size}};
     OPENVINO_SUPPRESS_DEPRECATED_END
 }
 
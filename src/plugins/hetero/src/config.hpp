@@ -33,6 +33,8 @@ struct Configuration {
 
     bool dump_graph;
     std::string device_priorities;
+    uint32_t pipeline_stage_requests;
+    uint32_t pipeline_queue_size;
     ov::AnyMap device_properties;
 };
 }  // namespace hetero
@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline_stage.hpp"
+
+#include "openvino/core/except.hpp"
+
+namespace {
+double to_ms(const ov::hetero::PipelineStage::Clock::duration& duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+}  // namespace
+
+ov::hetero::PipelineStage::PipelineStage(size_t requests, size_t queue_size)
+    : m_requests(requests),
+      m_queue_size(queue_size),
+      m_created(Clock::now()),
+      m_last_update(m_created) {
+    OPENVINO_ASSERT(m_requests > 0, "Pipeline stage should run at least one request");
+}
+
+void ov::hetero::PipelineStage::update_time(Clock::time_point now) {
+    const auto elapsed = to_ms(now - m_last_update);
+    m_slots_time += elapsed * m_running;
+    if (m_running > 0)
+        m_busy_time += elapsed;
+    m_last_update = now;
+}
+
+void ov::hetero::PipelineStage::start_queued(std::deque<ov::threading::Task>& tasks) {
+    const auto now = m_last_update;
+    while (true) {
+        if (m_running < m_requests && !m_queue.empty()) {
+            auto item = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_running++;
+            m_inferences++;
+            m_queue_wait += to_ms(now - item.arrival);
+            tasks.emplace_back(std::move(item.start));
+        } else if (!m_blocked.empty() && (m_queue_size == 0 || m_queue.size() < m_queue_size)) {
+            // the previous stage can reuse the slot of the request as soon as the request is queued here
+            auto item = std::move(m_blocked.front());
+            m_blocked.pop_front();
+            tasks.emplace_back(std::move(item.on_accepted));
+            m_queue.emplace_back(std::move(item));
+        } else {
+            break;
+        }
+    }
+}
+
+void ov::hetero::PipelineStage::submit(ov::threading::Task start, ov::threading::Task on_accepted) {
+    std::deque<ov::threading::Task> tasks;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        update_time(Clock::now());
+        m_blocked.push_back({std::move(start), std::move(on_accepted), m_last_update});
+        start_queued(tasks);
+    }
+    for (auto&& task : tasks) {
+        if (task)
+            task();
+    }
+}
+
+void ov::hetero::PipelineStage::complete() {
+    std::deque<ov::threading::Task> tasks;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        update_time(Clock::now());
+        OPENVINO_ASSERT(m_running > 0, "Pipeline stage has no running requests");
+        m_running--;
+        start_queued(tasks);
+    }
+    for (auto&& task : tasks) {
+        if (task)
+            task();
+    }
+}
+
+std::map<std::string, double> ov::hetero::PipelineStage::get_statistics() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    const auto now = Clock::now();
+    const auto since_update = to_ms(now - m_last_update);
+    const auto total = to_ms(now - m_created);
+    const auto slots_time = m_slots_time + since_update * m_running;
+    const auto busy_time = m_busy_time + (m_running > 0 ? since_update : 0.0);
+
+    std::map<std::string, double> statistics;
+    statistics["occupancy"] = total > 0 ? slots_time / (total * m_requests) : 0.0;
+    statistics["busy"] = total > 0 ? busy_time / total : 0.0;
+    statistics["queue_wait_ms"] = m_inferences > 0 ? m_queue_wait / m_inferences : 0.0;
+    statistics["inferences"] = static_cast<double>(m_inferences);
+    return statistics;
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov {
+namespace hetero {
+
+/**
+ * @brief Scheduler of one stage (submodel) of the pipeline parallel execution.
+ *
+ * The stage runs at most `requests` subrequests at once, the rest wait in the stage queue. The queue of every stage
+ * except the first one is bounded: a request finished by the previous stage keeps its slot there until the queue
+ * has a room, so a slow stage backpressures the faster ones instead of accumulating the requests in front of it.
+ */
+class PipelineStage {
+public:
+    using Ptr = std::shared_ptr<PipelineStage>;
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @param requests number of subrequests the stage runs at once
+     * @param queue_size capacity of the stage queue, 0 means the queue is unbounded
+     */
+    PipelineStage(size_t requests, size_t queue_size);
+
+    /**
+     * @brief Starts the task when the stage has a free slot or puts it to the queue
+     * @param start starts the subrequest of the stage, `complete()` should be called once it is finished
+     * @param on_accepted is called once the task is started or queued, releases the slot of the previous stage
+     */
+    void submit(ov::threading::Task start, ov::threading::Task on_accepted);
+
+    /**
+     * @brief Releases the slot of the finished task and starts the next queued one
+     */
+    void complete();
+
+    /**
+     * @brief Returns the statistics of the stage since the model compilation:
+     * `occupancy` - mean fraction of the busy slots, `busy` - fraction of the time with at least one busy slot,
+     * `queue_wait_ms` - mean time spent in the queue, `inferences` - number of the started subrequests
+     */
+    std::map<std::string, double> get_statistics() const;
+
+private:
+    struct Item {
+        ov::threading::Task start;
+        ov::threading::Task on_accepted;
+        Clock::time_point arrival;
+    };
+
+    // should be called under the lock, returns the tasks to run outside of it
+    void update_time(Clock::time_point now);
+    void start_queued(std::deque<ov::threading::Task>& tasks);
+
+    const size_t m_requests;
+    const size_t m_queue_size;
+
+    mutable std::mutex m_mutex;
+    size_t m_running = 0;
+    std::deque<Item> m_queue;
+    // the tasks finished by the previous stage which do not fit into the queue
+    std::deque<Item> m_blocked;
+
+    const Clock::time_point m_created;
+    Clock::time_point m_last_update;
+    double m_slots_time = 0;
+    double m_busy_time = 0;
+    double m_queue_wait = 0;
+    uint64_t m_inferences = 0;
+};
+
+}  // namespace hetero
+}  // namespace ov
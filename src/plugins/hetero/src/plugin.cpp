@@ -113,7 +113,9 @@ ov::Any ov::hetero::Plugin::get_property(const std::string& name, const ov::AnyM
         return ro_properties;
     };
     const auto& default_rw_properties = []() {
-        std::vector<ov::PropertyName> rw_properties{ov::device::priorities};
+        std::vector<ov::PropertyName> rw_properties{ov::device::priorities,
+                                                    ov::hetero::pipeline_stage_requests,
+                                                    ov::hetero::pipeline_queue_size};
         return rw_properties;
     };
     const auto& to_string_vector = [](const std::vector<ov::PropertyName>& properties) {
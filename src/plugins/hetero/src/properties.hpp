@@ -18,5 +18,27 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
 
+/**
+ * @brief Enables the pipeline parallel execution of the submodels: every submodel is a stage which runs up to the
+ * given number of subrequests of the different infer requests at once, so the throughput is limited by the slowest
+ * stage instead of the sum of the stages. 0 (default) disables the mode, the submodels of the request are executed
+ * one by one.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> pipeline_stage_requests{"HETERO_PIPELINE_STAGE_REQUESTS"};
+
+/**
+ * @brief Capacity of the queue in front of every pipeline stage except the first one, the request finished by the
+ * previous stage keeps its slot there while the queue is full. 0 means the queue is unbounded.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> pipeline_queue_size{"HETERO_PIPELINE_QUEUE_SIZE"};
+
+/**
+ * @brief Read-only property to get the statistics of the pipeline stages as "subgraph<N>.<name>" entries:
+ * occupancy (mean fraction of the busy stage slots), busy (fraction of the time the stage runs any request),
+ * queue_wait_ms (mean time in the stage queue) and inferences
+ */
+static constexpr Property<std::map<std::string, double>, PropertyMutability::RO> pipeline_stages_statistics{
+    "HETERO_PIPELINE_STAGES_STATISTICS"};
+
 }  // namespace hetero
 }  // namespace ov
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "hetero_tests.hpp"
+#include "openvino/runtime/properties.hpp"
+
+using namespace ov::hetero::tests;
+
+namespace {
+const std::string stage_requests_key = "HETERO_PIPELINE_STAGE_REQUESTS";
+const std::string queue_size_key = "HETERO_PIPELINE_QUEUE_SIZE";
+const std::string statistics_key = "HETERO_PIPELINE_STAGES_STATISTICS";
+}  // namespace
+
+TEST_F(HeteroTests, pipeline_parallel_disabled_by_default) {
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, "HETERO", ov::device::priorities("MOCK0,MOCK1"));
+    EXPECT_EQ(0, compiled_model.get_property(stage_requests_key).as<uint32_t>());
+    EXPECT_TRUE(compiled_model.get_property(statistics_key).as<std::map<std::string, double>>().empty());
+}
+
+TEST_F(HeteroTests, pipeline_parallel_infer) {
+    const uint32_t stage_requests = 2;
+    const uint32_t queue_size = 1;
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"),
+                         {stage_requests_key, stage_requests},
+                         {queue_size_key, queue_size}};
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, "HETERO", config);
+    const auto stages = compiled_model.get_property("HETERO_NUMBER_OF_SUBMODELS").as<size_t>();
+    ASSERT_LT(1, stages);
+    const auto nireq = compiled_model.get_property(ov::optimal_number_of_infer_requests);
+    EXPECT_EQ(stage_requests * stages + queue_size * (stages - 1), nireq);
+
+    const size_t iterations = 4;
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < nireq; i++)
+        requests.emplace_back(compiled_model.create_infer_request());
+    for (size_t iteration = 0; iteration < iterations; iteration++) {
+        for (size_t i = 0; i < requests.size(); i++) {
+            auto input = requests[i].get_input_tensor();
+            auto data = input.data<int64_t>();
+            for (size_t j = 0; j < input.get_size(); j++)
+                data[j] = static_cast<int64_t>(iteration * 1000 + i * 100 + j);
+            requests[i].start_async();
+        }
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].wait();
+            // add and subtract of the same value keep the input
+            auto output = requests[i].get_output_tensor();
+            auto data = output.data<int64_t>();
+            for (size_t j = 0; j < output.get_size(); j++)
+                ASSERT_EQ(static_cast<int64_t>(iteration * 1000 + i * 100 + j), data[j]);
+        }
+    }
+
+    auto statistics = compiled_model.get_property(statistics_key).as<std::map<std::string, double>>();
+    for (size_t stage = 0; stage < stages; stage++) {
+        const auto prefix = "subgraph" + std::to_string(stage) + ".";
+        ASSERT_TRUE(statistics.count(prefix + "inferences"));
+        EXPECT_EQ(static_cast<double>(nireq * iterations), statistics.at(prefix + "inferences"));
+        EXPECT_GE(statistics.at(prefix + "occupancy"), 0.0);
+        EXPECT_LE(statistics.at(prefix + "occupancy"), 1.0);
+        EXPECT_GE(statistics.at(prefix + "busy") + 1e-9, statistics.at(prefix + "occupancy"));
+        EXPECT_GE(statistics.at(prefix + "queue_wait_ms"), 0.0);
+    }
+}
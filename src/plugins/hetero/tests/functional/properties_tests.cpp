@@ -11,7 +11,9 @@ TEST_F(HeteroTests, get_property_supported_properties) {
     const std::vector<ov::PropertyName> supported_properties = {ov::supported_properties,
                                                                 ov::device::full_name,
                                                                 ov::device::capabilities,
-                                                                ov::device::priorities};
+                                                                ov::device::priorities,
+                                                                ov::PropertyName{"HETERO_PIPELINE_STAGE_REQUESTS"},
+                                                                ov::PropertyName{"HETERO_PIPELINE_QUEUE_SIZE"}};
     auto actual_supported_properties = core.get_property("HETERO", ov::supported_properties);
     EXPECT_EQ(supported_properties.size(), actual_supported_properties.size());
     for (auto& supported_property : supported_properties) {
@@ -40,7 +42,9 @@ TEST_F(HeteroTests, get_property_supported_metrics) {
 TEST_F(HeteroTests, get_property_supported_configs) {
     const std::vector<std::string> supported_configs = {"HETERO_DUMP_GRAPH_DOT",
                                                         "TARGET_FALLBACK",
-                                                        ov::device::priorities.name()};
+                                                        ov::device::priorities.name(),
+                                                        "HETERO_PIPELINE_STAGE_REQUESTS",
+                                                        "HETERO_PIPELINE_QUEUE_SIZE"};
     auto actual_supported_configs =
         core.get_property("HETERO", METRIC_KEY(SUPPORTED_CONFIG_KEYS)).as<std::vector<std::string>>();
     EXPECT_EQ(supported_configs.size(), actual_supported_configs.size());
@@ -4,9 +4,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <functional>
-#include "lru_cache.h"
+#include "sharded_lru_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -17,23 +18,44 @@ public:
         Hit,
         Miss
     };
+
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+    };
 public:
     virtual ~CacheEntryBase() = default;
+
+    Statistics getStatistics() const {
+        Statistics result;
+        result.hits = _hits.load(std::memory_order_relaxed);
+        result.misses = _misses.load(std::memory_order_relaxed);
+        result.evictions = _evictions.load(std::memory_order_relaxed);
+        return result;
+    }
+
+protected:
+    std::atomic_size_t _hits{0};
+    std::atomic_size_t _misses{0};
+    std::atomic_size_t _evictions{0};
 };
 
 /**
  * @brief Class represents a templated record in multi cache
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
- *         interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide size_t put(KeyType, ValueType) returning the number of evicted
+ *         records and ValueType get(const KeyType&) interface and must have constructor of type ImplType(size_t).
+ *         The entry is thread safe as long as the ImplType is thread safe.
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
+ * @note The value is built outside of the storage locks, so concurrent lookups of the same missing key may build it several times.
  */
 
 template<typename KeyType,
          typename ValType,
-         typename ImplType = LruCache<KeyType, ValType>>
+         typename ImplType = ShardedLruCache<KeyType, ValType>>
 class CacheEntry : public CacheEntryBase {
 public:
     using ResultType = std::pair<ValType, LookUpStatus>;
@@ -52,6 +74,7 @@ public:
     ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
         if (0 == _impl.getCapacity()) {
             // fast track
+            _misses.fetch_add(1, std::memory_order_relaxed);
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
@@ -59,9 +82,12 @@ public:
         auto retEmpty = ValType();
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
+            _misses.fetch_add(1, std::memory_order_relaxed);
             retVal = builder(key);
             if (retVal != retEmpty)
-                _impl.put(key, retVal);
+                _evictions.fetch_add(_impl.put(key, retVal), std::memory_order_relaxed);
+        } else {
+            _hits.fetch_add(1, std::memory_order_relaxed);
         }
         return {retVal, retStatus};
     }
@@ -0,0 +1,462 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_code_cache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <sstream>
+
+#include "openvino/core/version.hpp"
+#include "openvino/util/file_util.hpp"
+
+#if defined(OPENVINO_ARCH_X86_64)
+# include <cpu/x64/cpu_isa_traits.hpp>
+#endif
+
+#if defined(__linux__)
+# include <dirent.h>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr char fileMagic[8] = {'O', 'V', 'C', 'P', 'U', 'J', 'I', 'T'};
+constexpr uint32_t fileVersion = 2;
+
+// FNV-1a
+uint64_t fnv1a(const char* data, size_t size) {
+    uint64_t result = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < size; i++) {
+        result ^= static_cast<uint8_t>(data[i]);
+        result *= 0x100000001b3ull;
+    }
+    return result;
+}
+
+template <typename T>
+void writeValue(std::string& buffer, const T& value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(const std::string& buffer, size_t& offset, T& value) {
+    if (buffer.size() < offset + sizeof(T))
+        return false;
+    std::memcpy(&value, buffer.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+uint64_t readQword(const uint8_t* ptr) {
+    uint64_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+#if defined(__linux__)
+/**
+ * Copies the code into a new executable region and moves the relocated addresses from base to the region.
+ * The region is unmapped when the last reference to the code is released.
+ */
+JitCodeCache::CodePtr mapCode(const uint8_t* code, size_t size, uintptr_t base, const std::vector<uint32_t>& relocations) {
+    void* region = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (region == MAP_FAILED)
+        return nullptr;
+    auto* dst = static_cast<uint8_t*>(region);
+    std::memcpy(dst, code, size);
+    const auto newBase = reinterpret_cast<uintptr_t>(dst);
+    for (const auto offset : relocations) {
+        const uint64_t value = readQword(dst + offset) - base + newBase;
+        std::memcpy(dst + offset, &value, sizeof(value));
+    }
+    if (mprotect(region, size, PROT_READ | PROT_EXEC) != 0) {
+        munmap(region, size);
+        return nullptr;
+    }
+    return JitCodeCache::CodePtr(dst, [size](const uint8_t* ptr) {
+        munmap(const_cast<uint8_t*>(ptr), size);
+    });
+}
+
+/**
+ * The file or the directory owned by the current user which can't be modified by the others
+ */
+bool isOwnedAndProtected(const struct stat& st) {
+    return st.st_uid == geteuid() && (st.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+}
+
+bool readFile(int fd, std::string& buffer) {
+    char chunk[4096];
+    ssize_t count = 0;
+    while ((count = read(fd, chunk, sizeof(chunk))) > 0)
+        buffer.append(chunk, count);
+    return count == 0;
+}
+
+bool writeFile(int fd, const std::string& buffer) {
+    size_t offset = 0;
+    while (offset < buffer.size()) {
+        const auto count = write(fd, buffer.data() + offset, buffer.size() - offset);
+        if (count <= 0)
+            return false;
+        offset += count;
+    }
+    return true;
+}
+
+/**
+ * The [begin, end) address ranges of the memory mapped into the process sorted by the begin address
+ */
+std::vector<std::pair<uint64_t, uint64_t>> mappedRanges() {
+    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    const int fd = open("/proc/self/maps", O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return ranges;
+    std::string maps;
+    readFile(fd, maps);
+    close(fd);
+
+    std::istringstream lines(maps);
+    std::string line;
+    while (std::getline(lines, line)) {
+        unsigned long long begin = 0, end = 0;  // NOLINT
+        if (std::sscanf(line.c_str(), "%llx-%llx", &begin, &end) == 2)
+            ranges.emplace_back(begin, end);
+    }
+    std::sort(ranges.begin(), ranges.end());
+    return ranges;
+}
+#endif  // __linux__
+
+uint64_t elapsedNs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+}   // namespace
+
+JitCodeCache::Key::Key(const std::string& kernelName) : data(kernelName) {
+    data.push_back('\0');
+    data.append(ov::get_openvino_version().buildNumber);
+    data.push_back('\0');
+#if defined(OPENVINO_ARCH_X86_64)
+    *this << static_cast<uint64_t>(dnnl::impl::cpu::x64::get_max_cpu_isa());
+#endif
+}
+
+uint64_t JitCodeCache::Key::hash() const {
+    return fnv1a(data.data(), data.size());
+}
+
+JitCodeCache::Ptr JitCodeCache::get(const std::string& dir) {
+#if defined(__linux__)
+    if (dir.empty())
+        return nullptr;
+
+    static std::mutex registryMutex;
+    static std::map<std::string, std::weak_ptr<JitCodeCache>> registry;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    auto& cache = registry[dir];
+    auto result = cache.lock();
+    if (!result) {
+        if (!ov::util::directory_exists(dir)) {
+            ov::util::create_directory_recursive(dir);
+            chmod(dir.c_str(), S_IRWXU);
+        }
+        result = std::make_shared<JitCodeCache>(dir);
+        cache = result;
+    }
+    return result;
+#else
+    (void)dir;
+    return nullptr;
+#endif
+}
+
+JitCodeCache::JitCodeCache(std::string dir, size_t capacity)
+    : directory(std::move(dir)), capacity(capacity), trusted(false) {
+#if defined(__linux__)
+    struct stat st;
+    trusted = lstat(directory.c_str(), &st) == 0 && S_ISDIR(st.st_mode) && isOwnedAndProtected(st);
+#endif
+}
+
+std::string JitCodeCache::filePath(const Key& key) const {
+    std::ostringstream name;
+    name << std::hex << key.hash() << ".bin";
+    return ov::util::path_join({directory, name.str()});
+}
+
+JitCodeCache::CodePtr JitCodeCache::getOrCreate(const Key& key,
+                                                const std::function<Code()>& generate,
+                                                const std::function<Code()>& generateCopy) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = loaded.find(key.str());
+        CodePtr code = found != loaded.end() ? found->second.code.lock() : nullptr;
+        uint64_t generationNs = found != loaded.end() ? found->second.generationNs : 0;
+        if (!code && (code = load(key, generationNs))) {
+            // the code of the destroyed kernels is already unmapped
+            for (auto it = loaded.begin(); it != loaded.end();) {
+                it = it->second.code.expired() ? loaded.erase(it) : std::next(it);
+            }
+            loaded[key.str()] = Entry{code, generationNs};
+        }
+        if (code) {
+            hits++;
+            savedNs += generationNs;
+            return code;
+        }
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto code = generate();
+    const auto generationNs = elapsedNs(start);
+    misses++;
+    jitNs += generationNs;
+    // the generated code is owned by the kernel
+    const CodePtr result(code.data, [](const uint8_t*) {});
+    // the copy is generated only if the code can be stored
+    if (!trusted)
+        return result;
+
+    const auto relocationStart = std::chrono::steady_clock::now();
+    const auto copy = generateCopy();
+    std::vector<uint32_t> relocations;
+    const bool relocatable = copy.size == code.size && findRelocations(code.data, copy.data, code.size, relocations) &&
+                             !referencesProcessMemory(code.data, code.size, relocations);
+    relocationNs += elapsedNs(relocationStart);
+    if (!relocatable) {
+        notRelocatable++;
+        return result;
+    }
+    store(key, code, relocations, generationNs);
+    return result;
+}
+
+bool JitCodeCache::referencesProcessMemory(const uint8_t* code, size_t size, const std::vector<uint32_t>& relocations) {
+#if defined(__linux__)
+    const auto ranges = mappedRanges();
+    if (ranges.empty())
+        return true;
+
+    size_t nextRelocation = 0;
+    for (size_t offset = 0; offset + sizeof(uint64_t) <= size; offset++) {
+        if (nextRelocation < relocations.size() && offset == relocations[nextRelocation]) {
+            offset += sizeof(uint64_t) - 1;
+            nextRelocation++;
+            continue;
+        }
+        // the qword may be any part of the instructions, so a false positive only prevents the code from being stored
+        const auto value = readQword(code + offset);
+        auto range = std::upper_bound(ranges.begin(), ranges.end(), std::make_pair(value, UINT64_MAX));
+        if (range != ranges.begin() && value < std::prev(range)->second)
+            return true;
+    }
+    return false;
+#else
+    (void)code;
+    (void)size;
+    (void)relocations;
+    return true;
+#endif
+}
+
+bool JitCodeCache::findRelocations(const uint8_t* a, const uint8_t* b, size_t size, std::vector<uint32_t>& relocations) {
+    const auto baseA = reinterpret_cast<uintptr_t>(a);
+    const auto delta = reinterpret_cast<uintptr_t>(b) - baseA;
+    relocations.clear();
+
+    size_t covered = 0;  // the bytes before are either equal or belong to the found relocations
+    for (size_t i = 0; i < size; i++) {
+        if (i < covered || a[i] == b[i])
+            continue;
+        // the differing byte must belong to the qword holding an address inside the code
+        bool found = false;
+        const size_t first = i >= sizeof(uint64_t) - 1 ? i - (sizeof(uint64_t) - 1) : 0;
+        for (size_t offset = std::max(first, covered); offset <= i && offset + sizeof(uint64_t) <= size; offset++) {
+            const auto valueA = readQword(a + offset);
+            const auto valueB = readQword(b + offset);
+            if (valueA >= baseA && valueA <= baseA + size && valueB - valueA == delta) {
+                relocations.push_back(static_cast<uint32_t>(offset));
+                covered = offset + sizeof(uint64_t);
+                found = true;
+                break;
+            }
+        }
+        if (!found)
+            return false;
+    }
+    return true;
+}
+
+JitCodeCache::CodePtr JitCodeCache::load(const Key& key, uint64_t& generationNs) {
+#if defined(__linux__)
+    if (!trusted)
+        return nullptr;
+    const int fd = open(filePath(key).c_str(), O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+    if (fd < 0)
+        return nullptr;
+    // the checks are done for the opened file, so it can't be replaced in between
+    struct stat st;
+    std::string buffer;
+    const bool valid = fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && isOwnedAndProtected(st) && readFile(fd, buffer);
+    if (valid) {
+        // the modification time orders the files for the eviction
+        futimens(fd, nullptr);
+    }
+    close(fd);
+
+    uint64_t checksum = 0;
+    size_t offset = buffer.size() >= sizeof(checksum) ? buffer.size() - sizeof(checksum) : 0;
+    if (!valid || !readValue(buffer, offset, checksum) ||
+        checksum != fnv1a(buffer.data(), buffer.size() - sizeof(checksum))) {
+        rejected++;
+        return nullptr;
+    }
+    buffer.resize(buffer.size() - sizeof(checksum));
+
+    offset = 0;
+    char magic[sizeof(fileMagic)];
+    uint32_t version = 0;
+    uint64_t keySize = 0, base = 0, codeSize = 0, relocationsCount = 0;
+    for (auto& c : magic) {
+        if (!readValue(buffer, offset, c))
+            return nullptr;
+    }
+    if (std::memcmp(magic, fileMagic, sizeof(fileMagic)) != 0 || !readValue(buffer, offset, version) ||
+        version != fileVersion || !readValue(buffer, offset, keySize) || buffer.size() - offset < keySize ||
+        buffer.compare(offset, keySize, key.str()) != 0)
+        return nullptr;
+    offset += keySize;
+    if (!readValue(buffer, offset, generationNs) || !readValue(buffer, offset, base) ||
+        !readValue(buffer, offset, codeSize) || !readValue(buffer, offset, relocationsCount) ||
+        codeSize < sizeof(uint64_t) || relocationsCount > codeSize / sizeof(uint64_t))
+        return nullptr;
+
+    std::vector<uint32_t> relocations(relocationsCount);
+    for (auto& relocation : relocations) {
+        if (!readValue(buffer, offset, relocation) || relocation > codeSize - sizeof(uint64_t))
+            return nullptr;
+    }
+    if (buffer.size() - offset != codeSize)
+        return nullptr;
+
+    return mapCode(reinterpret_cast<const uint8_t*>(buffer.data() + offset), codeSize, base, relocations);
+#else
+    (void)key;
+    (void)generationNs;
+    return nullptr;
+#endif
+}
+
+void JitCodeCache::store(const Key& key,
+                         const Code& code,
+                         const std::vector<uint32_t>& relocations,
+                         uint64_t generationNs) {
+#if defined(__linux__)
+    if (!trusted)
+        return;
+    std::string buffer(fileMagic, sizeof(fileMagic));
+    writeValue(buffer, fileVersion);
+    writeValue(buffer, static_cast<uint64_t>(key.str().size()));
+    buffer.append(key.str());
+    writeValue(buffer, generationNs);
+    writeValue(buffer, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(code.data)));
+    writeValue(buffer, static_cast<uint64_t>(code.size));
+    writeValue(buffer, static_cast<uint64_t>(relocations.size()));
+    for (const auto relocation : relocations)
+        writeValue(buffer, relocation);
+    buffer.append(reinterpret_cast<const char*>(code.data), code.size);
+    writeValue(buffer, fnv1a(buffer.data(), buffer.size()));
+
+    const auto path = filePath(key);
+    // the file is written under the unique name and renamed, so the concurrent processes never read a partial file
+    const auto tmpPath = path + "." + std::to_string(getpid()) + ".tmp";
+    const int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+        return;
+    const bool written = writeFile(fd, buffer);
+    if (close(fd) != 0 || !written || std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        std::remove(tmpPath.c_str());
+        return;
+    }
+    stored++;
+    trim();
+#else
+    (void)key;
+    (void)code;
+    (void)relocations;
+    (void)generationNs;
+#endif
+}
+
+void JitCodeCache::trim() {
+#if defined(__linux__)
+    struct File {
+        std::string path;
+        size_t size;
+        struct timespec time;
+    };
+    std::vector<File> files;
+    size_t totalSize = 0;
+
+    DIR* dir = opendir(directory.c_str());
+    if (!dir)
+        return;
+    while (const auto* entry = readdir(dir)) {
+        const std::string name = entry->d_name;
+        if (name.size() <= 4 || name.compare(name.size() - 4, 4, ".bin") != 0)
+            continue;
+        auto path = ov::util::path_join({directory, name});
+        struct stat st;
+        if (lstat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode))
+            continue;
+        files.push_back({std::move(path), static_cast<size_t>(st.st_size), st.st_mtim});
+        totalSize += st.st_size;
+    }
+    closedir(dir);
+    if (totalSize <= capacity)
+        return;
+
+    // the least recently used files first
+    std::sort(files.begin(), files.end(), [](const File& a, const File& b) {
+        return a.time.tv_sec != b.time.tv_sec ? a.time.tv_sec < b.time.tv_sec : a.time.tv_nsec < b.time.tv_nsec;
+    });
+    for (const auto& file : files) {
+        if (totalSize <= capacity)
+            break;
+        if (std::remove(file.path.c_str()) == 0) {
+            totalSize -= file.size;
+            evicted++;
+        }
+    }
+#endif
+}
+
+JitCodeCache::Statistics JitCodeCache::getStatistics() const {
+    Statistics result;
+    result.hits = hits;
+    result.misses = misses;
+    result.stored = stored;
+    result.notRelocatable = notRelocatable;
+    result.rejected = rejected;
+    result.evicted = evicted;
+    result.jitTimeUs = jitNs / 1000;
+    result.savedTimeUs = savedNs / 1000;
+    result.relocationTimeUs = relocationNs / 1000;
+    return result;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
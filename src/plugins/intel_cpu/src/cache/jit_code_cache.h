@@ -0,0 +1,157 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Persistent storage of the generated JIT kernels code placed into the Core cache_dir.
+ *
+ * A file is addressed by the hash of the kernel key: the kernel name, the kernel parameters, the plugin build number
+ * and the host CPU features. The full key is stored in the file too and is compared on load, so the hash
+ * collisions are harmless.
+ *
+ * The generated code may contain absolute addresses of its own data (e.g. the constant tables addressed via labels).
+ * To find them the kernel is generated a second time at the different address: the qwords that differ between the
+ * two copies must point into the code and are stored as relocations, which are patched on load. The other absolute
+ * addresses (a call of a C++ function, a pointer to a static table or to the heap data) are equal in both copies and
+ * are not valid in another process, so the code is stored only if none of the other qwords points into the memory
+ * mapped into the process. The copy is generated on a miss only if the cache directory may be used.
+ *
+ * The code is mapped executable, so a file is loaded only if the file and the directory are owned by the current
+ * user and are not writable by the others, and the checksum of the file content matches. The files are written with
+ * the owner only permissions. The size of the directory is limited by the capacity, the least recently used files
+ * are removed first.
+ *
+ * The loaded code is shared by all the kernels with the same key within the process and is unmapped as soon as
+ * the last of them is destroyed.
+ *
+ * Is thread safe.
+ */
+class JitCodeCache {
+public:
+    typedef std::shared_ptr<JitCodeCache> Ptr;
+    typedef std::shared_ptr<const uint8_t> CodePtr;
+
+    static constexpr size_t defaultCapacity = 256 * 1024 * 1024;
+
+    class Key {
+    public:
+        explicit Key(const std::string& kernelName);
+
+        template <typename T, typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value, int>::type = 0>
+        Key& operator<<(const T& value) {
+            const auto* bytes = reinterpret_cast<const char*>(&value);
+            data.append(bytes, sizeof(T));
+            return *this;
+        }
+
+        const std::string& str() const {
+            return data;
+        }
+
+        uint64_t hash() const;
+
+    private:
+        std::string data;
+    };
+
+    struct Code {
+        const uint8_t* data;
+        size_t size;
+    };
+
+    struct Statistics {
+        uint64_t hits = 0;              // the kernels loaded from the cache (from the disk or from the process memory)
+        uint64_t misses = 0;            // the kernels generated
+        uint64_t stored = 0;            // the kernels written to the disk
+        uint64_t notRelocatable = 0;    // the kernels which code can't be stored
+        uint64_t rejected = 0;          // the files failed the ownership or the integrity check
+        uint64_t evicted = 0;           // the files removed to fit the capacity
+        uint64_t jitTimeUs = 0;         // the time spent on the generation of the missed kernels
+        uint64_t savedTimeUs = 0;       // the generation time of the kernels loaded from the cache
+        uint64_t relocationTimeUs = 0;  // the time spent on the copies generation and the checks of the missed kernels
+    };
+
+    /**
+     * @brief Returns the cache placed into the directory, the cache instances are shared within the process
+     * @param dir the cache directory, is created with the owner only permissions if it does not exist
+     * @return the cache or nullptr if the directory is empty or the persistent cache is not supported on the platform
+     */
+    static Ptr get(const std::string& dir);
+
+    /**
+     * @brief Looks for the kernel code in the cache and generates it on a miss
+     * @param key the kernel key
+     * @param generate generates the code of the kernel which requested the cache
+     * @param generateCopy generates the code of another instance of the same kernel, used to find the relocations
+     *        before the code is stored, the instance must stay alive until the method returns
+     * @return the executable code of the kernel, the caller keeps it as long as the kernel is used
+     */
+    CodePtr getOrCreate(const Key& key,
+                        const std::function<Code()>& generate,
+                        const std::function<Code()>& generateCopy);
+
+    Statistics getStatistics() const;
+
+    /**
+     * @brief Finds the qwords which differ between two copies of the code generated at the addresses a and b
+     * @return false if some difference is not an address inside the code
+     */
+    static bool findRelocations(const uint8_t* a, const uint8_t* b, size_t size, std::vector<uint32_t>& relocations);
+
+    /**
+     * @brief Checks whether any qword of the code except the relocations points into the memory mapped into the process
+     * @return true if the code is valid in this process only (or the process memory map can't be read)
+     */
+    static bool referencesProcessMemory(const uint8_t* code, size_t size, const std::vector<uint32_t>& relocations);
+
+    /**
+     * @param dir the existing cache directory
+     * @param capacity the maximal total size of the files in the directory in bytes
+     */
+    explicit JitCodeCache(std::string dir, size_t capacity = defaultCapacity);
+
+private:
+    struct Entry {
+        std::weak_ptr<const uint8_t> code;
+        uint64_t generationNs;
+    };
+
+    CodePtr load(const Key& key, uint64_t& generationNs);
+    void store(const Key& key, const Code& code, const std::vector<uint32_t>& relocations, uint64_t generationNs);
+    void trim();
+    std::string filePath(const Key& key) const;
+
+    std::string directory;
+    size_t capacity;
+    bool trusted;  // the directory may be neither modified nor replaced by the other users
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Entry> loaded;
+
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> stored{0};
+    std::atomic<uint64_t> notRelocatable{0};
+    std::atomic<uint64_t> rejected{0};
+    std::atomic<uint64_t> evicted{0};
+    std::atomic<uint64_t> jitNs{0};
+    std::atomic<uint64_t> savedNs{0};
+    std::atomic<uint64_t> relocationNs{0};
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
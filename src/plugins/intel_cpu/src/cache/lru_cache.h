@@ -30,23 +30,26 @@ public:
      * @brief Puts the value associated with the key into the cache.
      * @param key
      * @param value
+     * @return number of records evicted to free space for the new one
      */
 
-    void put(const Key &key, const Value &val) {
+    size_t put(const Key &key, const Value &val) {
         if (0 == _capacity) {
-            return;
+            return 0;
         }
+        size_t evicted = 0;
         auto mapItr = _cacheMapper.find(key);
         if (mapItr != _cacheMapper.end()) {
             touch(mapItr->second);
             mapItr->second->second = val;
         } else {
             if (_cacheMapper.size() == _capacity) {
-                evict(1);
+                evicted = evict(1);
             }
             auto itr = _lruList.insert(_lruList.begin(), {key, val});
             _cacheMapper.insert({key, itr});
         }
+        return evicted;
     }
 
     /**
@@ -68,13 +71,16 @@ public:
     /**
      * @brief Evicts n least recently used cache records
      * @param n number of records to be evicted, can be greater than capacity
+     * @return number of actually evicted records
      */
 
-    void evict(size_t n) {
-        for (size_t i = 0; i < n && !_lruList.empty(); ++i) {
+    size_t evict(size_t n) {
+        size_t i = 0;
+        for (; i < n && !_lruList.empty(); ++i) {
             _cacheMapper.erase(_lruList.back().first);
             _lruList.pop_back();
         }
+        return i;
     }
 
     /**
@@ -9,5 +9,17 @@ namespace intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+MultiCache::Statistics MultiCache::getStatistics() const {
+    Statistics result;
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const auto& item : _storage) {
+        const auto entryStatistics = item.second->getStatistics();
+        result.hits += entryStatistics.hits;
+        result.misses += entryStatistics.misses;
+        result.evictions += entryStatistics.evictions;
+    }
+    return result;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
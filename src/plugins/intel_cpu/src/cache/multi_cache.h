@@ -7,15 +7,37 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
+#include <type_traits>
 #include "cache_entry.h"
 
+namespace dnnl {
+struct primitive;
+}   // namespace dnnl
+
 namespace ov {
 namespace intel_cpu {
 
+class DnnlExecutor;
+
+/**
+ * @brief Defines whether the cached value may be executed by several threads at once.
+ *
+ * oneDNN primitives and DnnlExecutor (including the derived executors of the nodes) are immutable after the creation
+ * and take all the memory (including the scratch pad) as the execution arguments. Other executors may keep working
+ * buffers, so they must never be shared.
+ */
+template<typename ValueType>
+struct IsStatelessCacheValue : std::is_base_of<dnnl::primitive, ValueType> {};
+
+template<typename T>
+struct IsStatelessCacheValue<std::shared_ptr<T>> : std::is_base_of<DnnlExecutor, T> {};
+
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * The cache is thread safe. The stateless values (see IsStatelessCacheValue) may be stored in a parent cache shared
+ * between the streams of a compiled model, while the stateful ones are always kept by the cache of the stream.
  */
 
 class MultiCache {
@@ -25,6 +47,7 @@ public:
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
+    using Statistics = CacheEntryBase::Statistics;
 
 public:
     /**
@@ -33,6 +56,16 @@ public:
     */
     explicit MultiCache(size_t capacity) : _capacity(capacity) {}
 
+    /**
+    * @param shared is the cache shared between the streams which keeps the stateless records
+    */
+    MultiCache(size_t capacity, std::shared_ptr<MultiCache> shared) : _capacity(capacity), _shared(std::move(shared)) {}
+
+    MultiCache(const MultiCache& other) : _capacity(other._capacity), _shared(other._shared) {
+        std::lock_guard<std::mutex> lock(other._mutex);
+        _storage = other._storage;
+    }
+
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
     *       using the key and the builder functor and adds the new record to the cache
@@ -45,10 +78,17 @@ public:
     template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
+        if (IsStatelessCacheValue<ValueType>::value && _shared)
+            return _shared->getOrCreate(key, std::move(builder));
         auto entry = getEntry<KeyType, ValueType>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+    * @brief Returns the lookup statistics accumulated over all the entries (excluding the shared cache)
+    */
+    Statistics getStatistics() const;
+
 private:
     template<typename T>
     size_t getTypeId();
@@ -58,6 +98,8 @@ private:
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    std::shared_ptr<MultiCache> _shared;
+    mutable std::mutex _mutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -71,6 +113,7 @@ template<typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_mutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "lru_cache.h"
+
+/**
+ * @brief Thread safe preemptive cache with LRU eviction policy.
+ * The records are distributed over several independent LRU caches (shards) by the key hash, each one guarded by its own mutex,
+ * so the concurrent lookups of different keys rarely contend. The LRU eviction policy is applied per shard.
+ * Small caches are not split, so they keep the exact LRU policy.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ * @tparam MaxShards is the maximum number of shards
+ * @tparam MinShardCapacity is the minimum number of records per shard
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+template<typename Key, typename Value, size_t MaxShards = 16, size_t MinShardCapacity = 64>
+class ShardedLruCache {
+public:
+    /**
+     * @param capacity total records limit, each shard may hold up to capacity / number of shards (rounded up) records
+     */
+    explicit ShardedLruCache(size_t capacity) : _capacity(capacity) {
+        const size_t numShards = std::max<size_t>(1, std::min(MaxShards, capacity / MinShardCapacity));
+        const size_t shardCapacity = (capacity + numShards - 1) / numShards;
+        for (size_t i = 0; i < numShards; i++) {
+            _shards.emplace_back(new Shard(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     * @return number of records evicted to free space for the new one
+     */
+
+    size_t put(const Key &key, const Value &val) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.put(key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key &key) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.get(key);
+    }
+
+    /**
+     * @brief Evicts up to n least recently used cache records from each shard
+     * @param n number of records to be evicted per shard, can be greater than capacity
+     * @return number of actually evicted records
+     */
+
+    size_t evict(size_t n) {
+        size_t evicted = 0;
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            evicted += shard->cache.evict(n);
+        }
+        return evicted;
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+private:
+    struct Shard {
+        explicit Shard(size_t capacity) : cache(capacity) {}
+        std::mutex mutex;
+        LruCache<Key, Value> cache;
+    };
+
+    Shard& getShard(const Key &key) {
+        if (_shards.size() == 1) {
+            return *_shards.front();
+        }
+        // the low bits of the hash are used by the shard hash table, so mix in the high ones
+        const size_t hash = key.hash();
+        return *_shards[(hash ^ (hash >> 16)) % _shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
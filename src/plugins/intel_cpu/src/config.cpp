@@ -19,6 +19,7 @@
 #include "openvino/runtime/properties.hpp"
 #include "utils/debug_capabilities.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "internal_properties.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -227,6 +228,75 @@ void Config::readProperties(const std::map<std::string, std::string> &prop, Mode
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_SNIPPETS_MODE
                             << ". Expected values: ENABLE/DISABLE/IGNORE_CALLBACK";
+        } else if (key == ov::intel_cpu::enable_parallel_branches.name()) {
+            if (val == PluginConfigParams::YES) {
+                enableParallelBranches = true;
+            } else if (val == PluginConfigParams::NO) {
+                enableParallelBranches = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::enable_parallel_branches.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::shared_runtime_cache.name()) {
+            if (val == PluginConfigParams::YES) {
+                sharedRtCache = true;
+            } else if (val == PluginConfigParams::NO) {
+                sharedRtCache = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::shared_runtime_cache.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::shared_weights.name()) {
+            if (val == PluginConfigParams::YES) {
+                sharedWeights = true;
+            } else if (val == PluginConfigParams::NO) {
+                sharedWeights = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::shared_weights.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::shared_weights_dir.name()) {
+            sharedWeightsDir = val;
+        } else if (key == ov::intel_cpu::shape_infer_cache_capacity.name()) {
+            long long val_i = -1;
+            try {
+                val_i = std::stoll(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::shape_infer_cache_capacity.name()
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means disabling the cache
+            shapeInferCacheCapacity = static_cast<size_t>(std::max(val_i, 0ll));
+        } else if (key == ov::intel_cpu::dynamic_memory_planning.name()) {
+            if (val == PluginConfigParams::YES) {
+                dynamicMemoryPlanning = true;
+            } else if (val == PluginConfigParams::NO) {
+                dynamicMemoryPlanning = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::dynamic_memory_planning.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::telemetry_sampling_rate.name()) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::telemetry_sampling_rate.name()
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means disabling the telemetry
+            telemetrySamplingRate = std::max(val_i, 0);
+        } else if (key == ov::intel_cpu::streams_work_stealing.name()) {
+            if (val == PluginConfigParams::YES) {
+                streamExecutorConfig._work_stealing = true;
+            } else if (val == PluginConfigParams::NO) {
+                streamExecutorConfig._work_stealing = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::streams_work_stealing.name()
+                           << ". Expected only true/false." << std::endl;
+            }
         } else if (key == ov::hint::execution_mode.name()) {
             if (val == "PERFORMANCE") {
                 executionMode = ov::hint::ExecutionMode::PERFORMANCE;
@@ -56,6 +56,15 @@ struct Config {
     std::string dumpToDot = {};
     std::string device_id = {};
     float fcSparseWeiDecompressionRate = 1.0f;
+    bool enableParallelBranches = false;
+    bool sharedRtCache = false;
+    size_t shapeInferCacheCapacity = 0ul;
+    bool dynamicMemoryPlanning = false;
+    size_t telemetrySamplingRate = 0ul;
+    bool sharedWeights = false;
+    std::string sharedWeightsDir = {};
+    // the directory of the persistent JIT kernels cache, derived from the Core cache_dir (empty if disabled)
+    std::string jitCacheDir = {};
 #if defined(OPENVINO_ARCH_X86_64)
     size_t rtCacheCapacity = 5000ul;
 #else
@@ -0,0 +1,147 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynamic_mem_planner.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include <common/primitive_hashing_utils.hpp>
+#include <common/utils.hpp>
+#include "utils/general_utils.h"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr size_t arenaAlignment = 64;
+constexpr int64_t blockAlignment = 32;
+}  // namespace
+
+void* DynamicMemoryPlanner::BlockMemoryMngr::getRawPtr() const noexcept {
+    return m_usePlan ? m_planned : m_group->getRawPtr();
+}
+
+void DynamicMemoryPlanner::BlockMemoryMngr::setExtBuff(void* ptr, size_t size) {
+    m_planned = ptr;
+    m_plannedSize = size;
+    m_usePlan = true;
+    m_lastPtr = ptr;
+}
+
+bool DynamicMemoryPlanner::BlockMemoryMngr::resize(size_t size) {
+    m_requestedSize = std::max(m_requestedSize, size);
+    m_usePlan = m_planned && size <= m_plannedSize;
+    if (!m_usePlan)
+        m_group->resize(size);
+    // the group memory may be reallocated by another tensor of the group, so the pointer is checked every time
+    void* ptr = getRawPtr();
+    const bool changed = ptr != m_lastPtr;
+    m_lastPtr = ptr;
+    return changed;
+}
+
+bool DynamicMemoryPlanner::BlockMemoryMngr::hasExtBuffer() const noexcept {
+    return m_usePlan;
+}
+
+size_t DynamicMemoryPlanner::InputShapesKey::hash() const {
+    size_t seed = 0;
+    for (const auto& dims : inputDims) {
+        seed = dnnl::impl::hash_combine(seed, dims.size());
+        for (const auto dim : dims)
+            seed = dnnl::impl::hash_combine(seed, dim);
+    }
+    return seed;
+}
+
+DynamicMemoryPlanner::DynamicMemoryPlanner(size_t maxPlans) : m_plans(maxPlans) {}
+
+MemoryMngrPtr DynamicMemoryPlanner::addBlock(const MemorySolver::Box& box) {
+    // the same greedy grouping as the one of the dynamic tensors allocated without the planner
+    auto group = std::find_if(m_groups.begin(), m_groups.end(), [&box](const Group& group) {
+        return group.lastBox.start > box.finish || group.lastBox.finish < box.start;
+    });
+    if (group == m_groups.end()) {
+        m_groups.push_back({box, std::make_shared<MemoryMngrWithReuse>()});
+        group = std::prev(m_groups.end());
+    }
+    group->lastBox = box;
+
+    auto block = new BlockMemoryMngr(group->mngr);
+    auto mngr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<IMemoryMngr>(block));
+
+    MemorySolver::Box planBox = box;
+    planBox.id = static_cast<int64_t>(m_boxes.size());
+    m_boxes.push_back(planBox);
+    m_mngrs.push_back(mngr);
+    m_blocks.push_back(block);
+    return mngr;
+}
+
+void DynamicMemoryPlanner::beginInfer(const std::vector<VectorDims>& inputDims) {
+    m_currentKey.inputDims = inputDims;
+    for (auto block : m_blocks)
+        block->resetRequestedSize();
+
+    auto plan = m_plans.get(m_currentKey);
+    m_currentPlanned = plan != nullptr;
+    if (plan && plan != m_activePlan)
+        applyPlan(plan);
+}
+
+void DynamicMemoryPlanner::endInfer() {
+    if (m_currentPlanned || m_boxes.empty())
+        return;
+
+    auto boxes = m_boxes;
+    for (size_t i = 0; i < boxes.size(); i++) {
+        // zero sized tensors still get a place in the arena to keep the offsets unique
+        boxes[i].size = std::max<int64_t>(1, div_up(static_cast<int64_t>(m_blocks[i]->getRequestedSize()), blockAlignment));
+    }
+
+    MemorySolver solver(boxes);
+    auto plan = std::make_shared<Plan>();
+    plan->arenaSize = static_cast<size_t>(solver.solve()) * blockAlignment;
+    for (const auto& box : m_boxes) {
+        plan->offsets.push_back(static_cast<size_t>(solver.getOffset(box.id)) * blockAlignment);
+        plan->sizes.push_back(static_cast<size_t>(boxes[box.id].size) * blockAlignment);
+    }
+
+    m_plans.put(m_currentKey, plan);
+    m_plansCount++;
+    m_currentPlanned = true;
+    // the tensors are not used after the inference, so they are moved to the arena right away
+    // to release the memory allocated by the tensors on their own
+    applyPlan(plan);
+}
+
+void DynamicMemoryPlanner::applyPlan(const std::shared_ptr<Plan>& plan) {
+    // the old arena is kept till all the tensors are moved to the new one
+    auto arena = m_arena;
+    if (plan->arenaSize > m_arenaSize || plan->arenaSize < m_arenaSize / 2) {
+        void* data = dnnl::impl::malloc(plan->arenaSize, arenaAlignment);
+        if (!data)
+            IE_THROW() << "Failed to allocate " << plan->arenaSize << " bytes of memory for the dynamic tensors";
+        arena = std::shared_ptr<void>(data, dnnl::impl::free);
+    }
+
+    auto base = static_cast<uint8_t*>(arena.get());
+    for (size_t i = 0; i < m_mngrs.size(); i++) {
+        m_mngrs[i]->setExtBuff(base + plan->offsets[i], plan->sizes[i]);
+    }
+
+    if (arena != m_arena) {
+        m_arena = arena;
+        m_arenaSize = plan->arenaSize;
+    }
+    m_activePlan = plan;
+
+    // all the tensors are in the arena now, the external buffer replaces (and frees) the group memory
+    for (auto& group : m_groups)
+        group.mngr->setExtBuff(nullptr, 0);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
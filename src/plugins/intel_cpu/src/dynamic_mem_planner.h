@@ -0,0 +1,134 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+#include "cache/lru_cache.h"
+#include "memory_solver.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Memory planner of the dynamic (undefined size) intermediate tensors of a graph.
+ *
+ * Every tensor (edges cluster) gets its own memory manager. After the inference with new input shapes the sizes
+ * requested by the tensors are passed to the MemorySolver, and the solution (plan) is cached for these input shapes.
+ * The plan places all the tensors into one arena the same way as the static memory reuse does, so when the input
+ * shapes repeat, the tensors take the memory from the arena without any reallocation.
+ *
+ * The tensors whose lifetimes overlap never share the arena memory, so the tensor which does not exceed the size
+ * planned for it is valid for any input shapes. The one exceeding the planned size (or any tensor before the first
+ * plan is built) falls back to the memory shared by the group of the tensors with non overlapping lifetimes, the same
+ * way as the dynamic tensors are allocated without the planner. The group memory is released on the plan switch.
+ *
+ * The arena is reallocated when a plan needs more memory, or less than a half of it, so the memory taken by the
+ * peak input shapes is not kept forever.
+ *
+ * Is not thread safe: the graph is inferred by one thread at a time.
+ */
+class DynamicMemoryPlanner {
+public:
+    using Ptr = std::shared_ptr<DynamicMemoryPlanner>;
+
+    explicit DynamicMemoryPlanner(size_t maxPlans = 64);
+
+    /**
+     * @brief Registers a tensor
+     * @param box lifetime of the tensor, the box size is ignored
+     * @return memory manager to be used by the edges of the tensor
+     */
+    MemoryMngrPtr addBlock(const MemorySolver::Box& box);
+
+    /**
+     * @brief Switches the tensors to the plan built for the input shapes (if any), must be called before the
+     * shape inference of the graph
+     */
+    void beginInfer(const std::vector<VectorDims>& inputDims);
+
+    /**
+     * @brief Builds and activates the plan for the input shapes of the inference if there is no such plan yet
+     */
+    void endInfer();
+
+    size_t getPlansCount() const {
+        return m_plansCount;
+    }
+
+    size_t getArenaSize() const {
+        return m_arenaSize;
+    }
+
+private:
+    // a memory manager which takes the memory planned in the arena if it is big enough or the memory of the group
+    // otherwise, tracks the biggest size requested during the inference
+    class BlockMemoryMngr : public IMemoryMngr {
+    public:
+        explicit BlockMemoryMngr(std::shared_ptr<MemoryMngrWithReuse> group) : m_group(std::move(group)) {}
+
+        void* getRawPtr() const noexcept override;
+        void setExtBuff(void* ptr, size_t size) override;
+        bool resize(size_t size) override;
+        bool hasExtBuffer() const noexcept override;
+
+        size_t getRequestedSize() const {
+            return m_requestedSize;
+        }
+        void resetRequestedSize() {
+            m_requestedSize = 0;
+        }
+
+    private:
+        std::shared_ptr<MemoryMngrWithReuse> m_group;
+        void* m_planned = nullptr;
+        size_t m_plannedSize = 0;
+        bool m_usePlan = false;
+        void* m_lastPtr = nullptr;  // the pointer the memory objects of the tensor were updated with
+        size_t m_requestedSize = 0;
+    };
+
+    // the tensors with non overlapping lifetimes sharing the memory when the plan can't be used
+    struct Group {
+        MemorySolver::Box lastBox;
+        std::shared_ptr<MemoryMngrWithReuse> mngr;
+    };
+
+    struct Plan {
+        std::vector<size_t> offsets;  // in bytes from the beginning of the arena
+        std::vector<size_t> sizes;    // in bytes
+        size_t arenaSize = 0;
+    };
+
+    struct InputShapesKey {
+        std::vector<VectorDims> inputDims;
+
+        size_t hash() const;
+        bool operator==(const InputShapesKey& rhs) const {
+            return inputDims == rhs.inputDims;
+        }
+    };
+
+    void applyPlan(const std::shared_ptr<Plan>& plan);
+
+    std::vector<MemorySolver::Box> m_boxes;
+    std::vector<MemoryMngrPtr> m_mngrs;
+    std::vector<BlockMemoryMngr*> m_blocks;
+    std::vector<Group> m_groups;
+
+    LruCache<InputShapesKey, std::shared_ptr<Plan>> m_plans;
+    size_t m_plansCount = 0;
+    std::shared_ptr<Plan> m_activePlan;
+    InputShapesKey m_currentKey;
+    bool m_currentPlanned = false;
+
+    std::shared_ptr<void> m_arena;
+    size_t m_arenaSize = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -22,6 +22,11 @@ namespace intel_cpu {
 
 namespace {
 constexpr size_t gpr_size = 8;
+
+// the label after the Loop body, the Loop with the runtime work amount jumps there if the body must be skipped
+std::string get_loop_skip_label(const snippets::op::LoopBegin* loop_begin) {
+    return "snippets_loop_skip_" + std::to_string(reinterpret_cast<uintptr_t>(loop_begin));
+}
 } // namespace
 
 inline static void transform_idxs_to_regs(const std::vector<size_t>& idxs, std::vector<Reg64>& regs) {
@@ -132,6 +137,10 @@ KernelEmitter::KernelEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl:
         io_data_layouts.push_back(desc->get_layout());
         io_data_sizes.push_back(etype.size());
     }
+    for (const auto& expr : body) {
+        if (const auto loop_end = ov::as_type_ptr<snippets::op::LoopEnd>(expr->get_node()))
+            is_shape_agnostic = is_shape_agnostic || loop_end->has_runtime_work_amount();
+    }
 
     // Initialize pools of gp and vec registers
     gp_regs_pool.resize(16);
@@ -180,9 +189,11 @@ KernelEmitter::KernelEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl:
     for (const auto& abstract_to_physical : gpr_map_pool.first)
         data_ptr_regs_idx.push_back(abstract_to_physical.second);
     // However we can use reg_indexes_idx and reg_const_params_idx for other operations since we won't need them
-    // after offsets calculation
+    // after offsets calculation. The only exception is the shape agnostic kernel: Loops read their work amounts
+    // through reg_const_params
     gpr_map_pool.second.push_back(reg_indexes_idx);
-    gpr_map_pool.second.push_back(reg_const_params_idx);
+    if (!is_shape_agnostic)
+        gpr_map_pool.second.push_back(reg_const_params_idx);
     map_abstract_registers(gpr_map_pool, vec_map_pool, general_exprs);
 }
 
@@ -249,10 +260,20 @@ void KernelEmitter::init_data_pointers(const Xbyak::Reg64& reg_indexes, const Xb
         data_offsets[i] = offset_calculation(io_shapes[i],  io_data_layouts[i], io_data_sizes[i]);
     }
     // master_shape size must be valid in both static and dynamic cases
-    std::function<void(Reg64, const std::vector<size_t>&, Reg64)> init_ptr_with_offset;
-    init_ptr_with_offset = [&](Reg64 pointer, const std::vector<size_t>& offsets, Reg64 reg_tmp) {
+    std::function<void(Reg64, size_t, Reg64)> init_ptr_with_offset;
+    init_ptr_with_offset = [&](Reg64 pointer, size_t param_idx, Reg64 reg_tmp) {
+        const auto& offsets = data_offsets[param_idx];
         for (size_t j = 0; j < offset_rank; j++) {
-            if (jcp.master_shape[j] != 1 && offsets[j] != 0) {
+            if (is_shape_agnostic) {
+                // reg_const_params is saved on the stack if it's used as reg_tmp
+                if (reg_tmp == reg_const_params)
+                    h->mov(reg_tmp, h->ptr[h->rsp]);
+                h->mov(reg_tmp, h->ptr[reg_const_params + GET_OFF(runtime_args)]);
+                h->mov(reg_tmp, h->ptr[reg_tmp + GET_RUNTIME_OFF(data_offsets) +
+                                       (param_idx * SNIPPETS_MAX_HARNESS_DIMS + j) * sizeof(int64_t)]);
+                h->imul(reg_tmp, h->ptr[reg_indexes + j * sizeof(size_t)]);
+                h->add(pointer, reg_tmp);
+            } else if (jcp.master_shape[j] != 1 && offsets[j] != 0) {
                 h->mov(reg_tmp, offsets[j]);
                 h->imul(reg_tmp, h->ptr[reg_indexes + j * sizeof(size_t)]);
                 h->add(pointer, reg_tmp);
@@ -279,7 +300,7 @@ void KernelEmitter::init_data_pointers(const Xbyak::Reg64& reg_indexes, const Xb
             h->mov(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(src_ptrs) + i * sizeof(void*)]);
         else
             h->mov(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*)]);
-        init_ptr_with_offset(data_ptr_regs[i], data_offsets[i], reg_tmp);
+        init_ptr_with_offset(data_ptr_regs[i], i, reg_tmp);
     }
     // a rare case when num_params is maximal, so we have no spare gprs
     // * Static case: we can use reg_const_params as the last reg_tmp for the last iteration (and corrupt it), since
@@ -289,8 +310,12 @@ void KernelEmitter::init_data_pointers(const Xbyak::Reg64& reg_indexes, const Xb
     if (last_iter_explicitly) {
         h->mov(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*)]);
         reg_tmp = reg_const_params;
-        // can corrupt reg_const_params, since we won't use it anymore
-        init_ptr_with_offset(data_ptr_regs[i], data_offsets[i], reg_tmp);
+        // can corrupt reg_const_params in the static case, since we won't use it anymore
+        if (is_shape_agnostic)
+            h->push(reg_const_params);
+        init_ptr_with_offset(data_ptr_regs[i], i, reg_tmp);
+        if (is_shape_agnostic)
+            h->pop(reg_const_params);
     }
 }
 void KernelEmitter::emit_impl(const std::vector<size_t>& in,
@@ -326,7 +351,15 @@ LoopBeginEmitter::LoopBeginEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl:
     if (!loop_end)
         IE_THROW() << "LoopBeginEmitter invoked with invalid configuration: the last output must be LoopEnd";
     work_amount = loop_end->get_work_amount();
+    wa_increment = loop_end->get_increment();
     evaluate_once = loop_end->get_evaluate_once();
+    runtime_work_amount = loop_end->has_runtime_work_amount();
+    if (runtime_work_amount) {
+        runtime_work_amount_idx = loop_end->get_runtime_work_amount_idx();
+        runtime_work_amount_divisor = loop_end->get_runtime_work_amount_divisor();
+        if (runtime_work_amount_idx >= SNIPPETS_MAX_RUNTIME_WORK_AMOUNTS)
+            IE_THROW() << "LoopBeginEmitter got invalid runtime work amount index " << runtime_work_amount_idx;
+    }
     in_out_type_ = emitter_in_out_map::gpr_to_gpr;
 }
 
@@ -350,7 +383,16 @@ void LoopBeginEmitter::emit_impl(const std::vector<size_t>& in,
     Reg64 reg_work_amount = Reg64(static_cast<int>(out.back()));
     Label for_body;
     // save previous register state (if there is an outer loop that uses this reg for example)
-    if (!evaluate_once) {
+    if (runtime_work_amount) {
+        // abi_param2 is kept by the shape agnostic Kernel
+        h->mov(reg_work_amount, h->ptr[abi_param2 + GET_OFF(runtime_args)]);
+        h->mov(reg_work_amount, h->ptr[reg_work_amount + GET_RUNTIME_OFF(work_amounts) + runtime_work_amount_idx * sizeof(int64_t)]);
+        if (runtime_work_amount_divisor != 0)
+            h->and_(reg_work_amount, runtime_work_amount_divisor - 1);
+        // the body is executed at least once, so it's skipped if there is not enough work
+        h->cmp(reg_work_amount, wa_increment);
+        h->jl(get_loop_skip_label(loop_begin.get()), CodeGenerator::T_NEAR);
+    } else if (!evaluate_once) {
         h->mov(reg_work_amount, work_amount);
     }
     // Note: loop address is not calculated at this point, so need to call calcJmpAddress() which is protected
@@ -376,6 +418,9 @@ LoopEndEmitter::LoopEndEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::imp
     ptr_increments = loop_end->get_ptr_increments();
     finalization_offsets = loop_end->get_finalization_offsets();
     evaluate_once = loop_end->get_evaluate_once();
+    runtime_work_amount = loop_end->has_runtime_work_amount();
+    if (runtime_work_amount)
+        runtime_work_amount_idx = loop_end->get_runtime_work_amount_idx();
     io_data_size = loop_end->get_element_type_sizes();
     in_out_type_ = emitter_in_out_map::gpr_to_gpr;
 }
@@ -419,6 +464,21 @@ void LoopEndEmitter::emit_impl(const std::vector<size_t>& in,
         h->jge(loop_begin->begin_address);
     }
 
+    if (runtime_work_amount) {
+        // the finalization offsets are applied even if the body is skipped: the vector loop could shift the pointers
+        h->L(get_loop_skip_label(loop_begin.get()));
+        // the work amount reg is free after the loop
+        for (size_t idx = 0; idx < data_ptr_regs.size(); idx++) {
+            if (finalization_offsets[idx] == 0)
+                continue;
+            h->mov(reg_work_amount, h->ptr[abi_param2 + GET_OFF(runtime_args)]);
+            h->mov(reg_work_amount, h->ptr[reg_work_amount + GET_RUNTIME_OFF(work_amounts) + runtime_work_amount_idx * sizeof(int64_t)]);
+            h->imul(reg_work_amount, reg_work_amount, static_cast<int>(finalization_offsets[idx] * io_data_size[idx]));
+            h->add(data_ptr_regs[idx], reg_work_amount);
+        }
+        return;
+    }
+
     for (size_t idx = 0; idx < data_ptr_regs.size(); idx++) {
         if (finalization_offsets[idx] != 0)
             h->add(data_ptr_regs[idx], finalization_offsets[idx] * io_data_size[idx]);
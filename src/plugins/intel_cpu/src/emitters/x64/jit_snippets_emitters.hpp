@@ -26,11 +26,22 @@ namespace intel_cpu {
 #define SNIPPETS_MAX_HARNESS_DIMS 5
 #define SNIPPETS_MAX_TILE_RANK 2
 #define SNIPPETS_DYNAMIC_MASTER_SHAPE_RANK 6
+#define SNIPPETS_MAX_RUNTIME_WORK_AMOUNTS 1
 #define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+#define GET_RUNTIME_OFF(field) offsetof(jit_snippets_runtime_args, field)
+// Shape dependent arguments of the shape agnostic kernels, they are updated on every shape change
+struct jit_snippets_runtime_args {
+    // work amounts of the Loops by the dimension index from the innermost one
+    int64_t work_amounts[SNIPPETS_MAX_RUNTIME_WORK_AMOUNTS] = {};
+    // offsets in bytes of the harness dimensions for every input and output
+    int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS * 2][SNIPPETS_MAX_HARNESS_DIMS] = {};
+};
+
 struct jit_snippets_call_args {
     const void *src_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *dst_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *buffer_scratchpad_ptr = nullptr;
+    const jit_snippets_runtime_args *runtime_args = nullptr;
 };
 
 struct jit_snippets_compile_args {
@@ -107,6 +118,8 @@ private:
 
     const size_t reg_indexes_idx;
     const size_t reg_const_params_idx;
+    // true if the Loops work amounts and the data offsets are passed in runtime, reg_const_params is kept for them
+    bool is_shape_agnostic = false;
 };
 
 class LoopBeginEmitter : public jit_emitter {
@@ -127,6 +140,10 @@ private:
     std::shared_ptr<snippets::op::LoopBegin> loop_begin;
     bool evaluate_once = false;
     size_t work_amount = 0; // need to store work_amount explicitly, since two loops can work on the same dim (e.g. vector + scalar)
+    size_t wa_increment = 0;
+    bool runtime_work_amount = false;
+    size_t runtime_work_amount_idx = 0;
+    size_t runtime_work_amount_divisor = 0;
 };
 
 class LoopEndEmitter : public jit_emitter {
@@ -155,7 +172,10 @@ private:
     int64_t wa_increment = 0;
     int64_t work_amount = 0;
     bool evaluate_once = false;
+    bool runtime_work_amount = false;
+    size_t runtime_work_amount_idx = 0;
     std::vector<int64_t> ptr_increments;
+    // per unit of the runtime work amount if it is used
     std::vector<int64_t> finalization_offsets;
 };
 
@@ -12,6 +12,7 @@
 #include "memory_state.h"
 #include "itt.h"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "internal_properties.hpp"
 #include "serialize.h"
 #include "ngraph/type/element_type.hpp"
 #include "nodes/memory.hpp"
@@ -66,12 +67,14 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         const PackedWeights::CPtr& packedWeights) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _network(network),
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _packedWeights(packedWeights) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -80,6 +83,9 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     bool isFloatModel = !ov::op::util::has_op_with_type<ngraph::op::FakeQuantize>(function);
 
     _mutex = std::make_shared<std::mutex>();
+    if (_cfg.sharedRtCache) {
+        _sharedParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity);
+    }
     const auto& core = _plugin->GetCore();
     if (!core)
         IE_THROW() << "Unable to get API version. Core is unavailable";
@@ -139,7 +145,8 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
     if (_graphs.size() == 1) {
-        for (auto &node : GetGraph()._graph.GetNodes()) {
+        auto graphLock = GetGraph();
+        for (auto &node : graphLock._graph.GetNodes()) {
             if (node->getType() == Type::MemoryInput) {
                 auto memoryNode = dynamic_cast<node::MemoryInput*>(node.get());
                 if (!memoryNode) {
@@ -153,7 +160,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new VariableState(state_name, state_store));
+                memoryStates.emplace_back(new VariableState(state_name, state_store, graphLock._graph.getEngine()));
             }
         }
     }
@@ -182,7 +189,13 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                         (_cfg.lpTransformsMode == Config::On) &&
                         ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag);
+                    ctx = std::make_shared<GraphContext>(_cfg,
+                                                         extensionManager,
+                                                         weightsCache,
+                                                         isQuantizedFlag,
+                                                         _packedWeights,
+                                                         _sharedParamsCache,
+                                                         socketId);
                 }
                 graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
@@ -269,6 +282,19 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
 InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const {
     if (_graphs.empty())
         IE_THROW() << "No graph was found";
+
+    // the statistics are collected from the graphs of all the streams, which are locked one by one,
+    // so they must be read before the graph of the current stream is locked
+    if (!_cfg.isLegacyApi) {
+        if (name == ov::intel_cpu::runtime_cache_statistics) {
+            return decltype(ov::intel_cpu::runtime_cache_statistics)::value_type(GetRuntimeCacheStatistics());
+        } else if (name == ov::intel_cpu::shape_infer_cache_statistics) {
+            return decltype(ov::intel_cpu::shape_infer_cache_statistics)::value_type(GetShapeInferCacheStatistics());
+        } else if (name == ov::intel_cpu::telemetry) {
+            return decltype(ov::intel_cpu::telemetry)::value_type(GetTelemetry());
+        }
+    }
+
     // @todo Can't we just use local copy (_cfg) instead?
     auto graphLock = GetGraph();
     const auto& graph = graphLock._graph;
@@ -301,6 +327,12 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::execution_devices.name()),
             RO_property(ov::intel_cpu::denormals_optimization.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+            RO_property(ov::intel_cpu::runtime_cache_statistics.name()),
+            RO_property(ov::intel_cpu::shape_infer_cache_statistics.name()),
+            RO_property(ov::intel_cpu::telemetry.name()),
+            RO_property(ov::intel_cpu::jit_cache_statistics.name()),
+            RO_property(ov::intel_cpu::shared_weights_statistics.name()),
+            RO_property(ov::intel_cpu::packed_weights_statistics.name()),
         };
     }
 
@@ -358,15 +390,115 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(config.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(config.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::jit_cache_statistics) {
+        return decltype(ov::intel_cpu::jit_cache_statistics)::value_type(GetJitCacheStatistics());
+    } else if (name == ov::intel_cpu::shared_weights_statistics) {
+        return decltype(ov::intel_cpu::shared_weights_statistics)::value_type(GetSharedWeightsStatistics());
+    } else if (name == ov::intel_cpu::packed_weights_statistics) {
+        return decltype(ov::intel_cpu::packed_weights_statistics)::value_type(GetPackedWeightsStatistics());
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
     return GetMetricLegacy(name, graph);
 }
 
+std::map<std::string, uint64_t> ExecNetwork::GetRuntimeCacheStatistics() const {
+    MultiCache::Statistics total;
+    auto accumulate = [&total](const MultiCache::Statistics& statistics) {
+        total.hits += statistics.hits;
+        total.misses += statistics.misses;
+        total.evictions += statistics.evictions;
+    };
+
+    for (auto& graph : _graphs) {
+        // the graph may be created by another stream at the moment
+        GraphGuard::Lock graphLock{graph};
+        if (graph.IsReady())
+            accumulate(graph.getGraphContext()->getParamsCacheStatistics());
+    }
+    // the stateless records of all the streams
+    if (_sharedParamsCache)
+        accumulate(_sharedParamsCache->getStatistics());
+
+    return {{"hits", total.hits}, {"misses", total.misses}, {"evictions", total.evictions}};
+}
+
+std::map<std::string, uint64_t> ExecNetwork::GetShapeInferCacheStatistics() const {
+    uint64_t hits = 0, misses = 0, graphHits = 0, graphMisses = 0;
+    // the counters are atomic, so they can be read while the other streams are running
+    for (auto& graph : _graphs) {
+        GraphGuard::Lock graphLock{graph};
+        if (!graph.IsReady())
+            continue;
+        graphHits += graph.getShapeInferCacheHits();
+        graphMisses += graph.getShapeInferCacheMisses();
+        for (const auto& node : graph.GetNodes()) {
+            hits += node->getShapeInferCacheHits();
+            misses += node->getShapeInferCacheMisses();
+        }
+    }
+    return {{"hits", hits}, {"misses", misses}, {"graph_hits", graphHits}, {"graph_misses", graphMisses}};
+}
+
+std::map<std::string, uint64_t> ExecNetwork::GetJitCacheStatistics() const {
+    JitCodeCache::Statistics statistics;
+    if (const auto cache = JitCodeCache::get(_cfg.jitCacheDir))
+        statistics = cache->getStatistics();
+    return {{"hits", statistics.hits},
+            {"misses", statistics.misses},
+            {"stored", statistics.stored},
+            {"not_relocatable", statistics.notRelocatable},
+            {"rejected", statistics.rejected},
+            {"evicted", statistics.evicted},
+            {"jit_time_us", statistics.jitTimeUs},
+            {"saved_time_us", statistics.savedTimeUs},
+            {"relocation_time_us", statistics.relocationTimeUs}};
+}
+
+std::map<std::string, uint64_t> ExecNetwork::GetSharedWeightsStatistics() const {
+    SharedWeightsStore::Statistics statistics;
+    if (_cfg.sharedWeights)
+        statistics = SharedWeightsStore::get(_cfg.sharedWeightsDir)->getStatistics();
+    return {{"hits", statistics.hits}, {"packed", statistics.packed}, {"mapped", statistics.mapped}};
+}
+
+std::map<std::string, uint64_t> ExecNetwork::GetPackedWeightsStatistics() const {
+    PackedWeights::Statistics statistics;
+    if (_packedWeights)
+        statistics = _packedWeights->getStatistics();
+    return {{"stored", statistics.stored}, {"hits", statistics.hits}, {"misses", statistics.misses}};
+}
+
+std::map<std::string, uint64_t> ExecNetwork::GetTelemetry() const {
+    GraphTelemetry::Report report;
+    // the counters are atomic, so they can be read while the other streams are running
+    for (auto& graph : _graphs) {
+        GraphGuard::Lock graphLock{graph};
+        if (graph.IsReady() && graph.getTelemetry())
+            report.accumulate(*graph.getTelemetry());
+    }
+
+    auto result = report.toMap();
+    const auto rtCacheStatistics = GetRuntimeCacheStatistics();
+    result["runtime_cache_hits"] = rtCacheStatistics.at("hits");
+    result["runtime_cache_misses"] = rtCacheStatistics.at("misses");
+    return result;
+}
+
 void ExecNetwork::Export(std::ostream& modelStream) {
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
+
+    // The packed weights are appended after the network, so the import can skip the weights reordering.
+    // The weights of the dynamic nodes are packed on the first inference, so they may be missing.
+    PackedWeights packedWeights;
+    {
+        auto graphLock = GetGraph();
+        for (const auto& node : graphLock._graph.GetNodes()) {
+            node->collectPackedWeights(packedWeights);
+        }
+    }
+    packedWeights.serialize(modelStream);
 }
 
 }   // namespace intel_cpu
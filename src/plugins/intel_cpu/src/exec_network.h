@@ -10,6 +10,7 @@
 #include "graph.h"
 #include "extension_mngr.h"
 #include "graph_context.h"
+#include "packed_weights.h"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
@@ -37,7 +38,8 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                const PackedWeights::CPtr& packedWeights = nullptr);
 
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
@@ -58,6 +60,10 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    // weights reordered by the exported model (if the network is imported)
+    PackedWeights::CPtr                         _packedWeights;
+    // runtime parameters cache shared by all the streams (if enabled)
+    MultiCachePtr                               _sharedParamsCache;
     struct GraphGuard : public Graph {
         std::mutex  _mutex;
         struct Lock : public std::unique_lock<std::mutex> {
@@ -79,6 +85,13 @@ protected:
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
     InferenceEngine::Parameter GetMetricLegacy(const std::string &name, const GraphGuard& graph) const;
+
+    std::map<std::string, uint64_t> GetRuntimeCacheStatistics() const;
+    std::map<std::string, uint64_t> GetShapeInferCacheStatistics() const;
+    std::map<std::string, uint64_t> GetTelemetry() const;
+    std::map<std::string, uint64_t> GetJitCacheStatistics() const;
+    std::map<std::string, uint64_t> GetSharedWeightsStatistics() const;
+    std::map<std::string, uint64_t> GetPackedWeightsStatistics() const;
 };
 
 }   // namespace intel_cpu
@@ -53,6 +53,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_desc.hpp>
 #include <common/primitive_desc_iface.hpp>
+#include <common/primitive_hashing_utils.hpp>
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
 #   include <tbb/task.h>
 #endif
@@ -375,6 +376,16 @@ void Graph::InitGraph() {
 
     const bool hasDynNodes = ProcessDynNodes();
 
+    if (!hasDynNodes && getConfig().enableParallelBranches) {
+        InitParallelBranches();
+        // the in place conflicts were resolved for the sequential order, so they are resolved again for the levels;
+        // the inserted reorders change the levels, hence it is repeated until nothing is inserted
+        while (!parallelLevels.empty() && ResolveEdgeConflicts()) {
+            SortTopologically();
+            InitParallelBranches();
+        }
+    }
+
     Allocate();
 
     CreatePrimitivesAndExecConstants();
@@ -387,6 +398,13 @@ void Graph::InitGraph() {
 
     ExtractExecutableNodes();
 
+    if (getConfig().telemetrySamplingRate > 0) {
+        std::vector<std::string> nodeNames;
+        for (const auto& node : graphNodes)
+            nodeNames.push_back(node->getName());
+        telemetry = std::make_shared<GraphTelemetry>(getConfig().telemetrySamplingRate, nodeNames);
+    }
+
     status = hasDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
 }
 
@@ -479,6 +497,39 @@ void Graph::ExtractExecutableNodes() {
             executableGraphNodes.emplace_back(graphNode);
         }
     }
+
+    if (parallelLevels.empty())
+        return;
+
+    // the nodes that own inner graphs share the sub streams with them, and the in place nodes modify the memory
+    // which may be read by the other nodes, so they are always executed alone
+    auto runsAlone = [](const NodePtr& node) {
+        return one_of(node->getType(), Type::TensorIterator, Type::If) || node->isInPlace();
+    };
+
+    bool hasParallelStages = false;
+    for (size_t begin = 0; begin < executableGraphNodes.size();) {
+        const auto& node = executableGraphNodes[begin];
+        size_t end = begin + 1;
+        if (!runsAlone(node)) {
+            const int levelEnd = parallelLevels[node->execIndex].second;
+            while (end < executableGraphNodes.size() &&
+                   executableGraphNodes[end]->execIndex <= levelEnd &&
+                   !runsAlone(executableGraphNodes[end])) {
+                end++;
+            }
+        }
+        if (end - begin > 1) {
+            hasParallelStages = true;
+            for (size_t i = begin; i < end; i++)
+                executableGraphNodes[i]->parallelStage = static_cast<int>(parallelStages.size());
+        }
+        parallelStages.emplace_back(begin, end);
+        begin = end;
+    }
+
+    if (!hasParallelStages)
+        parallelStages.clear();
 }
 
 void Graph::CreatePrimitivesAndExecConstants() const {
@@ -562,6 +613,20 @@ static bool isReorderAvailable(const MemoryDescPtr& parentDesc, const MemoryDesc
     return dnnl_success == status;
 }
 
+static std::string uniqueReorderName(const EdgePtr& edge, std::unordered_set<std::string>& uniqueLayerNames) {
+    std::string basicLayerName = edge->getParent()->getName() + "_" +
+                                 node::Reorder::getReorderArgs(edge->getInputDesc(), edge->getOutputDesc()) + "_" +
+                                 edge->getChild()->getName();
+    std::string layerName = basicLayerName;
+    int idx = 0;
+    while (uniqueLayerNames.find(layerName) != uniqueLayerNames.end()) {
+        idx++;
+        layerName = basicLayerName + "_" + std::to_string(idx);
+    }
+    uniqueLayerNames.insert(layerName);
+    return layerName;
+}
+
 void Graph::InitEdges() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::InitEdges");
 
@@ -573,19 +638,8 @@ void Graph::InitEdges() {
     }
 
     auto insertReorder = [&](EdgePtr& edge, bool isOptimized) {
-        std::string basicLayerName = edge->getParent()->getName() + "_" +
-                                     node::Reorder::getReorderArgs(edge->getInputDesc(), edge->getOutputDesc()) + "_" +
-                                     edge->getChild()->getName();
-        std::string layerName = basicLayerName;
-        int idx = 0;
-        while (uniqueLayerNames.find(layerName) != uniqueLayerNames.end()) {
-            idx++;
-            layerName = basicLayerName + "_" + std::to_string(idx);
-        }
-        uniqueLayerNames.insert(layerName);
-
         // optimized flag indicate that just desc update w/o actual physical memory movement.
-        InsertReorder(edge, layerName, edge->getInputDesc(), edge->getOutputDesc(), isOptimized);
+        InsertReorder(edge, uniqueReorderName(edge, uniqueLayerNames), edge->getInputDesc(), edge->getOutputDesc(), isOptimized);
     };
 
     auto updateEdge = [&](ptrdiff_t& i) {
@@ -633,12 +687,30 @@ void Graph::InitEdges() {
     }
 
     // secondary pass to eliminate complex implace conflicts
-    auto needReorder = [](const EdgePtr& edge) -> bool {
+    ResolveEdgeConflicts();
+}
+
+bool Graph::ResolveEdgeConflicts() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ResolveEdgeConflicts");
+
+    std::unordered_set<std::string> uniqueLayerNames;
+    for (auto node : graphNodes) {
+        uniqueLayerNames.insert(node->getName());
+    }
+
+    // when the independent branches are executed in parallel, the node runs simultaneously with the whole level,
+    // so the memory it modifies in place must not be read by the other nodes of the level either
+    auto firstConcurrentIndex = [this](const NodePtr& node) {
+        const int execIndex = node->getExecIndex();
+        return parallelLevels.empty() || execIndex < 0 ? execIndex : parallelLevels[execIndex].first;
+    };
+
+    auto needReorder = [&](const EdgePtr& edge) -> bool {
         int inNumber = edge->getInputNum();
         const auto portChildEdges = edge->getParent()->getChildEdgesAtPort(inNumber);
         if (portChildEdges.size() > 1) {
             if (auto modifyingNode = edge->modifiedInPlace()) {
-                auto execIndex = modifyingNode->getExecIndex();
+                auto execIndex = firstConcurrentIndex(modifyingNode);
                 for (auto pEdgePeer : portChildEdges) {
                     if (pEdgePeer == edge)
                         continue;
@@ -656,16 +728,20 @@ void Graph::InitEdges() {
         return false;
     };
 
-    numberOfEdges = graphEdges.size(); //update the total number
-
+    bool inserted = false;
+    ptrdiff_t numberOfEdges = static_cast<ptrdiff_t>(graphEdges.size());
     for (ptrdiff_t i = 0; i < numberOfEdges; i++) {
         auto edge = graphEdges[i];
         if (needReorder(edge)) {
             constexpr bool optimizedReorder = false;
-            insertReorder(edge, optimizedReorder);
-            updateEdge(i);
+            InsertReorder(edge, uniqueReorderName(edge, uniqueLayerNames), edge->getInputDesc(), edge->getOutputDesc(), optimizedReorder);
+            graphEdges.erase(graphEdges.begin() + i);
+            i--;
+            numberOfEdges--;
+            inserted = true;
         }
     }
+    return inserted;
 }
 
 static inline bool isConstOutput(EdgePtr edge) {
@@ -757,6 +833,13 @@ void Graph::AllocateWithReuse() {
             int e_start = edge->getParent()->execIndex;
             int e_finish = edge->getChild()->execIndex;
 
+            if (!parallelLevels.empty()) {
+                // the nodes of one level are executed simultaneously, so the memory must be kept
+                // during the whole levels of the producer and the consumer
+                e_start = parallelLevels[e_start].first;
+                e_finish = parallelLevels[e_finish].second;
+            }
+
             if (boxSize != -1 && edge->getDesc().isDefined()) {
                 int64_t e_size = edge->getDesc().getCurrentMemSize();  // size in bytes (from the beginning of data to the last element)
                 boxSize = std::max(e_size, boxSize);
@@ -881,9 +964,33 @@ void Graph::AllocateWithReuse() {
 
         MemorySolver::normalizeBoxes(undefinedBoxes);
 
+        if (getConfig().dynamicMemoryPlanning) {
+            // the intermediate tensors take the memory from the arena planned for the current input shapes,
+            // the input and output tensors are shared with the infer request, so they are kept in the groups
+            auto isIntermediate = [&](const MemorySolver::Box& box) {
+                const auto& cluster = edge_clusters[box.id];
+                return std::all_of(cluster.begin(), cluster.end(), [](const EdgePtr& edge) {
+                    return edge->getParent()->getType() != Type::Input && edge->getChild()->getType() != Type::Output;
+                });
+            };
+            auto intermediateEnd = std::stable_partition(undefinedBoxes.begin(), undefinedBoxes.end(), isIntermediate);
+            if (intermediateEnd != undefinedBoxes.begin()) {
+                dynMemPlanner = std::make_shared<DynamicMemoryPlanner>();
+                for (auto box = undefinedBoxes.begin(); box != intermediateEnd; ++box) {
+                    auto memMngr = dynMemPlanner->addBlock(*box);
+                    for (auto& edge : edge_clusters[box->id]) {
+                        if (edge->getStatus() == Edge::Status::NeedAllocation) {
+                            edge->allocate(memMngr);
+                        }
+                    }
+                }
+            }
+            undefinedBoxes.erase(undefinedBoxes.begin(), intermediateEnd);
+        }
+
         std::vector<std::vector<MemorySolver::Box>> groups; //groups of nonoverlapping boxes
         constexpr bool enableMemReuse = true; // set false to disable mem reuse for debug purposes
-        if (enableMemReuse) {
+        if (enableMemReuse && !undefinedBoxes.empty()) {
             groups.push_back({undefinedBoxes.front()});
             for (size_t i = 1; i < undefinedBoxes.size(); ++i) {
                 const auto& box = undefinedBoxes[i];
@@ -950,6 +1057,67 @@ void Graph::AllocateWithReuse() {
     }
 }
 
+void Graph::InitParallelBranches() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::InitParallelBranches");
+    parallelLevels.clear();
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    const int numSubStreams = context->getScratchPadsCount();
+    if (numSubStreams < 2)
+        return;
+
+    // the order of the state read and write operations must be preserved
+    for (const auto& node : graphNodes) {
+        if (one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput))
+            return;
+    }
+
+    // The level of a node is the length of the longest path to the node from the graph inputs
+    // (constant subgraphs are computed on the graph creation and do not count).
+    // So the nodes of the same level do not depend on each other and may be executed simultaneously.
+    std::vector<int> levels(graphNodes.size(), 0);
+    for (const auto& node : graphNodes) {
+        int level = 0;
+        if (!node->isConstant()) {
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                const auto parent = node->getParentEdgeAt(i)->getParent();
+                if (!parent->isConstant())
+                    level = std::max(level, levels[parent->execIndex] + 1);
+            }
+        }
+        levels[node->execIndex] = level;
+    }
+
+    // ordering by level is also a topological order
+    std::stable_sort(graphNodes.begin(), graphNodes.end(), [&levels](const NodePtr& lhs, const NodePtr& rhs) {
+        return levels[lhs->execIndex] < levels[rhs->execIndex];
+    });
+
+    std::vector<int> sortedLevels(graphNodes.size());
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        sortedLevels[i] = levels[graphNodes[i]->execIndex];
+        graphNodes[i]->execIndex = static_cast<int>(i);
+    }
+
+    parallelLevels.resize(graphNodes.size());
+    for (size_t first = 0; first < graphNodes.size();) {
+        size_t last = first;
+        while (last + 1 < graphNodes.size() && sortedLevels[last + 1] == sortedLevels[first])
+            last++;
+
+        // the sub stream defines the scratch pad used by the node, so the nodes of one level executed
+        // by different threads never share it
+        int subStreamID = 0;
+        for (size_t i = first; i <= last; i++) {
+            parallelLevels[i] = {static_cast<int>(first), static_cast<int>(last)};
+            const auto& node = graphNodes[i];
+            if (!node->isConstant() && !one_of(node->getType(), Type::Input, Type::Output))
+                node->subStreamID = subStreamID++ % numSubStreams;
+        }
+        first = last + 1;
+    }
+#endif
+}
+
 void Graph::Allocate() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::Allocate");
 
@@ -1120,6 +1288,11 @@ void Graph::PullOutputData(BlobMap &out) {
 }
 
 void Graph::InferStatic(InferRequestBase* request) {
+    if (!parallelStages.empty()) {
+        InferParallelStages(request);
+        return;
+    }
+
     dnnl::stream stream(getEngine());
 
     for (const auto& node : executableGraphNodes) {
@@ -1132,6 +1305,38 @@ void Graph::InferStatic(InferRequestBase* request) {
     }
 }
 
+void Graph::InferParallelStages(InferRequestBase* request) {
+    dnnl::stream stream(getEngine());
+
+    for (const auto& stage : parallelStages) {
+        if (request)
+            request->ThrowIfCanceled();
+
+        const size_t stageSize = stage.second - stage.first;
+        if (stageSize == 1) {
+            const auto& node = executableGraphNodes[stage.first];
+            VERBOSE(node, getConfig().debugCaps.verbose);
+            PERF(node, getConfig().collectPerfCounters);
+            ExecuteNode(node, stream);
+            continue;
+        }
+
+        // all the nodes of the same sub stream are executed by the same thread one by one
+        const int numThreads = std::min(static_cast<int>(stageSize), context->getScratchPadsCount());
+        parallel_nt(numThreads, [&](const int ithr, const int nthr) {
+            dnnl::stream subStream(getEngine());
+            for (size_t i = stage.first; i < stage.second; i++) {
+                const auto& node = executableGraphNodes[i];
+                if (node->subStreamID % nthr != ithr)
+                    continue;
+                VERBOSE(node, getConfig().debugCaps.verbose);
+                PERF(node, getConfig().collectPerfCounters);
+                ExecuteNode(node, subStream);
+            }
+        });
+    }
+}
+
 namespace {
 
 class IUpdateNodes {
@@ -1140,15 +1345,37 @@ public:
     virtual ~IUpdateNodes() = default;
 };
 
+// the output dims memoized by the graph for the node or null if the node runs the shape inference itself
+using CachedOutputDims = std::vector<Node::OutputDimsPtr>;
+
+inline const Node::OutputDimsPtr* cachedNodeDims(const CachedOutputDims* cachedDims, size_t node_indx) {
+    return cachedDims && node_indx < cachedDims->size() ? &(*cachedDims)[node_indx] : nullptr;
+}
+
+inline void updateNodeShapes(const NodePtr& node, const Node::OutputDimsPtr* cachedDims, GraphTelemetry* telemetry) {
+    TelemetryScope scope(nullptr, telemetry ? &telemetry->updateShapesTime : nullptr);
+    if (cachedDims) {
+        node->updateShapes(*cachedDims);
+    } else {
+        node->updateShapes();
+    }
+}
+
+inline void updateNodeDynamicParams(const NodePtr& node, GraphTelemetry* telemetry) {
+    TelemetryScope scope(nullptr, telemetry ? &telemetry->prepareParamsTime : nullptr);
+    node->updateDynamicParams();
+}
+
 class UpdateNodesSeq : public IUpdateNodes {
 public:
-    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes) : m_executableGraphNodes(executableGraphNodes) {}
+    UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes, const CachedOutputDims* cachedDims, GraphTelemetry* telemetry)
+        : m_executableGraphNodes(executableGraphNodes), m_cachedDims(cachedDims), m_telemetry(telemetry) {}
     void run(size_t stopIndx) override {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = m_executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
-                node->updateDynamicParams();
+                updateNodeShapes(node, cachedNodeDims(m_cachedDims, prepareCounter), m_telemetry);
+                updateNodeDynamicParams(node, m_telemetry);
             }
         }
     }
@@ -1156,6 +1383,8 @@ public:
 private:
     size_t prepareCounter = 0;
     std::vector<NodePtr>& m_executableGraphNodes;
+    const CachedOutputDims* m_cachedDims;
+    GraphTelemetry* m_telemetry;
 };
 
 #if (OV_THREAD == OV_THREAD_SEQ)
@@ -1165,13 +1394,14 @@ private:
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_OMP)
 class UpdateNodesBase : public IUpdateNodes {
 public:
-    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes) : m_executableGraphNodes(executableGraphNodes) {}
+    UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes, const CachedOutputDims* cachedDims, GraphTelemetry* telemetry)
+        : m_executableGraphNodes(executableGraphNodes), m_cachedDims(cachedDims), m_telemetry(telemetry) {}
     void updateShapes(size_t node_indx, size_t stop_indx) {
         try {
             for (size_t i = node_indx; i < stop_indx; i++) {
                 const auto& node = m_executableGraphNodes[i];
                 if (node->isDynamicNode()) {
-                    node->updateShapes();
+                    updateNodeShapes(node, cachedNodeDims(m_cachedDims, i), m_telemetry);
                 }
                 m_prepareCounter.store(i, std::memory_order::memory_order_release);
             }
@@ -1195,7 +1425,7 @@ public:
             while (local_counter < prepareCounter) {
                 const auto& node = m_executableGraphNodes[local_counter++];
                 if (node->isDynamicNode()) {
-                    node->updateDynamicParams();
+                    updateNodeDynamicParams(node, m_telemetry);
                 }
             }
         }
@@ -1205,6 +1435,8 @@ protected:
     std::atomic<size_t> m_prepareCounter{0};
     std::atomic<bool> m_completion{false};
     std::vector<NodePtr>& m_executableGraphNodes;
+    const CachedOutputDims* m_cachedDims;
+    GraphTelemetry* m_telemetry;
 };
 
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
@@ -1328,6 +1560,16 @@ public:
 } // namespace
 
 
+size_t Graph::InputShapesKey::hash() const {
+    size_t seed = 0;
+    for (const auto& dims : inputDims) {
+        seed = dnnl::impl::hash_combine(seed, dims.size());
+        for (const auto dim : dims)
+            seed = dnnl::impl::hash_combine(seed, dim);
+    }
+    return seed;
+}
+
 void Graph::InferDynamic(InferRequestBase* request) {
     dnnl::stream stream(getEngine());
 
@@ -1340,11 +1582,47 @@ void Graph::InferDynamic(InferRequestBase* request) {
     }
     syncIndsWorkSet.insert(executableGraphNodes.size());
 
+    const auto cacheCapacity = getConfig().shapeInferCacheCapacity;
+    if (dynMemPlanner || cacheCapacity != 0) {
+        // the dims are assigned to the vectors of the previous inference, so they are not reallocated
+        auto& inputDims = shapeInferLookupKey.inputDims;
+        inputDims.resize(inputNodesMap.size());
+        size_t inputIndx = 0;
+        for (const auto& input : inputNodesMap) {
+            const auto& node = input.second;
+            if (node->getChildEdges().empty())
+                continue;
+            const auto& shape = node->getChildEdgeAt(0)->getMemory().getShape();
+            auto& dims = inputDims[inputIndx++];
+            if (shape.isStatic()) {
+                dims = shape.getStaticDims();
+            } else {
+                dims.clear();
+            }
+        }
+        inputDims.resize(inputIndx);
+        if (dynMemPlanner)
+            dynMemPlanner->beginInfer(inputDims);
+    }
+
+    // the output shapes of the nodes before the first synchronization node depend on the graph input shapes only
+    std::shared_ptr<const NodesOutputDims> cachedDims;
+    if (cacheCapacity != 0) {
+        if (!shapeInferCache)
+            shapeInferCache.reset(new LruCache<InputShapesKey, std::shared_ptr<const NodesOutputDims>>(cacheCapacity));
+        cachedDims = shapeInferCache->get(shapeInferLookupKey);
+        if (cachedDims) {
+            shapeInferCacheHits.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            shapeInferCacheMisses.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
     std::unique_ptr<IUpdateNodes> updateNodes{};
     if (parallel_get_max_threads() > 1) {
-        updateNodes.reset(new UpdateNodes(executableGraphNodes));
+        updateNodes.reset(new UpdateNodes(executableGraphNodes, cachedDims.get(), sampledTelemetry));
     } else {
-        updateNodes.reset(new UpdateNodesSeq(executableGraphNodes));
+        updateNodes.reset(new UpdateNodesSeq(executableGraphNodes, cachedDims.get(), sampledTelemetry));
     }
     size_t inferCounter = 0;
 
@@ -1360,6 +1638,24 @@ void Graph::InferDynamic(InferRequestBase* request) {
             ExecuteNode(node, stream);
         }
     }
+
+    if (dynMemPlanner)
+        dynMemPlanner->endInfer();
+
+    if (cacheCapacity != 0 && !cachedDims) {
+        // the nodes memoize the output dims unless their shape inference was skipped
+        const size_t cachedNodes = *syncIndsWorkSet.begin();
+        auto nodesDims = std::make_shared<NodesOutputDims>(cachedNodes);
+        for (size_t i = 0; i < cachedNodes; ++i) {
+            const auto& node = executableGraphNodes[i];
+            if (!node->isDynamicNode())
+                continue;
+            (*nodesDims)[i] = node->getMemoizedOutputDims();
+            if (!(*nodesDims)[i])
+                return;
+        }
+        shapeInferCache->put(shapeInferLookupKey, nodesDims);
+    }
 }
 
 inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const {
@@ -1367,6 +1663,10 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
 
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, node->profiling.execute);
     DEBUG_LOG(*node);
+    TelemetryScope telemetryScope(sampledTelemetry ? sampledTelemetry->nodeLatency(static_cast<size_t>(node->getExecIndex())) : nullptr,
+                                  sampledTelemetry ? &sampledTelemetry->executeTime : nullptr);
+    if (sampledTelemetry && node->getType() == Type::Reorder)
+        sampledTelemetry->reorderExecutions.fetch_add(1, std::memory_order_relaxed);
     if (node->isDynamicNode()) {
         node->executeDynamic(stream);
     } else {
@@ -1379,13 +1679,18 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Wrong state of the ov::intel_cpu::Graph. Topology is not ready.";
     }
 
-    if (Status::ReadyDynamic == status) {
-        InferDynamic(request);
-    } else if (Status::ReadyStatic == status) {
-        InferStatic(request);
-    } else {
-        IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
+    sampledTelemetry = telemetry && telemetry->sample() ? telemetry.get() : nullptr;
+    {
+        TelemetryScope telemetryScope(sampledTelemetry ? &sampledTelemetry->requestLatency() : nullptr, nullptr);
+        if (Status::ReadyDynamic == status) {
+            InferDynamic(request);
+        } else if (Status::ReadyStatic == status) {
+            InferStatic(request);
+        } else {
+            IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
+        }
     }
+    sampledTelemetry = nullptr;
 
     if (infer_count != -1) infer_count++;
 }
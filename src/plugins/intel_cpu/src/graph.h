@@ -20,6 +20,8 @@
 #include <atomic>
 
 #include "proxy_mem_mgr.h"
+#include "dynamic_mem_planner.h"
+#include "telemetry.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -194,6 +196,17 @@ public:
 
     Status getStatus() const {return status;}
 
+    const GraphTelemetry::Ptr& getTelemetry() const {
+        return telemetry;
+    }
+
+    uint64_t getShapeInferCacheHits() const {
+        return shapeInferCacheHits.load(std::memory_order_relaxed);
+    }
+    uint64_t getShapeInferCacheMisses() const {
+        return shapeInferCacheMisses.load(std::memory_order_relaxed);
+    }
+
 protected:
     void VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes);
 
@@ -206,6 +219,11 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        parallelLevels.clear();
+        parallelStages.clear();
+        dynMemPlanner.reset();
+        telemetry.reset();
+        shapeInferCache.reset();
     }
     Status status { Status::NotReady };
 
@@ -216,6 +234,10 @@ protected:
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
+    DynamicMemoryPlanner::Ptr dynMemPlanner;
+    GraphTelemetry::Ptr telemetry;
+    // the telemetry of the running inference, null if the inference is not sampled
+    GraphTelemetry* sampledTelemetry = nullptr;
 
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
@@ -233,13 +255,16 @@ protected:
     void ResolveInplaceDirections();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
+    bool ResolveEdgeConflicts();
     bool ProcessDynNodes();
+    void InitParallelBranches();
     void Allocate();
     void AllocateWithReuse();
     void ExtractExecutableNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void CreatePrimitivesAndExecConstants() const;
     void InferStatic(InferRequestBase* request);
+    void InferParallelStages(InferRequestBase* request);
     void InferDynamic(InferRequestBase* request);
 
     friend class LegacyInferRequest;
@@ -259,8 +284,33 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<NodePtr> executableGraphNodes;
 
+    // [first, last] execution indices of the level of independent nodes each node belongs to (indexed by execIndex).
+    // Empty unless the independent branches of the graph are executed in parallel.
+    std::vector<std::pair<int, int>> parallelLevels;
+    // [begin, end) ranges of executableGraphNodes, the nodes inside a range are executed simultaneously
+    std::vector<std::pair<size_t, size_t>> parallelStages;
+
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    struct InputShapesKey {
+        std::vector<VectorDims> inputDims;
+
+        size_t hash() const;
+        bool operator==(const InputShapesKey& rhs) const {
+            return inputDims == rhs.inputDims;
+        }
+    };
+    // the output dims of the executable nodes preceding the first synchronization node (null for the static nodes),
+    // they depend on the graph input shapes only
+    using NodesOutputDims = std::vector<Node::OutputDimsPtr>;
+
+    // the output dims of the nodes memoized for the graph input shapes, so the repeated input shapes are applied to
+    // all the nodes by one lookup and the nodes cache is used only for the nodes after the synchronization nodes
+    std::unique_ptr<LruCache<InputShapesKey, std::shared_ptr<const NodesOutputDims>>> shapeInferCache;
+    InputShapesKey shapeInferLookupKey;
+    std::atomic<uint64_t> shapeInferCacheHits{0};
+    std::atomic<uint64_t> shapeInferCacheMisses{0};
+
     GraphContext::CPtr context;
 
     void EnforceInferencePrecision();
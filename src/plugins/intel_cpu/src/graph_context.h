@@ -4,11 +4,17 @@
 
 #pragma once
 
+#include "cache/jit_code_cache.h"
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
 #include "extension_mngr.h"
+#include "packed_weights.h"
+#include "shared_weights_store.h"
 #include "weights_cache.hpp"
+#include "ie_parallel.hpp"
+
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
@@ -21,13 +27,28 @@ public:
     GraphContext(const Config& config,
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 PackedWeights::CPtr packedWeights = nullptr,
+                 MultiCachePtr sharedParamsCache = nullptr,
+                 int numaNodeId = 0)
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
-          isGraphQuantizedFlag(isGraphQuantized) {
-        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
-        rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
+          packedWeights(packedWeights),
+          isGraphQuantizedFlag(isGraphQuantized),
+          numaNodeId(numaNodeId) {
+        if (config.sharedWeights)
+            sharedWeights = SharedWeightsStore::get(config.sharedWeightsDir);
+        jitCodeCache = JitCodeCache::get(config.jitCacheDir);
+        // nodes executed simultaneously must share neither the scratch pad memory nor the cached executors
+        // (some of them keep working buffers), so a separate scratch pad and a separate primitive cache are
+        // created per each thread that can run an independent branch of the graph.
+        // Only the stateless records are forwarded to the cache shared between the streams.
+        const int numSubStreams = config.enableParallelBranches ? std::max(1, parallel_get_max_threads()) : 1;
+        for (int i = 0; i < numSubStreams; i++) {
+            rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(eng));
+            rtParamsCaches.push_back(std::make_shared<MultiCache>(config.rtCacheCapacity, sharedParamsCache));
+        }
     }
 
     const Config& getConfig() const {
@@ -42,13 +63,48 @@ public:
         return weightsCache;
     }
 
+    PackedWeights::CPtr getPackedWeights() const {
+        return packedWeights;
+    }
+
+    SharedWeightsStore::Ptr getSharedWeights() const {
+        return sharedWeights;
+    }
+
+    int getNumaNodeId() const {
+        return numaNodeId;
+    }
+
+    MultiCachePtr getParamsCache(int subStreamID = 0) const {
+        IE_ASSERT(subStreamID >= 0 && static_cast<size_t>(subStreamID) < rtParamsCaches.size())
+            << "Primitive cache index " << subStreamID << " is out of range";
+        return rtParamsCaches[subStreamID];
+    }
+
+    // the statistics of the caches owned by the graph, the shared cache is not included
+    MultiCache::Statistics getParamsCacheStatistics() const {
+        MultiCache::Statistics total;
+        for (const auto& cache : rtParamsCaches) {
+            const auto statistics = cache->getStatistics();
+            total.hits += statistics.hits;
+            total.misses += statistics.misses;
+            total.evictions += statistics.evictions;
+        }
+        return total;
+    }
+
+    JitCodeCache::Ptr getJitCodeCache() const {
+        return jitCodeCache;
+    }
 
-    MultiCachePtr getParamsCache() const {
-        return rtParamsCache;
+    DnnlScratchPadPtr getScratchPad(int subStreamID = 0) const {
+        IE_ASSERT(subStreamID >= 0 && static_cast<size_t>(subStreamID) < rtScratchPads.size())
+            << "Scratch pad index " << subStreamID << " is out of range";
+        return rtScratchPads[subStreamID];
     }
 
-    DnnlScratchPadPtr getScratchPad() const {
-        return rtScratchPad;
+    int getScratchPadsCount() const {
+        return static_cast<int>(rtScratchPads.size());
     }
 
     dnnl::engine getEngine() const {
@@ -64,11 +120,15 @@ private:
 
     ExtensionManager::Ptr extensionManager;
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
+    PackedWeights::CPtr packedWeights;        // weights reordered by the exported model
+    SharedWeightsStore::Ptr sharedWeights;    // weights shared by the compiled models (nullptr if disabled)
 
-    MultiCachePtr rtParamsCache;     // primitive cache
-    DnnlScratchPadPtr rtScratchPad;  // scratch pad
+    std::vector<MultiCachePtr> rtParamsCaches;     // primitive caches (one per parallel sub stream)
+    JitCodeCache::Ptr jitCodeCache;  // persistent cache of the generated kernels (nullptr if disabled)
+    std::vector<DnnlScratchPadPtr> rtScratchPads;  // scratch pads (one per parallel sub stream)
 
     bool isGraphQuantizedFlag = false;
+    int numaNodeId = 0;
     static dnnl::engine eng;  // onednn engine (singleton)
 };
 
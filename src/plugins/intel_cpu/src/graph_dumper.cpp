@@ -5,6 +5,7 @@
 #include "graph_dumper.h"
 
 #include "utils/debug_capabilities.h"
+#include "nodes/tensoriterator.h"
 #include <ie_ngraph_utils.hpp>
 #include "exec_graph_info.hpp"
 #include "ie_common.h"
@@ -108,6 +109,17 @@ std::map<std::string, std::string> extract_node_metadata(const NodePtr &node) {
 
     serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
 
+    // the nodes with the same value are executed simultaneously as independent branches
+    if (node->getParallelStage() >= 0)
+        serialization_info["parallelStage"] = std::to_string(node->getParallelStage());
+
+    // the body ports of TensorIterator/Loop which are bound to the external buffers without copying
+    if (node->getType() == Type::TensorIterator) {
+        const auto tensorIterator = std::static_pointer_cast<node::TensorIterator>(node);
+        serialization_info["boundViews"] = std::to_string(tensorIterator->getBoundViewsCount());
+        serialization_info["swappedBackEdges"] = std::to_string(tensorIterator->getSwappedBackEdgesCount());
+    }
+
     return serialization_info;
 }
 
@@ -286,11 +286,17 @@ void GraphOptimizer::FuseConvMatmulFCDeconvAndDQScales(Graph &graph) {
 }
 
 void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
-    const std::set<InferenceEngine::Precision> supportedWeightsPrecisions{InferenceEngine::Precision::U8};
+    const std::set<InferenceEngine::Precision> supportedWeightsPrecisions{InferenceEngine::Precision::U8, InferenceEngine::Precision::I8};
     const std::set<InferenceEngine::Precision> supportedDataPrecisions{InferenceEngine::Precision::FP32, InferenceEngine::Precision::BF16};
     auto expectedNode = [](NodePtr node, Type expectedType) {
         return node->getType() == expectedType && node->getChildEdges().size() == 1;
     };
+    // u4/i4 weights are unpacked to u8/i8 by ConvertPrecision, so their decompression is marked by MarkLowBitWeightsDecompression.
+    // Such weights are packed back into nibbles by FullyConnected which also supports group-wise decompression.
+    auto isLowBitWeights = [](const NodePtr& convertNode) {
+        const auto *convert = dynamic_cast<node::Convert *>(convertNode.get());
+        return convert && convert->isLowBitWeightsDecompression();
+    };
 
     if (!impl::cpu::x64::mayiuse(impl::cpu::x64::avx2))
         return;
@@ -304,8 +310,13 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
         const auto parent = fcNode->getParentEdgesAtPort(1)[0]->getParent();
         const bool withTranspose = parent->getType() == Type::Transpose;
         const NodePtr transposeNode = withTranspose ? parent : nullptr;
+        // Group-wise decompression: [OC, G, IC / G] weights are reshaped to [OC, IC] after the decompression
+        const bool withReshape = parent->getType() == Type::Reshape;
+        const NodePtr reshapeNode = withReshape ? parent : nullptr;
+        if (withReshape && !expectedNode(reshapeNode, Type::Reshape))
+            continue;
 
-        const auto multiplyNode = withTranspose ? parent->getParentEdgesAtPort(0)[0]->getParent() : parent;
+        const auto multiplyNode = withTranspose || withReshape ? parent->getParentEdgesAtPort(0)[0]->getParent() : parent;
         if (!expectedNode(multiplyNode, Type::Eltwise) || multiplyNode->getAlgorithm() != Algorithm::EltwiseMultiply ||
             !multiplyNode->isConstant())
             continue;
@@ -341,7 +352,12 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
             continue;
         if (supportedDataPrecisions.find(fcNode->getOriginalInputPrecisionAtPort(0)) == supportedDataPrecisions.end())
             continue;
-        if (supportedWeightsPrecisions.find(weightsNode->getOriginalOutputPrecisionAtPort(0)) == supportedWeightsPrecisions.end())
+        const auto weightsPrecision = weightsNode->getOriginalOutputPrecisionAtPort(0);
+        if (supportedWeightsPrecisions.find(weightsPrecision) == supportedWeightsPrecisions.end())
+            continue;
+        // oneDNN supports u8 weights only, the rest is handled by the low-bit weights decompression kernel
+        const bool lowBitWeights = isLowBitWeights(convertNode);
+        if (!lowBitWeights && (weightsPrecision != Precision::U8 || withReshape))
             continue;
 
         // Shape limitations
@@ -350,15 +366,24 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
         if (weightsShape != fcInputWeightsShape)
             continue;
 
-        const auto expectedDims = withTranspose ? VectorDims{1, weightsShape.getDims()[1]}
-                                                 : VectorDims{weightsShape.getDims()[0], 1};
+        VectorDims expectedDims;
+        if (withReshape) {
+            const auto& weightsDims = weightsShape.getDims();
+            if (weightsDims.size() != 3 ||
+                reshapeNode->getOutputShapeAtPort(0).getDims() != VectorDims{weightsDims[0], weightsDims[1] * weightsDims[2]})
+                continue;
+            expectedDims = VectorDims{weightsDims[0], weightsDims[1], 1};
+        } else {
+            expectedDims = withTranspose ? VectorDims{1, weightsShape.getDims()[1]}
+                                         : VectorDims{weightsShape.getDims()[0], 1};
+        }
         if (multiplyConstNode->getOutputShapeAtPort(0).getDims() != expectedDims)
             continue;
         if (withSubtract && subtractConstNode->getOutputShapeAtPort(0).getDims() != expectedDims)
             continue;
 
         // HW specific shape limitations
-        if (impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core_amx)) {
+        if (!lowBitWeights && impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core_amx)) {
             // OneDNN AMX IP implementation has limited shapes support due to performance considerations. As a current solution conditions below are copied
             // from OneDNN to make sure correct IP impl will be used since fallback one doesn't support weights decompression feature.
             size_t OC = withTranspose ? weightsShape.getDims()[1] : weightsShape.getDims()[0];
@@ -376,6 +401,7 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
         fcNode->fuseDecompressionMultiply(multiplyConstNode);
         if (withSubtract)
             fcNode->fuseDecompressionSubtract(subtractConstNode);
+        fcNode->keepWeightsLowBit(lowBitWeights);
 
         fcNode->addOriginalLayer(multiplyNode->getOriginalLayers());
         fcNode->addOriginalLayer(convertNode->getOriginalLayers());
@@ -393,11 +419,14 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
             graph.DropNode(subtractNode);
         graph.DropNode(multiplyNode);
 
-        const auto& weightsPrecision = weightsNode->getOriginalOutputPrecisionAtPort(0);
         if (withTranspose) {
             transposeNode->setOriginalInputPrecisionAtPort(0, weightsPrecision);
             transposeNode->setOriginalOutputPrecisionAtPort(0, weightsPrecision);
         }
+        if (withReshape) {
+            reshapeNode->setOriginalInputPrecisionAtPort(0, weightsPrecision);
+            reshapeNode->setOriginalOutputPrecisionAtPort(0, weightsPrecision);
+        }
         fcNode->setOriginalInputPrecisionAtPort(1, weightsPrecision);
     }
 }
@@ -59,7 +59,7 @@ void InferRequestBase::CreateInferRequest() {
             if (suffix_idx != std::string::npos)
                 state_name = state_name.substr(0, suffix_idx);
 
-            memoryStates.emplace_back(new VariableState(state_name, state_store));
+            memoryStates.emplace_back(new VariableState(state_name, state_store, graph->getEngine()));
         }
     }
 }
@@ -105,12 +105,10 @@ void InferRequestBase::PushStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<VariableState>(state);
+                    IE_ASSERT(cur_state);
+                    // the graph reads and writes the state memory of this request directly
+                    cur_node->bindState(cur_state->getCurrent(), cur_state->getNext());
                 }
             }
         }
@@ -127,12 +125,9 @@ void InferRequestBase::PullStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<VariableState>(state);
+                    IE_ASSERT(cur_state);
+                    cur_state->swap();
                 }
             }
         }
@@ -0,0 +1,129 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for internal properties of the CPU plugin, which are not a part of the public API
+ * @file internal_properties.hpp
+ */
+
+#pragma once
+
+#include "openvino/runtime/properties.hpp"
+
+#include <map>
+#include <string>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Enables the simultaneous execution of the independent branches of the graph (static shapes only).
+ * The nodes that do not depend on each other are grouped into stages, and the nodes of a stage are executed
+ * in parallel within the threads budget of the stream.
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_parallel_branches{"CPU_ENABLE_PARALLEL_BRANCHES"};
+
+/**
+ * @brief Makes all the streams of a compiled model share one cache of the stateless runtime parameters (oneDNN
+ * primitives and executors), so the same primitives are not compiled and stored by every stream. The executors
+ * keeping working buffers are still cached per stream. The cache capacity limits the shared cache as well.
+ */
+static constexpr Property<bool, PropertyMutability::RW> shared_runtime_cache{"CPU_SHARED_RUNTIME_CACHE"};
+
+/**
+ * @brief Every stream of the compiled model gets own infer requests queue and the idle streams steal the requests
+ * of the busy ones (the streams of the same NUMA node first), instead of all the streams contending for one queue.
+ */
+static constexpr Property<bool, PropertyMutability::RW> streams_work_stealing{"CPU_STREAMS_WORK_STEALING"};
+
+/**
+ * @brief Number of the shape inference results memoized by the graph and by every dynamic node (0 disables the cache).
+ * When the graph input shapes repeat (e.g. bucketed sequence lengths), the output shapes of all the nodes preceding the
+ * first node with the data dependent output shapes are taken from the graph cache by one lookup. The following nodes
+ * use their own caches keyed by the node input shapes, the nodes with the data dependent output shapes are not cached.
+ */
+static constexpr Property<size_t, PropertyMutability::RW> shape_infer_cache_capacity{"CPU_SHAPE_INFER_CACHE_CAPACITY"};
+
+/**
+ * @brief Enables the memory planning of the dynamic intermediate tensors: for every observed set of the input shapes
+ * the tensors are placed into one arena by the memory solver like the static ones, the plan is cached and
+ * reused when the input shapes repeat, so there are no reallocations in the steady state.
+ */
+static constexpr Property<bool, PropertyMutability::RW> dynamic_memory_planning{"CPU_DYNAMIC_MEMORY_PLANNING"};
+
+/**
+ * @brief Enables the runtime telemetry of a compiled model sampled on every N-th inference of a stream (0 disables
+ * the telemetry). The sampled inferences collect the request and per node latency histograms and the time spent
+ * in the shape inference, the dynamic parameters preparation and the execution.
+ */
+static constexpr Property<int32_t, PropertyMutability::RW> telemetry_sampling_rate{"CPU_TELEMETRY_SAMPLING_RATE"};
+
+/**
+ * @brief Makes the compiled model take the reordered (packed) weights from the store shared by all the compiled models
+ * of the process enabling it. The weights are identified by the content and the target layout, so the identical
+ * weights of the different models are packed once per NUMA node.
+ */
+static constexpr Property<bool, PropertyMutability::RW> shared_weights{"CPU_SHARED_WEIGHTS"};
+
+/**
+ * @brief The directory (preferably on tmpfs, e.g. /dev/shm/ov_weights) where the shared packed weights are published
+ * for the other processes, which map them read-only instead of packing own copies. Takes effect with shared_weights.
+ * The directory is made accessible to the owner only; the directory of another user is ignored.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> shared_weights_dir{"CPU_SHARED_WEIGHTS_DIR"};
+
+/**
+ * @brief Read-only property to get the statistics of the shared weights store used by a compiled model: "hits" of the
+ * weights found in the process, "packed" weights reordered by the process and "mapped" weights published by the other
+ * processes. The store is shared by the compiled models, so are the counters. The counters are zero if the sharing is
+ * disabled.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> shared_weights_statistics{
+    "CPU_SHARED_WEIGHTS_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the statistics of the packed weights imported with the compiled model: "stored"
+ * weights in the imported blob, "hits" of the weights used without the reorder and "misses" of the weights reordered
+ * since the blob has no matching data. All the counters are zero if the compiled model is not imported.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> packed_weights_statistics{
+    "CPU_PACKED_WEIGHTS_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the runtime telemetry of a compiled model accumulated over all the streams:
+ * "inferences", "sampled_inferences", "request_p50_ns", "request_p99_ns", "update_shapes_ns", "prepare_params_ns",
+ * "execute_ns", "reorder_executions", "runtime_cache_hits", "runtime_cache_misses", and "node.<name>.count",
+ * "node.<name>.p50_ns", "node.<name>.p99_ns" for every executed node. The latencies are estimated by the histograms
+ * with the relative error below 25%, the times are accumulated over the sampled inferences only.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> telemetry{"CPU_TELEMETRY"};
+
+/**
+ * @brief Read-only property to get the statistics of the shape inference results cache of a compiled model
+ * accumulated over all the streams: "hits" and "misses" counters of the nodes, "graph_hits" and "graph_misses"
+ * counters of the graph input shapes lookups.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> shape_infer_cache_statistics{
+    "CPU_SHAPE_INFER_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the lookup statistics of the runtime parameters cache of a compiled model
+ * accumulated over all the streams: "hits", "misses" and "evictions" counters.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the statistics of the persistent JIT kernels cache placed into the Core cache_dir:
+ * "hits", "misses", "stored", "not_relocatable", "rejected" (failed the ownership or the integrity check), "evicted"
+ * counters, "jit_time_us" spent on the generation of the missed kernels, "saved_time_us" of the generation
+ * avoided by the hits and "relocation_time_us" spent on the second generation and the checks of the missed kernels
+ * before they are stored. The cache is shared by all the compiled models using the same cache directory within the
+ * process, so are the counters. All the counters are zero if cache_dir is not set.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> jit_cache_statistics{
+    "CPU_JIT_CACHE_STATISTICS"};
+
+}  // namespace intel_cpu
+}  // namespace ov
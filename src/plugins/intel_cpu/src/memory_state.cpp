@@ -11,10 +11,33 @@ using namespace InferenceEngine;
 namespace ov {
 namespace intel_cpu {
 
+VariableState::VariableState(std::string name, MemoryPtr storage, const dnnl::engine& eng)
+    : InferenceEngine::IVariableStateInternal{name} {
+    current = std::make_shared<Memory>(eng, storage->getDescPtr());
+    next = std::make_shared<Memory>(eng, storage->getDescPtr());
+    cpu_memcpy(current->getData(), storage->getData(), storage->getSize());
+
+    const auto tensorDesc = MemoryDescUtils::convertToTensorDesc(storage->getDesc());
+    state = make_blob_with_precision(tensorDesc, current->getData());
+    nextBlob = make_blob_with_precision(tensorDesc, next->getData());
+}
+
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    std::memset(current->getData(), 0, current->getSize());
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    // the state memory is bound to the graph, so the user blob is copied instead of replacing the state blob
+    if (newState->byteSize() != current->getSize())
+        IE_THROW() << "Cannot set the state " << name << ": expected " << current->getSize() << " bytes, got "
+                   << newState->byteSize();
+    cpu_memcpy(current->getData(), newState->cbuffer().as<const void*>(), current->getSize());
+}
+
+void VariableState::swap() {
+    std::swap(current, next);
+    std::swap(state, nextBlob);
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -15,16 +15,36 @@
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * The variable state is double buffered: the graph reads the state from the current buffer and writes the new state
+ * to the next one, then the buffers are swapped after the inference. The graph memory is bound to the buffers directly
+ * where possible, so the state is not copied in and out of the graph, and the state blob is a view of the current
+ * buffer.
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->getData(), storage->getSize());
-    }
+    VariableState(std::string name, MemoryPtr storage, const dnnl::engine& eng);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+
+    const MemoryPtr& getCurrent() const {
+        return current;
+    }
+
+    const MemoryPtr& getNext() const {
+        return next;
+    }
+
+    /**
+     * @brief Makes the new state written by the inference the current one
+     */
+    void swap();
+
+private:
+    MemoryPtr current;
+    MemoryPtr next;
+    InferenceEngine::Blob::Ptr nextBlob;
 };
 
 }   // namespace intel_cpu
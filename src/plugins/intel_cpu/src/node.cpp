@@ -9,6 +9,7 @@
 #include "itt.h"
 
 #include "caseless.hpp"
+#include <common/primitive_hashing_utils.hpp>
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <vector>
@@ -572,16 +573,65 @@ std::vector<memory::format_tag> Node::getAvailableFormatsForDims(const Shape &di
     return {memory::format_tag::any};
 }
 
+size_t Node::ShapeInferCacheKey::hash() const {
+    size_t seed = 0;
+    for (const auto& dims : inputDims) {
+        seed = dnnl::impl::hash_combine(seed, dims.size());
+        for (const auto dim : dims)
+            seed = dnnl::impl::hash_combine(seed, dim);
+    }
+    return seed;
+}
+
 void Node::updateShapes() {
     IE_ASSERT(isDynamicNode()) << "Node::updateShapes() is called to a static shape node of type: " << getTypeStr() << " with name: " << getName();
     if (needShapeInfer()) {
+        const auto cacheCapacity = context->getConfig().shapeInferCacheCapacity;
+        if (cacheCapacity == 0 || outputShapeDataDependency()) {
+            memoizedOutputDims.reset();
+            auto result = shapeInfer();
+            if (ShapeInferStatus::success == result.status) {
+                redefineOutputMemory(result.dims);
+            }
+            return;
+        }
+
+        auto& key = shapeInferLookupKey;
+        key.inputDims.resize(inputShapes.size());
+        for (size_t port = 0; port < inputShapes.size(); ++port)
+            key.inputDims[port] = getParentEdgesAtPort(port)[0]->getMemory().getStaticDims();
+
+        if (!shapeInferCache)
+            shapeInferCache.reset(new LruCache<ShapeInferCacheKey, OutputDimsPtr>(cacheCapacity));
+
+        auto dims = shapeInferCache->get(key);
+        if (dims) {
+            shapeInferCacheHits.fetch_add(1, std::memory_order_relaxed);
+            redefineOutputMemory(*dims);
+            memoizedOutputDims = std::move(dims);
+            return;
+        }
+
+        shapeInferCacheMisses.fetch_add(1, std::memory_order_relaxed);
+        memoizedOutputDims.reset();
         auto result = shapeInfer();
         if (ShapeInferStatus::success == result.status) {
-            redefineOutputMemory(result.dims);
+            dims = std::make_shared<const std::vector<VectorDims>>(std::move(result.dims));
+            shapeInferCache->put(key, dims);
+            redefineOutputMemory(*dims);
+            memoizedOutputDims = std::move(dims);
         }
     }
 }
 
+void Node::updateShapes(const OutputDimsPtr& outputDims) {
+    IE_ASSERT(isDynamicNode()) << "Node::updateShapes() is called to a static shape node of type: " << getTypeStr() << " with name: " << getName();
+    if (needShapeInfer()) {
+        redefineOutputMemory(*outputDims);
+        memoizedOutputDims = outputDims;
+    }
+}
+
 void Node::updateDynamicParams() {
     IE_ASSERT(isDynamicNode()) << "Node::updateDynamicParams() is called to a static shape node of type: " << getTypeStr() << " with name: " << getName();
     if (isExecutable()) {
@@ -821,7 +871,7 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
         Memory memory{engine, newDesc, internalBlob->buffer()};
 
         MemoryPtr _ptr = std::make_shared<Memory>(engine, intDesc);
-        node::Reorder::reorderData(memory, *_ptr, context->getParamsCache());
+        node::Reorder::reorderData(memory, *_ptr, getParamsCache());
         return _ptr;
     };
 
@@ -829,10 +879,24 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
     auto weightCache = context->getWeightsCache();
     if (weightCache != nullptr && memory::format_kind::blocked == intDesc->getDnnlDesc().get_format_kind()) {
         const auto& format = intDesc->serializeFormat();
-        const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                internalBlob->buffer(), internalBlob->byteSize());
+        // The internal blobs are produced from the constant inputs, so the hashes cached in the constants identify
+        // the blob data without reading it. The blob is hashed only if some constant input is computed by the graph.
+        uint64_t data_hash = 0;
+        bool fromConstants = true;
+        for (size_t i = 0; i < getParentEdges().size() && fromConstants; i++) {
+            const auto parent = getParentEdgeAt(i)->getParent();
+            if (!parent->isConstant())
+                continue;
+            const auto input = std::dynamic_pointer_cast<node::Input>(parent);
+            fromConstants = input && input->getConstOp();
+            if (fromConstants)
+                data_hash = dnnl::impl::hash_combine(data_hash, weightCache->GetHashFunc().hash(*input->getConstOp()));
+        }
+        if (!fromConstants) {
+            data_hash = weightCache->GetHashFunc().hash(internalBlob->buffer(), internalBlob->byteSize());
+        }
 
-        const std::string string_hash = name + "_" + std::to_string(indx)
+        const std::string string_hash = name + "_" + getTypeStr() + "_" + std::to_string(indx)
                                         + "_" + format
                                         + "_" + std::to_string(internalBlob->byteSize())
                                         + "_" + std::to_string(data_hash);
@@ -879,22 +943,42 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
         srcWeightDesc = DnnlExtensionUtils::makeDescriptor(weightSrcDesc);
     }
 
+    const auto& format = dstWeightDesc->serializeFormat();
+
     auto create = [&] () {
+        if (auto packedWeights = context->getPackedWeights()) {
+            const auto key = PackedWeights::makeKey(getName(), format, edgeMem->getSize());
+            if (auto data = packedWeights->find(key, dstWeightDesc->getCurrentMemSize())) {
+                // the weights have been already reordered by the exported model
+                MemoryPtr _ptr = std::make_shared<Memory>(getEngine(), dstWeightDesc, data, false);
+                return _ptr;
+            }
+        }
+
         Memory srcMemory{ getEngine(), srcWeightDesc, edgeMem->getData() };
         MemoryPtr _ptr = std::make_shared<Memory>(getEngine(), dstWeightDesc);
-        node::Reorder::reorderData(srcMemory, *_ptr, context->getParamsCache());
+        node::Reorder::reorderData(srcMemory, *_ptr, getParamsCache());
 
         return _ptr;
     };
 
     MemoryPtr ptr;
-    const auto& format = dstWeightDesc->serializeFormat();
     auto itr = privateWeightCache.find(format);
     if (privateWeightCache.end() != itr) {
         ptr = itr->second;
     } else {
+        auto sharedWeights = context->getSharedWeights();
         auto weightCache = context->getWeightsCache();
-        if (weightCache != nullptr) {
+        if (sharedWeights != nullptr) {
+            // the hash cached in the weights constant identifies the source, the weights read from the constant by
+            // the input node may differ from it (e.g. the flushed denormals), so the store hashes the data too
+            const auto input = std::dynamic_pointer_cast<node::Input>(getParentEdgeAt(1)->getParent());
+            const auto dataHash = input && input->getConstOp() ?
+                SimpleDataHash().hash(*input->getConstOp()) :
+                SimpleDataHash().hash(static_cast<const unsigned char*>(edgeMem->getData()), edgeMem->getSize());
+            const auto key = SharedWeightsStore::makeKey(*srcWeightDesc, *dstWeightDesc, edgeMem->getData(), dataHash);
+            ptr = sharedWeights->findOrCreate(getEngine(), key, context->getNumaNodeId(), dstWeightDesc, create);
+        } else if (weightCache != nullptr) {
             const std::string string_hash = getName() + "_" + format
                                             + "_" + std::to_string(edgeMem->getSize())
                                             + "_" + std::to_string(reinterpret_cast<uint64_t>(edgeMem->getData()));
@@ -909,6 +993,16 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
     return ptr;
 }
 
+void Node::collectPackedWeights(PackedWeights& packedWeights) const {
+    if (privateWeightCache.empty())
+        return;
+
+    const auto srcSize = getParentEdgeAt(1)->getMemoryPtr()->getSize();
+    for (const auto& item : privateWeightCache) {
+        packedWeights.add(PackedWeights::makeKey(getName(), item.first, srcSize), item.second);
+    }
+}
+
 bool Node::isInPlace() const {
     if (inplace == InPlaceType::Unknown) {
         auto selected_pd = getSelectedPrimitiveDescriptor();
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <ie_api.h>
+#include <atomic>
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <vector>
@@ -19,6 +20,7 @@
 #include "onednn/iml_type_mapper.h"
 #include "extension_mngr.h"
 #include "weights_cache.hpp"
+#include "packed_weights.h"
 #include "dnnl_scratch_pad.h"
 #include <openvino/itt.hpp>
 #include "utils/ngraph_utils.hpp"
@@ -31,6 +33,7 @@
 #include "config.h"
 #include "nodes/node_config.h"
 #include "cache/multi_cache.h"
+#include "cache/lru_cache.h"
 
 #include <shape_inference/shape_inference_cpu.hpp>
 #include "utils/debug_capabilities.h"
@@ -174,6 +177,11 @@ public:
     virtual void cleanup();
     void remove();
 
+    /**
+     * @brief Adds the weights reordered by the node (see prepareWeightMemory) to the storage for the model export
+     */
+    void collectPackedWeights(PackedWeights& packedWeights) const;
+
     const std::vector<EdgeWeakPtr> &getParentEdges() const noexcept {
         return parentEdges;
     }
@@ -360,8 +368,25 @@ public:
     virtual void resolveInPlaceEdges(Edge::LOOK look = Edge::LOOK_BOTH);
 
     virtual void execute(dnnl::stream strm) = 0;
+    using OutputDimsPtr = std::shared_ptr<const std::vector<VectorDims>>;
     void updateShapes();
+    /**
+     * @brief Applies the output dims memoized by the graph for the current input shapes instead of the shape inference
+     */
+    void updateShapes(const OutputDimsPtr& outputDims);
+    /**
+     * @brief Returns the output dims applied by the last updateShapes() call or null if they are not memoized
+     */
+    const OutputDimsPtr& getMemoizedOutputDims() const {
+        return memoizedOutputDims;
+    }
     void updateDynamicParams();
+    uint64_t getShapeInferCacheHits() const {
+        return shapeInferCacheHits.load(std::memory_order_relaxed);
+    }
+    uint64_t getShapeInferCacheMisses() const {
+        return shapeInferCacheMisses.load(std::memory_order_relaxed);
+    }
     void executeDynamic(dnnl::stream strm);
     virtual void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
     bool outputShapeDataDependency() const;
@@ -399,6 +424,10 @@ public:
         return execIndex;
     }
 
+    int getParallelStage() const {
+        return parallelStage;
+    }
+
     const std::string & getTypeStr() const {
         return typeStr;
     }
@@ -685,16 +714,38 @@ protected:
 
     MemoryPtr getScratchPadMem(const DnnlMemoryDescPtr& desc) {
         if (!scratchpadMem || !scratchpadMem->getDesc().isCompatible(*desc)) {
-            scratchpadMem = context->getScratchPad()->createScratchPadMem(desc);
+            scratchpadMem = context->getScratchPad(subStreamID)->createScratchPadMem(desc);
         }
         return scratchpadMem;
     }
 
+    // the nodes executed simultaneously get the executors from different caches, so they never share the state
+    MultiCachePtr getParamsCache() const {
+        return context->getParamsCache(subStreamID);
+    }
+
     std::vector<VectorDims> lastInputDims = {};
 
     std::shared_ptr<IShapeInfer> shapeInference;
 
 private:
+    struct ShapeInferCacheKey {
+        std::vector<VectorDims> inputDims;
+
+        size_t hash() const;
+        bool operator==(const ShapeInferCacheKey& rhs) const {
+            return inputDims == rhs.inputDims;
+        }
+    };
+
+    // the output dims memoized for the input dims, used if the output shapes depend on the input shapes only
+    std::unique_ptr<LruCache<ShapeInferCacheKey, OutputDimsPtr>> shapeInferCache;
+    // the lookup key is reused, so the cache hits do not allocate
+    ShapeInferCacheKey shapeInferLookupKey;
+    OutputDimsPtr memoizedOutputDims;
+    std::atomic<uint64_t> shapeInferCacheHits{0};
+    std::atomic<uint64_t> shapeInferCacheMisses{0};
+
     std::vector<EdgeWeakPtr> parentEdges;
     std::vector<EdgeWeakPtr> childEdges;
 
@@ -709,6 +760,10 @@ private:
     std::string typeStr;
     Type type;
     int execIndex = -1;
+    // index of the graph sub stream the node is executed on when independent branches run in parallel
+    int subStreamID = 0;
+    // index of the group of nodes executed simultaneously with this one (-1 if the node is executed alone)
+    int parallelStage = -1;
 
     std::string typeToStr(Type type);
 
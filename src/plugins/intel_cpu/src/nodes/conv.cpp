@@ -1383,7 +1383,7 @@ void Convolution::prepareParams() {
 
     auto prevExecPtr = execPtr;
     execPtr = nullptr;
-    auto cache = context->getParamsCache();
+    auto cache = getParamsCache();
     auto result = cache->getOrCreate(key, builder);
 
     execPtr = result.first;
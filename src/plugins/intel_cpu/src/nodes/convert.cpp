@@ -9,6 +9,7 @@
 #include <ie_ngraph_utils.hpp>
 #include <utils/ngraph_utils.hpp>
 #include <shape_inference/shape_inference_pass_through.hpp>
+#include "transformations/cpu_opset/common/pass/mark_low_bit_weights_decompression.hpp"
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -41,6 +42,7 @@ Convert::Convert(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CP
 
     auto convert = ov::as_type_ptr<const ngraph::opset1::Convert>(op);
     convertParams.origPrc = details::convertPrecision(convert->get_destination_type());
+    lowBitWeightsDecompression = MarkLowBitWeightsDecompression::isMarked(op);
 }
 
 Convert::Convert(const Shape &shape, const InferenceEngine::Precision &inPrc, const InferenceEngine::Precision &outPrc,
@@ -44,6 +44,9 @@ public:
 
     bool needPrepareParams() const override { return inputShapesModified(); }
 
+    // the input holds u4/i4 weights unpacked to u8/i8
+    bool isLowBitWeightsDecompression() const { return lowBitWeightsDecompression; }
+
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
     static bool isSupportedDesc(const MemoryDesc &desc);
@@ -54,6 +57,7 @@ private:
     ConvertParams convertParams;
     std::shared_ptr<ConvertExecutor> execPtr = nullptr;
     NodeConfig config;
+    bool lowBitWeightsDecompression = false;
 
     std::string errorPrefix;
 };
@@ -1014,7 +1014,7 @@ void Deconvolution::prepareParams() {
     };
 
     execPtr = nullptr;
-    auto cache = context->getParamsCache();
+    auto cache = getParamsCache();
     auto result = cache->getOrCreate(key, builder);
 
     execPtr = result.first;
@@ -1221,7 +1221,7 @@ void DeformableConvolution::prepareParams() {
 
     execPtr = nullptr;
 
-    auto cache = context->getParamsCache();
+    auto cache = getParamsCache();
     auto result = cache->getOrCreate(key, [] (const DefConvKey& key) -> std::shared_ptr<DefConvExecutor> {
         if (key.implType == impl_desc_type::ref) {
             return std::make_shared<DefConvRefExecutor>(key.defConvAttr, key.descVector);
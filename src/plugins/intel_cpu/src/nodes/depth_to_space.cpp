@@ -190,7 +190,7 @@ void DepthToSpace::prepareParams() {
         return std::make_shared<DepthToSpaceExecutor>(key);
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = getParamsCache();
     auto result = cache->getOrCreate(attrs, builder);
     if (!result.first) {
         IE_THROW() << "DepthToSpaceExecutor was not found for node " << getName() << ".";
@@ -2308,7 +2308,7 @@ void Eltwise::prepareParams() {
             }
         }
 
-        auto cache = context->getParamsCache();
+        auto cache = getParamsCache();
         auto result = cache->getOrCreate(key, buildExecutor);
         execPtr = result.first;
     }
@@ -34,9 +34,30 @@ struct jit_extract_image_patches_kernel : public jit_uni_extract_image_patches_k
 
     explicit jit_extract_image_patches_kernel(jit_extract_image_patches_params jpp) : jit_uni_extract_image_patches_kernel(jpp), jit_generator(jit_name()) {}
 
-    void create_ker() override {
-        jit_generator::create_kernel();
-        ker_ = (decltype(ker_))jit_ker();
+    void create_ker(const JitCodeCache::Ptr& codeCache) override {
+        if (!codeCache) {
+            jit_generator::create_kernel();
+            ker_ = (decltype(ker_))jit_ker();
+            return;
+        }
+
+        // the kernel addresses nothing but its own gather index table, so the code may be stored
+        JitCodeCache::Key key(jit_name());
+        key << isa << jpp.IW << jpp.OH << jpp.OW << jpp.KH << jpp.KW << jpp.SH << jpp.SW << jpp.dtype_size
+            << jpp.block_size << jpp.need_padding;
+        std::unique_ptr<jit_extract_image_patches_kernel> copy;
+        code_ = codeCache->getOrCreate(
+            key,
+            [this]() {
+                jit_generator::create_kernel();
+                return JitCodeCache::Code{jit_ker(), getSize()};
+            },
+            [this, &copy]() {
+                copy.reset(new jit_extract_image_patches_kernel(jpp));
+                copy->create_kernel();
+                return JitCodeCache::Code{copy->jit_ker(), copy->getSize()};
+            });
+        ker_ = (decltype(ker_))code_.get();
     }
 
     void generate() override {
@@ -380,7 +401,8 @@ void ExtractImagePatches::prepareParams() {
     const auto prcSize = getOriginalInputPrecisionAtPort(0).size();
     ExtractImagePatchesKey key = {in_dims, out_dims, _ksizes, _strides, _rates, _auto_pad, prcSize};
     const auto isJit = mayiuse(x64::sse41);
-    auto buildExecutor = [&isJit](const ExtractImagePatchesKey& key) -> executorPtr {
+    const auto codeCache = context->getJitCodeCache();
+    auto buildExecutor = [&isJit, &codeCache](const ExtractImagePatchesKey& key) -> executorPtr {
         if (isJit) {
             return std::make_shared<ExtractImagePatchesJitExecutor>(key.inDims,
                                                                     key.outDims,
@@ -388,7 +410,8 @@ void ExtractImagePatches::prepareParams() {
                                                                     key.strides,
                                                                     key.rates,
                                                                     key.padType,
-                                                                    key.prcSize);
+                                                                    key.prcSize,
+                                                                    codeCache);
         } else {
             return std::make_shared<ExtractImagePatchesRefExecutor>(key.inDims,
                                                                     key.outDims,
@@ -399,7 +422,7 @@ void ExtractImagePatches::prepareParams() {
                                                                     key.prcSize);
         }
     };
-    auto cache = context->getParamsCache();
+    auto cache = getParamsCache();
     auto result = cache->getOrCreate(key, buildExecutor);
     execPtr = result.first;
 }
@@ -587,7 +610,8 @@ ExtractImagePatches::ExtractImagePatchesJitExecutor::ExtractImagePatchesJitExecu
     const VectorDims& strides,
     const VectorDims& rates,
     const ExtImgPatcherPadType& padType,
-    const size_t prcSize) {
+    const size_t prcSize,
+    const JitCodeCache::Ptr& codeCache) {
 #if defined(OPENVINO_ARCH_X86_64)
     auto jpp = fillJpp(inDims, outDims, kSizes, strides, rates, padType, prcSize);
     if (mayiuse(x64::avx512_core)) {
@@ -601,7 +625,7 @@ ExtractImagePatches::ExtractImagePatchesJitExecutor::ExtractImagePatchesJitExecu
     }
 
     if (pKernel)
-        pKernel->create_ker();
+        pKernel->create_ker(codeCache);
 #endif // OPENVINO_ARCH_X86_64
 }
 
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <node.h>
+#include "cache/jit_code_cache.h"
 #include <string>
 #include <memory>
 #include <vector>
@@ -37,9 +38,12 @@ struct jit_uni_extract_image_patches_kernel {
     void (*ker_)(const jit_extract_image_patches_args *);
     void operator()(const jit_extract_image_patches_args *args) { assert(ker_); ker_(args); }
     jit_extract_image_patches_params jpp;
-    virtual void create_ker() = 0;
+    virtual void create_ker(const JitCodeCache::Ptr& codeCache) = 0;
     explicit jit_uni_extract_image_patches_kernel(jit_extract_image_patches_params jpp) : ker_(nullptr), jpp(jpp) {}
     virtual ~jit_uni_extract_image_patches_kernel() {}
+
+protected:
+    JitCodeCache::CodePtr code_;  // keeps the code loaded from the cache mapped
 };
 
 class ExtractImagePatches : public Node {
@@ -104,7 +108,8 @@ private:
             const VectorDims& strides,
             const VectorDims& rates,
             const ExtImgPatcherPadType& padType,
-            const size_t prcSize);
+            const size_t prcSize,
+            const JitCodeCache::Ptr& codeCache);
         void exec(void* src, void* dst, const VectorDims& istrides, const VectorDims& ostrides) override;
         void executeOptimizedGeneric(void* src, void* dst, const VectorDims& istrides, const VectorDims& ostrides) const;
 
@@ -1474,7 +1474,7 @@ void FakeQuantize::createPrimitive() {
             key.jqp.broadcasted = broadcasted;
         }
 
-        auto cache = context->getParamsCache();
+        auto cache = getParamsCache();
         auto buildExecutor = [](const FakeQuantKey& key) {
             return std::make_shared<FakeQuantizeJitExecutor>(key.jqp);
         };
@@ -27,6 +27,7 @@
 #include "common/primitive_desc_iface.hpp"
 #include "common/cpu_convert.h"
 #include "shape_inference/custom/fullyconnected.hpp"
+#include "ie_parallel.hpp"
 
 #include <string>
 #include <vector>
@@ -203,7 +204,11 @@ void FullyConnected::getSupportedDescriptors() {
     withBiases = getOriginalInputsNumber() == 3;
 
     useSparseWeights = useSparseWeightsDecompression();
-    useWeightsDecompressionImpl = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2) &&
+    useLowBitWeightsDecompression = lowBitWeights && !useSparseWeights &&
+                                    dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2) &&
+                                    one_of(inputDataType, memory::data_type::f32, memory::data_type::bf16);
+    useWeightsDecompressionImpl = !useLowBitWeightsDecompression &&
+                                  dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2) &&
                                   one_of(inputDataType, memory::data_type::f32, memory::data_type::bf16) &&
                                   weightsDataType == memory::data_type::u8;
 
@@ -246,7 +251,7 @@ void FullyConnected::getSupportedDescriptors() {
 #if defined(OV_CPU_WITH_MLAS) && (defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64))
     // MLAS doesn't support post-ops fusing and only supports FP32. INT8 is not enabled yet
     // Disable MLAS when FC could fuse post-ops
-    useMlas = !useSparseWeights && !useWeightsDecompressionImpl &&
+    useMlas = !useSparseWeights && !useWeightsDecompressionImpl && !useLowBitWeightsDecompression &&
               (inputDataType == memory::data_type::f32 && weightsDataType == memory::data_type::f32) &&
               fusedWith.empty();
     auto wgtDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
@@ -275,7 +280,7 @@ void FullyConnected::getSupportedDescriptors() {
         }
     }
 #endif
-    if (useMlas) return;
+    if (useMlas || useLowBitWeightsDecompression) return;
 
     for (auto format : getAvailableFormatsForDims(getInputShapeAtPort(0))) {
         auto in_candidate = dnnl::memory::desc(DnnlExtensionUtils::convertToDnnlDims(inDims), inputDataType, format);
@@ -337,6 +342,11 @@ void FullyConnected::createPrimitive() {
         return;
     }
 #endif
+    if (useLowBitWeightsDecompression) {
+        prepackLowBitWeights();
+        Node::createPrimitive();
+        return;
+    }
     setPostOps(attr, outDims);
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     Node::createPrimitive();
@@ -360,9 +370,8 @@ void FullyConnected::prepareParams() {
     NodeDesc *selected_pd = getSelectedPrimitiveDescriptor();
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
-#ifdef OV_CPU_WITH_MLAS
     // M should be normalized and updated
-    if (useMlas) {
+    if (useMlas || useLowBitWeightsDecompression) {
         outDims = dstMemPtr->getStaticDims();
         if (outDims.size() > 2) {
             M = std::accumulate(outDims.begin(), outDims.end() - 1, 1, std::multiplies<size_t>());
@@ -371,7 +380,6 @@ void FullyConnected::prepareParams() {
         }
         return;
     }
-#endif
     DnnlMemoryDescPtr weightDesc = MemoryDescUtils::convertToDnnlMemoryDesc(weightDescIP);
     DnnlMemoryDescCPtr biasDesc = nullptr;
     if (biasMemPtr) {
@@ -449,7 +457,7 @@ void FullyConnected::prepareParams() {
         return std::make_shared<DnnlExecutor>(first_desc);
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = getParamsCache();
     auto result = cache->getOrCreate(key, builder);
 
     if (!result.first) {
@@ -531,6 +539,247 @@ void FullyConnected::executeMLAS() {
 
 #endif
 
+void FullyConnected::prepackLowBitWeights() {
+    if (!getParentEdgeAt(WEIGHTS_ID)->getParent()->isConstant())
+        IE_THROW() << "Weight input is not const for node " << getName() << ".";
+    auto weightsMem = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    if (!weightsMem)
+        IE_THROW() << "Cannot get const weights edgeMem for node " << getName() << ".";
+
+    const auto& wgtDims = weightsMem->getStaticDims();
+    K = wgtDims[1];
+    N = wgtDims[0];
+    // Scales and zero points have [OC, G] layout, where every group covers K / G input channels
+    const size_t groups = decompressionMultiply.size() / N;
+    if (groups == 0 || K % groups != 0)
+        IE_THROW() << "Unexpected decompression scales size for node " << getName() << ".";
+    const size_t groupSize = K / groups;
+    // i4 weights are packed with the +8 offset which is compensated by the zero points
+    const bool isSigned = weightsMem->getDesc().getPrecision() == Precision::I8;
+    const bool withZeroPoints = isSigned || !decompressionSubtract.empty();
+
+    lowBitKernels.clear();
+#if defined(OPENVINO_ARCH_X86_64)
+    for (size_t mBlock = 1; mBlock <= jit_fc_weights_decompression_kernel::max_m_block; mBlock++) {
+        jit_fc_weights_decompression_params jcp;
+        jcp.ic = K;
+        jcp.group_size = groupSize;
+        jcp.m_block = mBlock;
+        jcp.with_zero_points = withZeroPoints;
+
+        std::shared_ptr<jit_fc_weights_decompression_kernel> kernel;
+        if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core)) {
+            kernel = std::make_shared<jit_fc_weights_decompression_kernel_f32<dnnl::impl::cpu::x64::avx512_core>>(jcp);
+        } else if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
+            kernel = std::make_shared<jit_fc_weights_decompression_kernel_f32<dnnl::impl::cpu::x64::avx2>>(jcp);
+        }
+        if (kernel)
+            kernel->create_ker();
+        lowBitKernels.push_back(kernel);
+    }
+#endif
+    if (lowBitKernels.empty() || !lowBitKernels.front())
+        IE_THROW() << "Cannot create weights decompression kernel for node " << getName() << ".";
+
+    const size_t ocBlock = lowBitKernels.front()->get_oc_block();
+    const size_t ocBlocks = div_up(static_cast<size_t>(N), ocBlock);
+    const size_t groupPairs = div_up(groupSize, 2);
+
+    auto create = [&]() {
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine(),
+                                                  intel_cpu::CpuBlockedMemoryDesc(Precision::U8,
+                                                                                  intel_cpu::Shape{ocBlocks * groups * groupPairs * ocBlock}));
+        const auto* src = reinterpret_cast<const uint8_t*>(weightsMem->getData());
+        auto* dst = reinterpret_cast<uint8_t*>(_ptr->getData());
+        auto nibble = [&](size_t n, size_t k) -> uint8_t {
+            const uint8_t value = src[weightsNonTransposed ? k * N + n : n * K + k];
+            return static_cast<uint8_t>(isSigned ? value + 8 : value) & 0x0f;
+        };
+        parallel_for(ocBlocks, [&](size_t ob) {
+            auto* blockDst = dst + ob * groups * groupPairs * ocBlock;
+            for (size_t g = 0; g < groups; g++) {
+                for (size_t p = 0; p < groupPairs; p++) {
+                    const size_t k = g * groupSize + 2 * p;
+                    for (size_t j = 0; j < ocBlock; j++) {
+                        const size_t n = ob * ocBlock + j;
+                        uint8_t packed = 0;
+                        if (n < static_cast<size_t>(N)) {
+                            packed = nibble(n, k);
+                            if (2 * p + 1 < groupSize)
+                                packed |= nibble(n, k + 1) << 4;
+                        }
+                        blockDst[(g * groupPairs + p) * ocBlock + j] = packed;
+                    }
+                }
+            }
+        });
+        return _ptr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        std::string format = "low_bit_" + std::to_string(N) + "_" + std::to_string(K) + "_" + std::to_string(ocBlock) +
+                             "_" + std::to_string(groups) + (weightsNonTransposed ? "_t" : "");
+        const std::string string_hash = getName() + "_" + format + "_" + std::to_string(weightsMem->getSize()) +
+                                        "_" + std::to_string(reinterpret_cast<uint64_t>(weightsMem->getData()));
+
+        lowBitPackedWeights = *weightCache->findOrCreate(string_hash, create);
+        lowBitWeightsHash = string_hash;
+    } else {
+        lowBitPackedWeights = create();
+        lowBitWeightsHash.clear();
+    }
+    lowBitDecompressedWeights = nullptr;
+
+    // Scales and zero points are repacked to [OC blocks][G][OC block] to be loaded by the kernel with one vector load
+    lowBitPackedScales.assign(ocBlocks * groups * ocBlock, 0.f);
+    lowBitPackedZeroPoints.assign(withZeroPoints ? ocBlocks * groups * ocBlock : 0, 0.f);
+    for (size_t n = 0; n < static_cast<size_t>(N); n++) {
+        for (size_t g = 0; g < groups; g++) {
+            const size_t idx = ((n / ocBlock) * groups + g) * ocBlock + n % ocBlock;
+            lowBitPackedScales[idx] = decompressionMultiply[n * groups + g];
+            if (withZeroPoints)
+                lowBitPackedZeroPoints[idx] = (decompressionSubtract.empty() ? 0.f : decompressionSubtract[n * groups + g]) +
+                                              (isSigned ? 8.f : 0.f);
+        }
+    }
+}
+
+void FullyConnected::executeLowBitWeightsDecompression() {
+    if (static_cast<size_t>(M) > lowBitKernelMaxRows) {
+        executeLowBitWeightsDecompressionGemm();
+        return;
+    }
+
+    const auto dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const auto srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    const auto biasMemPtr = withBiases ? getParentEdgeAt(BIAS_ID)->getMemoryPtr() : nullptr;
+    const auto* src = reinterpret_cast<const float*>(srcMemPtr->getData());
+    const auto* bias = withBiases ? reinterpret_cast<const float*>(biasMemPtr->getData()) : nullptr;
+    auto* dst = reinterpret_cast<float*>(dstMemPtr->getData());
+    const auto* weights = reinterpret_cast<const uint8_t*>(lowBitPackedWeights->getData());
+
+    const size_t mBlock = jit_fc_weights_decompression_kernel::max_m_block;
+    const size_t ocBlock = lowBitKernels.front()->get_oc_block();
+    const size_t ocBlocks = div_up(static_cast<size_t>(N), ocBlock);
+    const size_t mBlocks = div_up(static_cast<size_t>(M), mBlock);
+    const size_t weightsBlockSize = lowBitPackedWeights->getSize() / ocBlocks;
+    const size_t paramsBlockSize = lowBitPackedScales.size() / ocBlocks;
+
+    parallel_for2d(mBlocks, ocBlocks, [&](size_t mb, size_t ob) {
+        const size_t m = mb * mBlock;
+        const size_t rows = std::min(mBlock, static_cast<size_t>(M) - m);
+        const size_t oc = ob * ocBlock;
+        const size_t ocs = std::min(ocBlock, static_cast<size_t>(N) - oc);
+
+        jit_fc_weights_decompression_call_args args;
+        args.src = src + m * K;
+        args.src_stride = K * sizeof(float);
+        args.weights = weights + ob * weightsBlockSize;
+        args.scales = lowBitPackedScales.data() + ob * paramsBlockSize;
+        args.zero_points = lowBitPackedZeroPoints.empty() ? nullptr : lowBitPackedZeroPoints.data() + ob * paramsBlockSize;
+        if (ocs == ocBlock) {
+            args.bias = bias ? bias + oc : nullptr;
+            args.dst = dst + m * N + oc;
+            args.dst_stride = N * sizeof(float);
+            (*lowBitKernels[rows - 1])(&args);
+        } else {
+            // OC tail is computed into the local buffer to avoid out of bounds accesses, 16 is the widest (avx512) OC block
+            float tail[jit_fc_weights_decompression_kernel::max_m_block * 16];
+            args.bias = nullptr;
+            args.dst = tail;
+            args.dst_stride = ocBlock * sizeof(float);
+            (*lowBitKernels[rows - 1])(&args);
+            for (size_t r = 0; r < rows; r++) {
+                for (size_t j = 0; j < ocs; j++)
+                    dst[(m + r) * N + oc + j] = tail[r * ocBlock + j] + (bias ? bias[oc + j] : 0.f);
+            }
+        }
+    });
+}
+
+void FullyConnected::prepareLowBitDecompressedWeights() {
+    const auto* weights = reinterpret_cast<const uint8_t*>(lowBitPackedWeights->getData());
+    const size_t ocBlock = lowBitKernels.front()->get_oc_block();
+    const size_t ocBlocks = div_up(static_cast<size_t>(N), ocBlock);
+    const size_t weightsBlockSize = lowBitPackedWeights->getSize() / ocBlocks;
+    const size_t paramsBlockSize = lowBitPackedScales.size() / ocBlocks;
+    const size_t groups = paramsBlockSize / ocBlock;
+    const size_t groupSize = K / groups;
+    const size_t groupPairs = div_up(groupSize, 2);
+
+    // [K, OC] weights decompressed from the [G][IC / G / 2][OC block] nibbles of every OC block
+    auto create = [&]() {
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine(),
+                                                  intel_cpu::CpuBlockedMemoryDesc(Precision::FP32,
+                                                                                  intel_cpu::Shape{static_cast<size_t>(K), static_cast<size_t>(N)}));
+        auto* decompressed = reinterpret_cast<float*>(_ptr->getData());
+        parallel_for(ocBlocks, [&](size_t ob) {
+            const auto* blockWeights = weights + ob * weightsBlockSize;
+            const auto* scales = lowBitPackedScales.data() + ob * paramsBlockSize;
+            const auto* zeroPoints = lowBitPackedZeroPoints.empty() ? nullptr : lowBitPackedZeroPoints.data() + ob * paramsBlockSize;
+            const size_t blockOcs = std::min(ocBlock, static_cast<size_t>(N) - ob * ocBlock);
+            for (size_t g = 0; g < groups; g++) {
+                for (size_t p = 0; p < groupPairs; p++) {
+                    const size_t k = g * groupSize + 2 * p;
+                    for (size_t j = 0; j < blockOcs; j++) {
+                        const uint8_t packed = blockWeights[(g * groupPairs + p) * ocBlock + j];
+                        const float scale = scales[g * ocBlock + j];
+                        const float zeroPoint = zeroPoints ? zeroPoints[g * ocBlock + j] : 0.f;
+                        const size_t n = ob * ocBlock + j;
+                        decompressed[k * N + n] = (static_cast<float>(packed & 0x0f) - zeroPoint) * scale;
+                        if (2 * p + 1 < groupSize)
+                            decompressed[(k + 1) * N + n] = (static_cast<float>(packed >> 4) - zeroPoint) * scale;
+                    }
+                }
+            }
+        });
+        return _ptr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr && !lowBitWeightsHash.empty()) {
+        lowBitDecompressedWeights = *weightCache->findOrCreate(lowBitWeightsHash + "_f32", create);
+    } else {
+        lowBitDecompressedWeights = create();
+    }
+}
+
+void FullyConnected::executeLowBitWeightsDecompressionGemm() {
+    if (!lowBitDecompressedWeights)
+        prepareLowBitDecompressedWeights();
+
+    const auto dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const auto srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    const auto biasMemPtr = withBiases ? getParentEdgeAt(BIAS_ID)->getMemoryPtr() : nullptr;
+    const auto* src = reinterpret_cast<const float*>(srcMemPtr->getData());
+    const auto* bias = withBiases ? reinterpret_cast<const float*>(biasMemPtr->getData()) : nullptr;
+    auto* dst = reinterpret_cast<float*>(dstMemPtr->getData());
+    const auto* weights = reinterpret_cast<const float*>(lowBitDecompressedWeights->getData());
+
+    const size_t ocBlock = lowBitKernels.front()->get_oc_block();
+    const size_t ocBlocks = div_up(static_cast<size_t>(N), ocBlock);
+    const size_t chunkBlocks = std::max(lowBitGemmOcBlock / ocBlock, static_cast<size_t>(1));
+    const size_t chunks = div_up(ocBlocks, chunkBlocks);
+
+    parallel_for(chunks, [&](size_t c) {
+        const size_t obBegin = c * chunkBlocks;
+        const size_t obEnd = std::min(obBegin + chunkBlocks, ocBlocks);
+        const size_t oc = obBegin * ocBlock;
+        const size_t ocs = std::min(obEnd * ocBlock, static_cast<size_t>(N)) - oc;
+
+        const auto status = dnnl::sgemm('N', 'N', M, ocs, K, 1.f, src, K, weights + oc, N, 0.f, dst + oc, N);
+        if (status != dnnl::status::success)
+            IE_THROW() << "sgemm failed for node " << getName() << ".";
+        if (bias) {
+            for (size_t m = 0; m < static_cast<size_t>(M); m++) {
+                for (size_t j = 0; j < ocs; j++)
+                    dst[m * N + oc + j] += bias[oc + j];
+            }
+        }
+    });
+}
+
 void FullyConnected::execute(dnnl::stream strm) {
 #ifdef OV_CPU_WITH_MLAS
     if (useMlas) {
@@ -538,6 +787,10 @@ void FullyConnected::execute(dnnl::stream strm) {
         return;
     }
 #endif
+    if (useLowBitWeightsDecompression) {
+        executeLowBitWeightsDecompression();
+        return;
+    }
     if (!execPtr) {
         IE_THROW() << "Can't execute FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -567,6 +820,9 @@ void FullyConnected::executeDynamicImpl(dnnl::stream strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // post ops are not supported by the low-bit weights decompression kernel
+    if (lowBitWeights)
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -789,6 +1045,17 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
         }
         return;
     }
+    if (useLowBitWeightsDecompression) {
+        // the kernel computes in f32, so bf16 activations are converted by reorders
+        std::vector<PortConfigurator> inConfs {{LayoutType::ncsp, Precision::FP32},
+                                               {LayoutType::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)}};
+        if (withBiases)
+            inConfs.emplace_back(LayoutType::ncsp, Precision::FP32);
+        const auto implType = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core) ? impl_desc_type::jit_avx512
+                                                                                                : impl_desc_type::jit_avx2;
+        addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, Precision::FP32}}, implType);
+        return;
+    }
     // 3D FC requires implicit reshape so strides should be defined
     auto supportsUndefStridesAndOffset = [&]() {
         return getOutputShapeAtPort(0).getRank() == 2;
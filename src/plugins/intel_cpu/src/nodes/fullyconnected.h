@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 #include "common/dnnl_executor.h"
+#include "kernels/x64/fc_weights_decompression_kernel.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -59,6 +60,9 @@ public:
     void keepWeightsNonTransposed(bool weightsNonTransposed) {
         this->weightsNonTransposed = weightsNonTransposed;
     }
+    void keepWeightsLowBit(bool lowBitWeights) {
+        this->lowBitWeights = lowBitWeights;
+    }
 
     void fuseDecompressionMultiply(const NodePtr& constData);
     const std::vector<float>& getDecompressionMultiply() const { return decompressionMultiply; }
@@ -111,8 +115,8 @@ private:
     bool useSparseWeightsDecompression();
     VectorDims expectedBiasDims {};
     bool useMlas = false;
-#ifdef OV_CPU_WITH_MLAS
     int64_t M, N, K;
+#ifdef OV_CPU_WITH_MLAS
     MemoryPtr mlasPackedPtr = nullptr;
     void executeMLAS();
     void prepackMLASWeight();
@@ -122,6 +126,24 @@ private:
     std::vector<float> decompressionSubtract;
     std::vector<float> decompressionMultiply;
 
+    // weights which values fit into 4 bits are packed into nibbles and decompressed by the dedicated JIT kernel
+    bool lowBitWeights = false;
+    bool useLowBitWeightsDecompression = false;
+    MemoryPtr lowBitPackedWeights = nullptr;
+    std::vector<float> lowBitPackedScales;
+    std::vector<float> lowBitPackedZeroPoints;
+    std::vector<std::shared_ptr<jit_fc_weights_decompression_kernel>> lowBitKernels;
+    void prepackLowBitWeights();
+    void executeLowBitWeightsDecompression();
+    // the kernel decompresses the weights for every max_m_block rows, so bigger batches are computed by oneDNN sgemm
+    // with the f32 weights decompressed once on the first such batch and kept in the weights cache
+    static constexpr size_t lowBitKernelMaxRows = 4 * jit_fc_weights_decompression_kernel::max_m_block;
+    static constexpr size_t lowBitGemmOcBlock = 64;
+    std::string lowBitWeightsHash;
+    MemoryPtr lowBitDecompressedWeights = nullptr;
+    void prepareLowBitDecompressedWeights();
+    void executeLowBitWeightsDecompressionGemm();
+
     // FC with transposed weights
     bool weightsNonTransposed = false;
     DnnlMemoryDescPtr makeTransposedWeightDescriptor();
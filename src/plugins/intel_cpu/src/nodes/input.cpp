@@ -372,6 +372,30 @@ void Input::cloneBlobIfRequired() {
 
     auto weightCache = context->getWeightsCache();
 
+    // The lazy constant converted from the f16 weights (e.g. mapped from the IR file) is converted by the node
+    // right from the source, so the converted data is not produced in the constant as well
+    const auto lazySource = constOp->get_lazy_source();
+    if (lazySource && lazySource->get_element_type() == ov::element::f16 && prec == Precision::FP32) {
+        auto convertSource = [&, this] () {
+            MemoryPtr ptr = std::make_shared<StaticMemory>(getEngine(), memDesc);
+            // f16 values are normal in f32, so there are no subnormals to flush
+            cpu_convert(lazySource->get_data_ptr(), ptr->getData(), Precision::FP16, Precision::FP32, size);
+            return ptr;
+        };
+
+        MemoryPtr ptr;
+        if (weightCache) {
+            char sourcePtr[32];
+            snprintf(sourcePtr, sizeof sourcePtr, "%p", lazySource->get_data_ptr());
+            ptr = *weightCache->findOrCreate(getName() + "_" + std::to_string(size * prec.size()) + "_f16_" + sourcePtr,
+                                             convertSource);
+        } else {
+            ptr = convertSource();
+        }
+        memoryPtr = std::const_pointer_cast<const IMemory>(ptr);
+        return;
+    }
+
     if (weightCache) {
         MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
         memoryPtr = std::const_pointer_cast<const IMemory>(ptr);
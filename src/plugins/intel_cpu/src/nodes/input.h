@@ -30,6 +30,9 @@ public:
 
     void withMeanImage();
     MemoryCPtr getMemoryPtr() const;
+    const std::shared_ptr<ngraph::op::Constant>& getConstOp() const {
+        return constOp;
+    }
 
     void execute(dnnl::stream strm) override {}
     void executeDynamicImpl(dnnl::stream strm) override {}
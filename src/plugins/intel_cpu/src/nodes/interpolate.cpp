@@ -2345,7 +2345,7 @@ void Interpolate::prepareParams() {
         return executor;
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = getParamsCache();
     auto result = cache->getOrCreate(key, buildExecutor);
     execPtr = result.first;
 
@@ -0,0 +1,138 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_weights_decompression_kernel.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+
+namespace ov {
+namespace intel_cpu {
+
+#define GET_OFF(field) offsetof(jit_fc_weights_decompression_call_args, field)
+
+template <cpu_isa_t isa>
+void jit_fc_weights_decompression_kernel_f32<isa>::generate() {
+    using Xbyak::Label;
+
+    this->preamble();
+
+    mov(reg_weights, ptr[param1 + GET_OFF(weights)]);
+    mov(reg_scales, ptr[param1 + GET_OFF(scales)]);
+    if (jcp_.with_zero_points)
+        mov(reg_zero_points, ptr[param1 + GET_OFF(zero_points)]);
+    mov(reg_src[0], ptr[param1 + GET_OFF(src)]);
+    mov(reg_tmp, ptr[param1 + GET_OFF(src_stride)]);
+    for (size_t m = 1; m < jcp_.m_block; m++)
+        lea(reg_src[m], ptr[reg_src[m - 1] + reg_tmp]);
+
+    vpbroadcastd(vmm_nibble_mask, ptr[rip + l_nibble_mask]);
+    for (size_t m = 0; m < jcp_.m_block; m++)
+        uni_vpxor(vmm_acc(m), vmm_acc(m), vmm_acc(m));
+
+    const size_t groups = jcp_.ic / jcp_.group_size;
+    const size_t pairs = jcp_.group_size / 2;
+
+    Label l_group_loop;
+    mov(reg_groups, groups);
+    L(l_group_loop);
+    {
+        for (size_t m = 0; m < jcp_.m_block; m++)
+            uni_vpxor(vmm_group_acc(m), vmm_group_acc(m), vmm_group_acc(m));
+        if (jcp_.with_zero_points)
+            uni_vmovups(vmm_zero_point, ptr[reg_zero_points]);
+
+        if (pairs > 0) {
+            Label l_pair_loop;
+            mov(reg_pairs, pairs);
+            L(l_pair_loop);
+            {
+                decompress_weights(true);
+                accumulate(true);
+                add(reg_weights, oc_block);
+                for (size_t m = 0; m < jcp_.m_block; m++)
+                    add(reg_src[m], 2 * sizeof(float));
+                dec(reg_pairs);
+                jnz(l_pair_loop, T_NEAR);
+            }
+        }
+        if (jcp_.group_size % 2 != 0) {
+            // the last input channel of an odd group occupies the low nibble only
+            decompress_weights(false);
+            accumulate(false);
+            add(reg_weights, oc_block);
+            for (size_t m = 0; m < jcp_.m_block; m++)
+                add(reg_src[m], sizeof(float));
+        }
+
+        uni_vmovups(vmm_scale, ptr[reg_scales]);
+        for (size_t m = 0; m < jcp_.m_block; m++)
+            uni_vfmadd231ps(vmm_acc(m), vmm_group_acc(m), vmm_scale);
+        add(reg_scales, vlen);
+        if (jcp_.with_zero_points)
+            add(reg_zero_points, vlen);
+
+        dec(reg_groups);
+        jnz(l_group_loop, T_NEAR);
+    }
+
+    Label l_no_bias;
+    mov(reg_tmp, ptr[param1 + GET_OFF(bias)]);
+    test(reg_tmp, reg_tmp);
+    jz(l_no_bias, T_NEAR);
+    for (size_t m = 0; m < jcp_.m_block; m++)
+        uni_vaddps(vmm_acc(m), vmm_acc(m), ptr[reg_tmp]);
+    L(l_no_bias);
+
+    mov(reg_dst, ptr[param1 + GET_OFF(dst)]);
+    mov(reg_tmp, ptr[param1 + GET_OFF(dst_stride)]);
+    for (size_t m = 0; m < jcp_.m_block; m++) {
+        uni_vmovups(ptr[reg_dst], vmm_acc(m));
+        if (m + 1 < jcp_.m_block)
+            add(reg_dst, reg_tmp);
+    }
+
+    this->postamble();
+
+    align(64);
+    L(l_nibble_mask);
+    dd(0x0000000f);
+}
+
+template <cpu_isa_t isa>
+void jit_fc_weights_decompression_kernel_f32<isa>::decompress_weights(bool with_high_nibble) {
+    // every dword gets one packed byte: oc_block bytes hold two input channels for the whole OC block
+    uni_vpmovzxbd(vmm_weights_low, ptr[reg_weights]);
+    if (with_high_nibble) {
+        uni_vpsrld(vmm_weights_high, vmm_weights_low, 4);
+        uni_vcvtdq2ps(vmm_weights_high, vmm_weights_high);
+        if (jcp_.with_zero_points)
+            uni_vsubps(vmm_weights_high, vmm_weights_high, vmm_zero_point);
+    }
+    if (isa == avx512_core)
+        vpandd(vmm_weights_low, vmm_weights_low, vmm_nibble_mask);
+    else
+        vpand(vmm_weights_low, vmm_weights_low, vmm_nibble_mask);
+    uni_vcvtdq2ps(vmm_weights_low, vmm_weights_low);
+    if (jcp_.with_zero_points)
+        uni_vsubps(vmm_weights_low, vmm_weights_low, vmm_zero_point);
+}
+
+template <cpu_isa_t isa>
+void jit_fc_weights_decompression_kernel_f32<isa>::accumulate(bool with_high_nibble) {
+    for (size_t m = 0; m < jcp_.m_block; m++) {
+        uni_vbroadcastss(vmm_src, ptr[reg_src[m]]);
+        uni_vfmadd231ps(vmm_group_acc(m), vmm_weights_low, vmm_src);
+        if (with_high_nibble) {
+            uni_vbroadcastss(vmm_src, ptr[reg_src[m] + sizeof(float)]);
+            uni_vfmadd231ps(vmm_group_acc(m), vmm_weights_high, vmm_src);
+        }
+    }
+}
+
+template struct jit_fc_weights_decompression_kernel_f32<cpu::x64::avx2>;
+template struct jit_fc_weights_decompression_kernel_f32<cpu::x64::avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,107 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu/x64/jit_generator.hpp"
+#include <dnnl_types.h>
+
+namespace ov {
+namespace intel_cpu {
+
+struct jit_fc_weights_decompression_params {
+    size_t ic;               // number of input channels (K)
+    size_t group_size;       // number of input channels sharing the same scale and zero point
+    size_t m_block;          // number of activation rows processed by one call
+    bool with_zero_points;
+};
+
+struct jit_fc_weights_decompression_call_args {
+    const float* src;          // [m_block][ic] activations, rows are src_stride bytes apart
+    const uint8_t* weights;    // packed 4-bit weights of one OC block
+    const float* scales;       // [groups][oc_block]
+    const float* zero_points;  // [groups][oc_block]
+    const float* bias;         // [oc_block] or nullptr
+    float* dst;                // [m_block][oc_block] outputs, rows are dst_stride bytes apart
+    size_t src_stride;
+    size_t dst_stride;
+};
+
+/**
+ * Computes [m_block x oc_block] FullyConnected outputs from f32 activations and weights packed into 4 bits.
+ * Weights of one OC block are stored group by group as [ceil(group_size / 2)][oc_block] bytes: the low nibble keeps
+ * an even input channel of the group and the high nibble keeps the next one. The nibbles are decompressed in registers
+ * right before the accumulation: (w - zero_point) * scale, where the scale is applied once per group.
+ */
+struct jit_fc_weights_decompression_kernel {
+    explicit jit_fc_weights_decompression_kernel(const jit_fc_weights_decompression_params& jcp) : jcp_(jcp) {}
+    virtual ~jit_fc_weights_decompression_kernel() = default;
+
+    void (*ker_)(const jit_fc_weights_decompression_call_args*) = nullptr;
+
+    void operator()(const jit_fc_weights_decompression_call_args* args) const {
+        assert(ker_);
+        ker_(args);
+    }
+
+    virtual void create_ker() = 0;
+    virtual size_t get_oc_block() const = 0;
+
+    static constexpr size_t max_m_block = 4;
+
+    jit_fc_weights_decompression_params jcp_;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_fc_weights_decompression_kernel_f32 : public jit_fc_weights_decompression_kernel, public dnnl::impl::cpu::x64::jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_fc_weights_decompression_kernel_f32)
+
+    explicit jit_fc_weights_decompression_kernel_f32(const jit_fc_weights_decompression_params& jcp)
+        : jit_fc_weights_decompression_kernel(jcp), jit_generator(jit_name()) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    size_t get_oc_block() const override {
+        return oc_block;
+    }
+
+    void generate() override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    static constexpr size_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    static constexpr size_t oc_block = vlen / sizeof(float);
+
+    void decompress_weights(bool with_high_nibble);
+    void accumulate(bool with_high_nibble);
+
+    Vmm vmm_acc(size_t m) const { return Vmm(m); }
+    Vmm vmm_group_acc(size_t m) const { return Vmm(max_m_block + m); }
+
+    Vmm vmm_weights_low = Vmm(2 * max_m_block);
+    Vmm vmm_weights_high = Vmm(2 * max_m_block + 1);
+    Vmm vmm_zero_point = Vmm(2 * max_m_block + 2);
+    Vmm vmm_scale = Vmm(2 * max_m_block + 3);
+    Vmm vmm_src = Vmm(2 * max_m_block + 4);
+    Vmm vmm_nibble_mask = Vmm(2 * max_m_block + 5);
+
+    Xbyak::Reg64 reg_src[max_m_block] = {r8, r9, r10, r11};
+    Xbyak::Reg64 reg_weights = r12;
+    Xbyak::Reg64 reg_scales = r13;
+    Xbyak::Reg64 reg_zero_points = r14;
+    Xbyak::Reg64 reg_dst = r15;
+    Xbyak::Reg64 reg_groups = rbx;
+    Xbyak::Reg64 reg_pairs = rsi;
+    Xbyak::Reg64 reg_tmp = rax;
+
+    Xbyak::Label l_nibble_mask;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -203,7 +203,7 @@ void Lrn::prepareParams() {
         return std::make_shared<DnnlExecutor>(prim_desc);
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = getParamsCache();
     auto result = cache->getOrCreate(key, builder);
     execPtr = result.first;
     if (!execPtr) {
@@ -584,7 +584,7 @@ void MatMul::prepareParams() {
         return std::make_shared<DnnlExecutor>(first_desc);
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = getParamsCache();
     auto result = cache->getOrCreate(key, builder);
 
     execPtr = result.first;
@@ -78,6 +78,36 @@ void MemoryOutput::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 }
 
+void MemoryOutput::setInputNode(Node* node) {
+    inputNode = node;
+    if (auto inputMemoryNode = dynamic_cast<MemoryInput*>(node))
+        inputMemoryNode->setOutputNode(this);
+}
+
+void MemoryOutput::bindState(const MemoryPtr& next) {
+    auto parentEdge = getParentEdgeAt(0);
+    auto& srcMemory = parentEdge->getMemory();
+    if (stateBinding == StateBinding::Unknown) {
+        // the producer may write to the state buffer only if the memory is not shared with any other tensor:
+        // it is the only consumer of the producer, and the memory is not in-place or the state consumers one
+        auto parent = parentEdge->getParent();
+        bool canBeInPlace = parent->getChildEdges().size() == 1 && !parent->isConstant() && !parent->isInPlace() &&
+                            !parentEdge->inPlace() && !one_of(parent->getType(), Type::Input, Type::MemoryInput) &&
+                            srcMemory.getDesc().isCompatible(next->getDesc());
+        if (auto inputMemoryNode = dynamic_cast<MemoryInput*>(inputNode)) {
+            for (auto& edge : inputMemoryNode->getChildEdges()) {
+                auto e = edge.lock();
+                if (e && e->getMemory().getMemoryMngr() == srcMemory.getMemoryMngr())
+                    canBeInPlace = false;
+            }
+        }
+        stateBinding = canBeInPlace ? StateBinding::InPlace : StateBinding::Copy;
+    }
+
+    if (stateBinding == StateBinding::InPlace)
+        srcMemory.getMemoryMngr()->setExtBuff(next->getData(), next->getSize());
+}
+
 void MemoryOutput::execute(dnnl::stream strm)  {
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
@@ -124,6 +154,47 @@ void MemoryInput::createPrimitive() {
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
         dataStore->nullify();
+
+    currentState = dataStore;
+    nextState = dataStore;
+}
+
+bool MemoryInput::canShareState() const {
+    // the same checks as for the zero copy of the user input memory: the state must not be modified by the consumers
+    for (auto& childEdge : getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << getName() << " contains empty child edge";
+
+        auto& child = ce->getChild();
+        if (child->isConstant() || ce->inPlace(Edge::LOOK_DOWN) || ce->modifiedInPlace())
+            return false;
+
+        if (child->getType() == Type::Concatenation && child->isInPlace())
+            return false;
+
+        if (!ce->getMemory().getDesc().isCompatible(dataStore->getDesc()))
+            return false;
+    }
+    return true;
+}
+
+void MemoryInput::bindState(const MemoryPtr& current, const MemoryPtr& next) {
+    currentState = current;
+    nextState = next;
+
+    if (stateBinding == StateBinding::Unknown)
+        stateBinding = canShareState() ? StateBinding::InPlace : StateBinding::Copy;
+
+    if (stateBinding == StateBinding::InPlace) {
+        for (auto& edge : getChildEdges()) {
+            auto e = edge.lock();
+            e->getMemory().getMemoryMngr()->setExtBuff(currentState->getData(), currentState->getSize());
+        }
+    }
+
+    if (outputNode)
+        outputNode->bindState(next);
 }
 
 /**
@@ -158,17 +229,23 @@ MemoryPtr MemoryInput::getStore() {
 }
 
 void MemoryInput::storeState(const IMemory &new_state) {
+    // the producer has written the new state to the state buffer directly
+    if (new_state.getData() == nextState->getData())
+        return;
     // TODO: Should be next one call:
-    //           dataStore.load(new_state, false);
+    //           nextState.load(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*nextState, new_state);
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
+    // the consumers read the bound state buffer directly
+    if (stateBinding == StateBinding::InPlace)
+        return;
     // TODO: Should be simple call of:
-    //           dst_mem.load(dataStore, false);
+    //           dst_mem.load(currentState, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(getChildEdgeAt(0)->getMemory(), *currentState);
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
@@ -72,9 +72,13 @@ public:
         return getType() == Type::MemoryOutput;
     }
 
-    void setInputNode(Node* node) override {
-        inputNode = node;
-    }
+    void setInputNode(Node* node) override;
+
+    /**
+     * @brief Binds the producer of the new state to the state buffer, so the state is written without a copy
+     * (if the producer memory can be bound to an external buffer)
+     */
+    void bindState(const MemoryPtr& next);
 
  private:
     /**
@@ -82,6 +86,8 @@ public:
      */
     Node* inputNode = nullptr;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
+    enum class StateBinding { Unknown, InPlace, Copy };
+    StateBinding stateBinding = StateBinding::Unknown;
 };
 
 class MemoryInput : public Input, public MemoryNode {
@@ -101,11 +107,30 @@ public:
     void createPrimitive() override;
 
     void setInputNode(Node* node) override {}
+    void setOutputNode(MemoryOutput* node) {
+        outputNode = node;
+    }
     void storeState(const IMemory& mem);
     MemoryPtr getStore();
+
+    /**
+     * @brief Binds the state buffers of the running infer request: the node reads the state from the current buffer
+     * and the paired MemoryOutput writes the new state to the next one. Where possible the consumers of the state
+     * use the current buffer directly and the producer of the new state writes to the next buffer, so the state
+     * is not copied at all. Without binding the node uses own store for both.
+     */
+    void bindState(const MemoryPtr& current, const MemoryPtr& next);
+
  private:
+    bool canShareState() const;
+
     MemoryPtr dataStore;
+    MemoryPtr currentState;
+    MemoryPtr nextState;
+    MemoryOutput* outputNode = nullptr;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
+    enum class StateBinding { Unknown, InPlace, Copy };
+    StateBinding stateBinding = StateBinding::Unknown;
 };
 
 }   // namespace node
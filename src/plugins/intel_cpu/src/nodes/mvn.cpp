@@ -2079,7 +2079,7 @@ void MVN::prepareParams() {
         return executor;
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = getParamsCache();
     auto result = cache->getOrCreate(key, builder);
     execPtr = result.first;
 }
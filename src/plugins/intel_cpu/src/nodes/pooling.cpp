@@ -458,7 +458,7 @@ void Pooling::prepareParams() {
             return std::make_shared<DnnlExecutor>(first_desc);
         };
 
-        auto cache = context->getParamsCache();
+        auto cache = getParamsCache();
         auto result = cache->getOrCreate(key, builder);
 
         dnnlExecPtr = result.first;
@@ -0,0 +1,226 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "preprocess.h"
+#include "ie_parallel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+bool Preprocess::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto preprocess = ov::as_type_ptr<const PreprocessNode>(op);
+        if (!preprocess) {
+            errorMessage = "Only Preprocess from CPU internal opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+
+    return true;
+}
+
+Preprocess::Preprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    config = ov::as_type_ptr<const PreprocessNode>(op)->get_config();
+}
+
+void Preprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    srcPrecision = getOriginalInputPrecisionAtPort(0);
+    if (srcPrecision != InferenceEngine::Precision::U8) {
+        srcPrecision = InferenceEngine::Precision::FP32;
+    }
+
+    std::vector<PortConfigurator> inConfs(getOriginalInputsNumber(), {LayoutType::ncsp, srcPrecision});
+    addSupportedPrimDesc(inConfs,
+                         {{LayoutType::ncsp, InferenceEngine::Precision::FP32}},
+                         ref_any);
+}
+
+Preprocess::InterpolationTable Preprocess::makeTable(size_t srcSize, size_t dstSize) {
+    InterpolationTable table;
+    table.idx0.resize(dstSize);
+    table.idx1.resize(dstSize);
+    table.weight.resize(dstSize);
+
+    // linear interpolation with the half pixel coordinate transformation, the border pixels are replicated
+    const float ratio = static_cast<float>(srcSize) / static_cast<float>(dstSize);
+    const float maxCoord = static_cast<float>(srcSize - 1);
+    for (size_t i = 0; i < dstSize; i++) {
+        const float coord = std::min(std::max((static_cast<float>(i) + 0.5f) * ratio - 0.5f, 0.f), maxCoord);
+        const size_t idx = static_cast<size_t>(coord);
+        table.idx0[i] = idx;
+        table.idx1[i] = std::min(idx + 1, srcSize - 1);
+        table.weight[i] = coord - static_cast<float>(idx);
+    }
+    return table;
+}
+
+void Preprocess::prepareParams() {
+    const auto& srcDims = getParentEdgeAt(0)->getMemoryPtr()->getStaticDims();
+
+    batch = srcDims[0];
+    srcHeight = getOriginalInputsNumber() == 1 ? srcDims[1] * 2 / 3 : srcDims[1];
+    srcWidth = srcDims[2];
+    dstHeight = config.resize ? static_cast<size_t>(config.height) : srcHeight;
+    dstWidth = config.resize ? static_cast<size_t>(config.width) : srcWidth;
+
+    rows = makeTable(srcHeight, dstHeight);
+    cols = makeTable(srcWidth, dstWidth);
+
+    // the tables are ascending, so the merge of them is sorted
+    usedCols.resize(2 * dstWidth);
+    std::merge(cols.idx0.begin(), cols.idx0.end(), cols.idx1.begin(), cols.idx1.end(), usedCols.begin());
+    usedCols.erase(std::unique(usedCols.begin(), usedCols.end()), usedCols.end());
+    rowsBuffer.resize(parallel_get_max_threads() * 2 * srcWidth * 3);
+}
+
+template <typename T>
+void Preprocess::executeImpl() {
+    const size_t planeSize = srcHeight * srcWidth;
+    const T* y = reinterpret_cast<const T*>(getParentEdgeAt(0)->getMemoryPtr()->getData());
+    const T* u = nullptr;
+    const T* v = nullptr;
+    size_t yBatchStride = planeSize;
+    size_t uvBatchStride = 0;
+    size_t uvRowStride = 0;
+    size_t uvPixelStride = 0;
+
+    if (config.i420) {
+        uvBatchStride = planeSize / 4;
+        uvRowStride = srcWidth / 2;
+        uvPixelStride = 1;
+        if (getOriginalInputsNumber() == 1) {
+            u = y + planeSize;
+            v = u + planeSize / 4;
+        } else {
+            u = reinterpret_cast<const T*>(getParentEdgeAt(1)->getMemoryPtr()->getData());
+            v = reinterpret_cast<const T*>(getParentEdgeAt(2)->getMemoryPtr()->getData());
+        }
+    } else {
+        uvBatchStride = planeSize / 2;
+        uvRowStride = srcWidth;
+        uvPixelStride = 2;
+        u = getOriginalInputsNumber() == 1 ? y + planeSize
+                                           : reinterpret_cast<const T*>(getParentEdgeAt(1)->getMemoryPtr()->getData());
+        v = u + 1;
+    }
+    if (getOriginalInputsNumber() == 1) {
+        yBatchStride = planeSize * 3 / 2;
+        uvBatchStride = yBatchStride;
+    }
+
+    float* dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->getData());
+    const size_t dstPlaneSize = dstHeight * dstWidth;
+    const size_t rIdx = config.bgr ? 2 : 0;
+    const size_t bIdx = config.bgr ? 0 : 2;
+
+    auto clip = [](float a) {
+        if (std::is_integral<T>()) {
+            return std::min(std::max(std::round(a), 0.f), 255.f);
+        } else {
+            return std::min(std::max(a, 0.f), 255.f);
+        }
+    };
+
+    // the same color conversion as the one of ColorConvert node, so the fused pipeline matches the original one,
+    // only the columns used by the interpolation are converted
+    auto convertRow = [&](size_t b, size_t h, float* rgb) {
+        const T* yRow = y + b * yBatchStride + h * srcWidth;
+        const size_t uvOffset = b * uvBatchStride + (h / 2) * uvRowStride;
+        for (const auto w : usedCols) {
+            const size_t uvIdx = uvOffset + (w / 2) * uvPixelStride;
+            const float c = static_cast<float>(yRow[w]) - 16.f;
+            const float d = static_cast<float>(u[uvIdx]) - 128.f;
+            const float e = static_cast<float>(v[uvIdx]) - 128.f;
+            rgb[w * 3 + rIdx] = clip(1.164f * c + 1.596f * e);
+            rgb[w * 3 + 1] = clip(1.164f * c - 0.391f * d - 0.813f * e);
+            rgb[w * 3 + bIdx] = clip(1.164f * c + 2.018f * d);
+        }
+    };
+
+    const size_t rowSize = srcWidth * 3;
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(batch * dstHeight, nthr, ithr, start, end);
+
+        // consecutive output rows share the source rows, so the converted ones are kept until they are not needed
+        float* buffers[2] = {&rowsBuffer[ithr * 2 * rowSize], &rowsBuffer[(ithr * 2 + 1) * rowSize]};
+        size_t cached[2] = {SIZE_MAX, SIZE_MAX};
+        auto getRow = [&](size_t b, size_t h, size_t slot) -> const float* {
+            const size_t key = b * srcHeight + h;
+            if (cached[slot] != key) {
+                if (cached[1 - slot] == key) {
+                    std::swap(buffers[0], buffers[1]);
+                    std::swap(cached[0], cached[1]);
+                } else {
+                    convertRow(b, h, buffers[slot]);
+                    cached[slot] = key;
+                }
+            }
+            return buffers[slot];
+        };
+
+        for (size_t i = start; i < end; i++) {
+            const size_t b = i / dstHeight;
+            const size_t oh = i % dstHeight;
+            const float* row0 = getRow(b, rows.idx0[oh], 0);
+            const float* row1 = getRow(b, rows.idx1[oh], 1);
+            const float wy = rows.weight[oh];
+
+            float* dstRow = dst + b * dstPlaneSize * 3 + (config.planar ? oh * dstWidth : oh * dstWidth * 3);
+            for (size_t ow = 0; ow < dstWidth; ow++) {
+                const size_t x0 = cols.idx0[ow] * 3;
+                const size_t x1 = cols.idx1[ow] * 3;
+                const float wx = cols.weight[ow];
+                for (size_t c = 0; c < 3; c++) {
+                    const float top = row0[x0 + c] + wx * (row0[x1 + c] - row0[x0 + c]);
+                    const float bottom = row1[x0 + c] + wx * (row1[x1 + c] - row1[x0 + c]);
+                    const float val = (top + wy * (bottom - top)) * config.scale[c] + config.shift[c];
+                    if (config.planar) {
+                        dstRow[c * dstPlaneSize + ow] = val;
+                    } else {
+                        dstRow[ow * 3 + c] = val;
+                    }
+                }
+            }
+        }
+    });
+}
+
+void Preprocess::execute(dnnl::stream strm) {
+    if (srcPrecision == InferenceEngine::Precision::U8) {
+        executeImpl<uint8_t>();
+    } else {
+        executeImpl<float>();
+    }
+}
+
+void Preprocess::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+bool Preprocess::created() const {
+    return getType() == Type::Preprocess;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
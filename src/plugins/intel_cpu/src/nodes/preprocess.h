@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "transformations/cpu_opset/common/op/preprocess.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+/**
+ * Single pass implementation of PreprocessNode: every output row is computed from two source rows which are
+ * converted to RGB on the fly, so the intermediate full size RGB image is never materialized.
+ */
+class Preprocess : public Node {
+public:
+    Preprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+protected:
+    void executeDynamicImpl(dnnl::stream strm) override;
+    void prepareParams() override;
+
+private:
+    // source pixel coordinates and the weight of the second one for every output pixel along an axis
+    struct InterpolationTable {
+        std::vector<size_t> idx0;
+        std::vector<size_t> idx1;
+        std::vector<float> weight;
+    };
+
+    static InterpolationTable makeTable(size_t srcSize, size_t dstSize);
+
+    template <typename T>
+    void executeImpl();
+
+    PreprocessNode::Config config;
+    InferenceEngine::Precision srcPrecision;
+
+    size_t batch = 0;
+    size_t srcHeight = 0;
+    size_t srcWidth = 0;
+    size_t dstHeight = 0;
+    size_t dstWidth = 0;
+
+    InterpolationTable rows;
+    InterpolationTable cols;
+    // the ascending source columns referenced by cols, only they are converted when the image is downscaled
+    std::vector<size_t> usedCols;
+    // two converted RGB source rows per thread
+    std::vector<float> rowsBuffer;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -999,7 +999,7 @@ void RDFT::createPrimitive() {
         return executor;
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = getParamsCache();
     auto result = cache->getOrCreate(key, buildExecutor);
     executor = result.first;
 
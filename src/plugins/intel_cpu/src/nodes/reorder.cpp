@@ -230,7 +230,7 @@ void Reorder::createReorderPrimitive(const dnnl::memory::desc& srcDesc,
         src_desc = src_blocked->getPrimitive().get_desc();
     }
 
-    auto result = getReorderPrim(context->getParamsCache(), getEngine(), src_desc, dst_desc);
+    auto result = getReorderPrim(getParamsCache(), getEngine(), src_desc, dst_desc);
     if (!result) {
         IE_THROW() << "Cannot create reorder primitive: unsupported reorder case";
     }
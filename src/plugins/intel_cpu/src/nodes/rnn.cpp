@@ -1141,7 +1141,7 @@ void RNN::prepareParams() {
         return descPtr ? std::make_shared<RnnDnnlExecutor>(descPtr) : nullptr;
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = getParamsCache();
     auto result = cache->getOrCreate(key, builder);
     auto prevExecPtr = execPtr;
     execPtr = result.first;
@@ -197,7 +197,7 @@ void SpaceToDepth::prepareParams() {
         return std::make_shared<SpaceToDepthExecutor>(key);
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = getParamsCache();
     auto result = cache->getOrCreate(attrs, builder);
     if (!result.first) {
         IE_THROW() << "SpaceToDepthExecutor was not found for node " << getName() << ".";
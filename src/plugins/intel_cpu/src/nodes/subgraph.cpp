@@ -119,6 +119,23 @@ bool SnippetKey::operator==(const SnippetKey& rhs) const {
     return true;
 }
 
+// The key of the shape agnostic kernel: the dimensions are replaced with the broadcasting pattern
+struct SnippetShapeAgnosticKey : public SnippetKey {};
+
+// The representative dimensions the shape agnostic kernel is generated for: 1 stays 1 (broadcasting), others are 2
+std::vector<std::vector<size_t>> getBroadcastingPattern(const std::vector<std::vector<size_t>>& memBlockedDims) {
+    auto pattern = memBlockedDims;
+    for (auto& dims : pattern) {
+        for (auto& dim : dims)
+            dim = dim == 1 ? 1 : 2;
+    }
+    return pattern;
+}
+
+// The shape agnostic kernel reserves abi_param2 for the runtime arguments, so the number of data pointers is limited
+// to leave enough gprs for the Loops and the emitters
+constexpr size_t maxShapeAgnosticPorts = 8;
+
 snippets::op::Subgraph::BlockedShapeVector getBlockedShapes(const std::vector<std::vector<size_t>>& memBlockedDims,
         const std::vector<std::vector<size_t>>& memOrders, const std::vector<InferenceEngine::Precision>& memPrecs) {
     size_t numShapes = memBlockedDims.size();
@@ -333,6 +350,19 @@ void Snippet::initOptimalPrimitiveDescriptor() {
         snippetAttrs.outMemPrecs[i] = config.outConfs[i].getMemDesc()->getPrecision();
         snippetAttrs.outMemOrders[i] = config.outConfs[i].getMemDesc()->as<BlockedMemoryDesc>()->getOrder();
     }
+    // The kernel independent of the dimensions values supports only the elementwise subgraphs
+    // with the planar layouts, the offsets of the blocked and permuted ones are more complex
+    auto isPlanar = [](const MemoryDescPtr& desc) {
+        const auto& order = desc->as<BlockedMemoryDesc>()->getOrder();
+        return order.size() == desc->getShape().getRank() && order.size() <= rank6D &&
+               std::is_sorted(order.begin(), order.end());
+    };
+    is_shape_agnostic = is_dynamic && !original_snippet->has_domain_sensitive_ops() && !original_snippet->is_quantized() &&
+                        inputNum + outputNum <= maxShapeAgnosticPorts;
+    for (size_t i = 0; is_shape_agnostic && i < inputNum; i++)
+        is_shape_agnostic = isPlanar(config.inConfs[i].getMemDesc());
+    for (size_t i = 0; is_shape_agnostic && i < outputNum; i++)
+        is_shape_agnostic = isPlanar(config.outConfs[i].getMemDesc());
     // reserve fixed size.
     snippetAttrs.inMemBlockedDims.resize(inputNum);
     snippetAttrs.outMemBlockedDims.resize(outputNum);
@@ -359,15 +389,34 @@ void Snippet::prepareParams() {
         snippetAttrs.outMemBlockedDims[i] = getChildEdgesAtPort(i)[0]->getMemory().getDescWithType<BlockedMemoryDesc>()->getBlockDims();
 
     SnippetKey key = {snippetAttrs};
+    const bool enforceBF16 = context->getConfig().inferencePrecision == ov::element::bf16;
+    auto cache = getParamsCache();
+
+    // The shape agnostic kernel is generated once per broadcasting pattern,
+    // the executors of the particular shapes only update its runtime arguments
+    std::shared_ptr<SnippetJitExecutor> kernelExecutor = nullptr;
+    if (is_shape_agnostic) {
+        SnippetShapeAgnosticKey kernelKey;
+        kernelKey.attrs = snippetAttrs;
+        kernelKey.attrs.inMemBlockedDims = getBroadcastingPattern(snippetAttrs.inMemBlockedDims);
+        kernelKey.attrs.outMemBlockedDims = getBroadcastingPattern(snippetAttrs.outMemBlockedDims);
+        auto kernelBuilder = [this, enforceBF16](const SnippetShapeAgnosticKey& key) -> std::shared_ptr<SnippetJitExecutor> {
+            auto executor = std::make_shared<SnippetJitExecutor>(key.attrs, is_canonicalized, is_dynamic, enforceBF16, true);
+            is_canonicalized = true;
+            return executor;
+        };
+        kernelExecutor = cache->getOrCreate(kernelKey, kernelBuilder).first;
+    }
 
-    auto builder = [this](const SnippetKey& key) -> std::shared_ptr<SnippetExecutor> {
+    auto builder = [this, enforceBF16, &kernelExecutor](const SnippetKey& key) -> std::shared_ptr<SnippetExecutor> {
+        if (kernelExecutor)
+            return std::make_shared<SnippetJitExecutor>(key.attrs, *kernelExecutor);
         std::shared_ptr<SnippetExecutor> executor = std::make_shared<SnippetJitExecutor>(key.attrs, is_canonicalized,
-            is_dynamic, context->getConfig().inferencePrecision == ov::element::bf16);
+            is_dynamic, enforceBF16);
         is_canonicalized = true;
         return executor;
     };
 
-    auto cache = context->getParamsCache();
     auto result = cache->getOrCreate(key, builder);
     execPtr = result.first;
     if (!execPtr) {
@@ -460,6 +509,8 @@ void Snippet::SnippetJitExecutor::update_ptrs(jit_snippets_call_args& call_args,
         call_args.buffer_scratchpad_ptr =
                 reinterpret_cast<uint8_t*>(buffer_scratchpad.data()) + parallel_get_thread_num() * buffer_scratchpad_size;
     }
+    if (is_shape_agnostic)
+        call_args.runtime_args = &runtime_args;
 }
 
 void Snippet::SnippetJitExecutor::schedule_6d(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) {
@@ -500,8 +551,9 @@ void Snippet::SnippetJitExecutor::schedule_nt(const std::vector<MemoryPtr>& inMe
 Snippet::SnippetExecutor::SnippetExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16)
     : snippetAttrs(attrs), is_canonicalized(is_canonicalized), is_dynamic(is_dynamic), enforceBF16(enforceBF16) {}
 
-Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16) :
-    SnippetExecutor(attrs, is_canonicalized, is_dynamic, enforceBF16) {
+Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16,
+                                                bool is_shape_agnostic) :
+    SnippetExecutor(attrs, is_canonicalized, is_dynamic, enforceBF16), is_shape_agnostic(is_shape_agnostic) {
     numInput = snippetAttrs.inMemBlockedDims.size();
     numOutput = snippetAttrs.outMemBlockedDims.size();
     start_offset_in.resize(numInput);
@@ -538,14 +590,7 @@ Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool
 
     // initialize by maximum output dimension. Dimensions of outputs should be broadcastable
     tensorRank = std::max(static_cast<size_t>(rank6D), canonicalShape.size());
-    auto initDataSizes = [this]() {
-        dataSize.resize(numInput + numOutput);
-        for (size_t i = 0; i < numInput; i++)
-            dataSize[i] = snippetAttrs.inMemPrecs[i].size();
-        for (size_t i = 0; i < numOutput; i++)
-            dataSize[i + numInput] = snippetAttrs.outMemPrecs[i].size();
-    };
-    initDataSizes();
+    init_data_sizes();
 
     if (canonicalShape.is_dynamic())
         IE_THROW() << "Snippets: Canonicalization returned dynamic shape in static pipeline";
@@ -571,9 +616,10 @@ Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool
     tileRank = 1;
     bool dims_collapsed = false;
     fullWorkAmount = std::accumulate(masterShape.begin(), masterShape.end(), 1, std::multiplies<size_t>());
+    // the shape agnostic kernel processes only the innermost dimension, collapsing depends on the dimensions values
     if (snippet_for_generation->has_domain_sensitive_ops()) {
         tileRank = 2;
-    } else {
+    } else if (!is_shape_agnostic) {
         dims_collapsed = optimizeExecDomain(normInputShapes, normOutputShapes, masterShape, tileRank);
     }
     exec_domain = masterShape;
@@ -600,6 +646,7 @@ Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool
     }
     snippet_for_generation->set_master_shape(ov::PartialShape(masterShape));
     snippet_for_generation->set_tile_rank(tileRank);
+    snippet_for_generation->set_runtime_work_amounts(is_shape_agnostic);
 
     // generate
     jit_snippets_compile_args jcp;
@@ -608,6 +655,71 @@ Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool
     generate(&jcp);
     buffer_scratchpad_size = snippet_for_generation->get_buffer_scratchpad_size();
     buffer_scratchpad.resize(buffer_scratchpad_size * parallel_get_max_threads(), 0);
+    if (is_shape_agnostic)
+        init_runtime_args();
+}
+
+Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, const SnippetJitExecutor& kernel_executor) :
+    SnippetExecutor(attrs, true, true, kernel_executor.enforceBF16), is_shape_agnostic(true) {
+    numInput = snippetAttrs.inMemBlockedDims.size();
+    numOutput = snippetAttrs.outMemBlockedDims.size();
+    start_offset_in.resize(numInput);
+    start_offset_out.resize(numOutput);
+    init_data_sizes();
+    // the kernel is shared, the body is not touched: the layouts are planar, so the shapes are just aligned to 6D
+    snippet_for_generation = kernel_executor.snippet_for_generation;
+    schedule = kernel_executor.schedule;
+    tensorRank = rank6D;
+    normInputShapes.clear();
+    for (const auto& dims : snippetAttrs.inMemBlockedDims)
+        normInputShapes.push_back(getNormalizedDimsBySize(dims, tensorRank));
+    normOutputShapes.clear();
+    for (const auto& dims : snippetAttrs.outMemBlockedDims)
+        normOutputShapes.push_back(getNormalizedDimsBySize(dims, tensorRank));
+    masterShape = VectorDims(tensorRank, 1);
+    for (const auto& shapes : {normInputShapes, normOutputShapes}) {
+        for (const auto& shape : shapes) {
+            for (size_t i = 0; i < tensorRank; i++) {
+                if (shape[i] != 1)
+                    masterShape[i] = shape[i];
+            }
+        }
+    }
+
+    tileRank = 1;
+    fullWorkAmount = std::accumulate(masterShape.begin(), masterShape.end(), 1, std::multiplies<size_t>());
+    exec_domain = masterShape;
+    exec_domain.back() = 1;
+    harnessWorkAmount = std::accumulate(exec_domain.begin(), exec_domain.end(), 1, std::multiplies<size_t>());
+    init_runtime_args();
+}
+
+void Snippet::SnippetJitExecutor::init_data_sizes() {
+    dataSize.resize(numInput + numOutput);
+    for (size_t i = 0; i < numInput; i++)
+        dataSize[i] = snippetAttrs.inMemPrecs[i].size();
+    for (size_t i = 0; i < numOutput; i++)
+        dataSize[i + numInput] = snippetAttrs.outMemPrecs[i].size();
+}
+
+void Snippet::SnippetJitExecutor::init_runtime_args() {
+    if (tensorRank != rank6D || numInput + numOutput > SNIPPETS_MAX_SNIPPETS_DIMS * 2)
+        IE_THROW() << "Snippets: shape agnostic kernel got unsupported rank or number of inputs and outputs";
+    runtime_args = jit_snippets_runtime_args();
+    runtime_args.work_amounts[0] = static_cast<int64_t>(masterShape.back());
+    // The same offsets as the Kernel calculates in the static case: the broadcasted dims don't shift the pointers,
+    // the innermost dim is processed by the Loops
+    auto init_offsets = [this](const VectorDims& shape, size_t data_size, int64_t* offsets) {
+        int64_t dim_step = 1;
+        for (int k = static_cast<int>(tensorRank) - 2; k >= 0; k--) {
+            dim_step *= static_cast<int64_t>(shape[k + 1]);
+            offsets[k] = shape[k] != 1 ? dim_step * static_cast<int64_t>(data_size) : 0;
+        }
+    };
+    for (size_t i = 0; i < numInput; i++)
+        init_offsets(normInputShapes[i], dataSize[i], runtime_args.data_offsets[i]);
+    for (size_t i = 0; i < numOutput; i++)
+        init_offsets(normOutputShapes[i], dataSize[numInput + i], runtime_args.data_offsets[numInput + i]);
 }
 
 ov::PartialShape Snippet::SnippetJitExecutor::canonicalizeBody(bool reshape) {
@@ -86,6 +86,8 @@ private:
     mutable SnippetAttrs snippetAttrs;
     mutable bool is_canonicalized = false;
     bool is_dynamic = false;
+    // true if one kernel serves all the shapes with the same broadcasting pattern, see SnippetJitExecutor
+    bool is_shape_agnostic = false;
 
     class SnippetExecutor {
         public:
@@ -104,7 +106,10 @@ private:
 
     class SnippetJitExecutor : public SnippetExecutor {
         public:
-            SnippetJitExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16);
+            SnippetJitExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16,
+                               bool is_shape_agnostic = false);
+            // reuses the shape agnostic kernel of kernel_executor for the shapes of attrs
+            SnippetJitExecutor(const SnippetAttrs& attrs, const SnippetJitExecutor& kernel_executor);
             void exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) override;
 
             bool schedule_created();
@@ -122,6 +127,9 @@ private:
             bool optimizeExecDomain(std::vector<VectorDims>&, std::vector<VectorDims>&, VectorDims&, size_t&) const;
 
             void generate(const jit_snippets_compile_args*);
+            void init_data_sizes();
+            // fills the shape dependent arguments of the shape agnostic kernel
+            void init_runtime_args();
             inline void update_ptrs(jit_snippets_call_args&, const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs);
             // Evaluates generated snippet using parallel backend
             void schedule_6d(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs);
@@ -156,6 +164,10 @@ private:
             // Buffer scratchpad
             std::vector<uint8_t> buffer_scratchpad = {};
             size_t buffer_scratchpad_size = 0;
+
+            // The kernel reads the Loops work amounts and the data offsets from runtime_args
+            bool is_shape_agnostic = false;
+            jit_snippets_runtime_args runtime_args;
     };
 };
 
@@ -78,6 +78,43 @@ static void nullifyUndefinedDims(VectorDims& dims) {
     });
 }
 
+// the body input memory may be rebound to an external buffer only if the body doesn't modify it
+static bool canRebindInputMemory(const Node* inputNode) {
+    for (const auto& childEdge : inputNode->getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            return false;
+
+        const auto& child = ce->getChild();
+        if (child->isConstant() || ce->inPlace(Edge::LOOK_DOWN) || ce->modifiedInPlace())
+            return false;
+
+        if (child->getType() == Type::Concatenation && child->isInPlace())
+            return false;
+    }
+    return true;
+}
+
+// the body output memory may be rebound to an external buffer only if the producer is its exclusive owner
+static bool canRebindOutputMemory(const EdgePtr& parentEdge) {
+    const auto parent = parentEdge->getParent();
+    return parent->getChildEdges().size() == 1 && !parent->isConstant() && !parent->isInPlace() &&
+           !parentEdge->inPlace() && !one_of(parent->getType(), Type::Input, Type::MemoryInput);
+}
+
+// the iteration chunk of a plain tensor is a dense tensor itself if all the outer dimensions are equal to 1
+static bool isDenseChunk(const MemoryPtr& full, const MemoryPtr& part, const int axis) {
+    if (!full->getDesc().hasLayoutType(LayoutType::ncsp))
+        return false;
+
+    const auto& full_dims = full->getStaticDims();
+    if (std::any_of(full_dims.begin(), full_dims.begin() + axis, [](size_t dim) { return dim != 1; }))
+        return false;
+
+    const CpuBlockedMemoryDesc chunk_desc(full->getDesc().getPrecision(), part->getShape());
+    return part->getDesc().isCompatible(chunk_desc);
+}
+
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(MultiCachePtr cache, const MemoryPtr &from, const MemoryPtr &to, bool sliced_src,
@@ -145,6 +182,53 @@ private:
     int iter_count;
 };
 
+/**
+ * Zero-copy alternative of PortIteratorHelper: instead of copying the iteration chunk, the body port memory
+ * is rebound to the chunk of the full tensor. Applicable only if the chunk is dense (see isDenseChunk).
+ */
+class PortViewHelper : public PortMapHelper {
+public:
+    PortViewHelper(const MemoryPtr &from, const MemoryPtr &to, bool sliced_src, const PortMap &slice_rule) {
+        const auto &full_blob = sliced_src ? from : to;
+        const auto &part_blob = !sliced_src ? from : to;
+
+        const auto axis = slice_rule.axis;
+        const auto stride = slice_rule.stride;
+        const auto abs_stride = std::abs(stride);
+        const auto &full_dims = full_blob->getStaticDims();
+
+        iter_count = full_dims[axis] / abs_stride;
+
+        const auto elem_size = full_blob->getDesc().getPrecision().size();
+        const auto chunk_unit = std::accumulate(full_dims.begin() + axis + 1, full_dims.end(), elem_size, std::multiplies<size_t>());
+
+        chunk_stride_in_byte = static_cast<ptrdiff_t>(chunk_unit * abs_stride);
+        chunk_offset_in_byte = stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= stride < 0 ? -1 : 1;
+
+        full_mem = full_blob->getPrimitive();
+        part_mngr = part_blob->getMemoryMngr();
+        part_size = part_blob->getSize();
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        part_mngr->setExtBuff(static_cast<uint8_t *>(full_mem.get_data_handle()) +
+                              chunk_offset_in_byte + chunk_stride_in_byte * iter, part_size);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    dnnl::memory full_mem;
+    MemoryMngrPtr part_mngr;
+    size_t part_size = 0;
+
+    int iter_count;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(MultiCachePtr cache, const MemoryPtr &from, const MemoryPtr &to, const dnnl::engine& eng) {
@@ -160,6 +244,39 @@ public:
     }
 };
 
+/**
+ * Zero-copy alternative of BackEdgePortHelper: the body output and the body input of the back edge are bound
+ * to a pair of private buffers, which are swapped before each iteration except the first one.
+ * The buffers are private since the graph workspace regions of the body ports are reused by other tensors.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const MemoryPtr &from, const MemoryPtr &to, const dnnl::engine& eng)
+        : from_mngr(from->getMemoryMngr()), to_mngr(to->getMemoryMngr()) {
+        from_buffer = std::make_shared<Memory>(eng, from->getDescPtr());
+        to_buffer = std::make_shared<Memory>(eng, to->getDescPtr());
+        bind();
+    }
+
+    void execute(dnnl::stream strm, int iter = -1) override {
+        if (iter != 0) {
+            std::swap(from_buffer, to_buffer);
+            bind();
+        }
+    }
+
+private:
+    void bind() {
+        from_mngr->setExtBuff(from_buffer->getData(), from_buffer->getSize());
+        to_mngr->setExtBuff(to_buffer->getData(), to_buffer->getSize());
+    }
+
+    MemoryMngrPtr from_mngr;
+    MemoryMngrPtr to_mngr;
+    MemoryPtr from_buffer;
+    MemoryPtr to_buffer;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MemoryPtr &to, const dnnl::engine& eng) {
@@ -415,6 +532,7 @@ void TensorIterator::getSupportedDescriptors() {
         auto inNode = inMap.find(param->get_friendly_name());
         if (inNode != inMap.end()) {
             input_mems.push_back(getToMemories(inNode->second.get(), 0));
+            input_mem_bindable.push_back(canRebindInputMemory(inNode->second.get()));
         }
     }
 
@@ -426,9 +544,28 @@ void TensorIterator::getSupportedDescriptors() {
         if (outNode != outMap.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             output_mem.push_back(outMem);
+            output_mem_bindable.push_back(canRebindOutputMemory(outNode->second->getParentEdgeAt(0)));
         }
     }
 
+    // the memory shared by several body ports can't be rebound for one of them
+    const auto countPortsSharingMemory = [&](const MemoryPtr& mem) {
+        const auto mngr = mem->getMemoryMngr();
+        const auto sameMngr = [&](const MemoryPtr& other) { return other->getMemoryMngr() == mngr; };
+        size_t count = std::count_if(output_mem.begin(), output_mem.end(), sameMngr);
+        for (const auto& mems : input_mems)
+            count += sameMngr(mems.front()) ? 1 : 0;
+        return count;
+    };
+    for (size_t i = 0; i < input_mems.size(); i++) {
+        if (countPortsSharingMemory(input_mems[i].front()) > 1)
+            input_mem_bindable[i] = false;
+    }
+    for (size_t i = 0; i < output_mem.size(); i++) {
+        if (countPortsSharingMemory(output_mem[i]) > 1)
+            output_mem_bindable[i] = false;
+    }
+
     // Port map: outputs
     for (const auto& desc : tiOp->get_output_descriptions()) {
         auto body_output_idx = desc->m_body_value_index;
@@ -548,6 +685,8 @@ void TensorIterator::prepareParams() {
     first_mappers.clear();
     before_mappers.clear();
     back_mappers.clear();
+    boundViewsCount = 0;
+    swappedBackEdgesCount = 0;
 
     if ((lastUsedCond && lastUsedTripCount != 0) || !isDynamicNode()) {
         reshapeSubgraphInput();
@@ -557,8 +696,9 @@ void TensorIterator::prepareParams() {
         prepareLoopBodyCurrentIteration();
 
         if (!isDynamicNode()) {
-            prepareOutputPorts();
+            // the output views are bound after the back edges have read the outputs of the previous iteration
             prepareBackEdges();
+            prepareOutputPorts();
         }
 
         // reset local states of DynamicBuffer
@@ -638,10 +778,13 @@ void TensorIterator::prepareInputPorts() {
         auto &to_mem = input_mems[map_rule.to].front();  // first memory is enough to access the shared underlying physical memory
 
         if (map_rule.axis == -1)
-            first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
-        else
+            first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(getParamsCache(), from_mem, to_mem, eng));
+        else if (canBindInputView(map_rule)) {
+            before_mappers.emplace_back(std::make_shared<PortViewHelper>(from_mem, to_mem, true, map_rule));
+            boundViewsCount++;
+        } else
             before_mappers.emplace_back(
-                    std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, true, map_rule, eng));
+                    std::make_shared<PortIteratorHelper>(getParamsCache(), from_mem, to_mem, true, map_rule, eng));
     }
 }
 
@@ -652,9 +795,13 @@ void TensorIterator::prepareOutputPorts() {
         auto &from_mem = output_mem[map_rule.to];
 
         if (map_rule.axis == -1)
-            last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
-        else
-            after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, false, map_rule, eng));
+            last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(getParamsCache(), from_mem, to_mem, eng));
+        else if (canBindOutputView(map_rule)) {
+            // the body writes the iteration result right into the output chunk
+            before_mappers.emplace_back(std::make_shared<PortViewHelper>(from_mem, to_mem, false, map_rule));
+            boundViewsCount++;
+        } else
+            after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(getParamsCache(), from_mem, to_mem, false, map_rule, eng));
     }
 }
 
@@ -664,10 +811,55 @@ void TensorIterator::prepareBackEdges() {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mems[map_rule.to].front();
 
-        before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        if (canSwapBackEdge(map_rule)) {
+            before_mappers.emplace_back(std::make_shared<BackEdgeSwapHelper>(from_mem, to_mem, eng));
+            swappedBackEdgesCount++;
+        } else
+            before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(getParamsCache(), from_mem, to_mem, eng));
     }
 }
 
+/* The body ports are rebound to external buffers only for static shapes: the dynamic body shares memory managers
+ * between the tensors with non-overlapping lifetimes, so the rebinding of one port would affect the others. */
+
+bool TensorIterator::canBindInputView(const PortMap& map_rule) const {
+    if (isDynamicNode() || !input_mem_bindable[map_rule.to])
+        return false;
+
+    const auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
+    return isDenseChunk(from_mem, input_mems[map_rule.to].front(), map_rule.axis);
+}
+
+bool TensorIterator::canBindOutputView(const PortMap& map_rule) const {
+    if (isDynamicNode() || !output_mem_bindable[map_rule.to])
+        return false;
+
+    // a single output chunk per body output
+    const auto sameBodyOutput = [&](const PortMap& rule) { return rule.to == map_rule.to; };
+    if (std::count_if(outputPortMap.begin(), outputPortMap.end(), sameBodyOutput) != 1)
+        return false;
+
+    const auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
+    return isDenseChunk(to_mem, output_mem[map_rule.to], map_rule.axis);
+}
+
+bool TensorIterator::canSwapBackEdge(const PortMap& back_edge) const {
+    if (isDynamicNode() || !output_mem_bindable[back_edge.from] || !input_mem_bindable[back_edge.to])
+        return false;
+
+    const auto sameBodyOutput = [&](const PortMap& rule) { return rule.from == back_edge.from; };
+    if (std::count_if(backEdges.begin(), backEdges.end(), sameBodyOutput) != 1)
+        return false;
+
+    // the output is already bound to the chunks of the sliced output
+    for (const auto& map_rule : outputPortMap) {
+        if (map_rule.to == back_edge.from && map_rule.axis != -1 && canBindOutputView(map_rule))
+            return false;
+    }
+
+    return output_mem[back_edge.from]->getDesc().isCompatible(input_mems[back_edge.to].front()->getDesc());
+}
+
 void TensorIterator::prepareDynamicBackEdges() {
     const auto &eng = getEngine();
     back_mappers.clear();
@@ -678,7 +870,7 @@ void TensorIterator::prepareDynamicBackEdges() {
         redefineToMemories(to_mems, from_mem->getDescPtr());
 
         // first memory is enough to get common memory ptr
-        back_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mems.front(), eng));
+        back_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(getParamsCache(), from_mem, to_mems.front(), eng));
     }
 }
 
@@ -763,7 +955,7 @@ void TensorIterator::reshapeAndFillOutput(dnnl::stream strm) {
             redefineToMemories(to_mems, desc);
 
             if (!newShape.isDynamic()) {
-                BackEdgePortHelper mapper(context->getParamsCache(), from_mem, to_mems.front(), eng);
+                BackEdgePortHelper mapper(getParamsCache(), from_mem, to_mems.front(), eng);
                 mapper.execute(strm);
             }
         }
@@ -113,6 +113,10 @@ public:
     void execute(dnnl::stream strm) override;
     bool isExecutable() const override { return true; }
 
+    /* The numbers of the body ports bound to the external buffers instead of copying the data */
+    size_t getBoundViewsCount() const { return boundViewsCount; }
+    size_t getSwappedBackEdgesCount() const { return swappedBackEdgesCount; }
+
 protected:
     //  needShapeInfer() should return false
     //  because we cannot resolve the output dimensions before the inference is completed
@@ -133,6 +137,11 @@ private:
     void prepareInitialCond();
     void prepareTripCount();
 
+    /* Zero-copy binding of the body ports */
+    bool canBindInputView(const PortMap& map_rule) const;
+    bool canBindOutputView(const PortMap& map_rule) const;
+    bool canSwapBackEdge(const PortMap& back_edge) const;
+
     /* Dynamic support */
     void reshapeSubgraphInput();
     void reshapeAndFillOutput(dnnl::stream strm);
@@ -143,6 +152,10 @@ private:
     Graph sub_graph;
     std::vector<std::vector<MemoryPtr>> input_mems;
     std::vector<MemoryPtr> output_mem;
+    std::vector<bool> input_mem_bindable;   /// < The body input memory may be rebound to an external buffer
+    std::vector<bool> output_mem_bindable;  /// < The body output memory may be rebound to an external buffer
+    size_t boundViewsCount = 0;             /// < The sliced ports bound to the iteration chunks
+    size_t swappedBackEdgesCount = 0;       /// < The back edges served by the swapped buffers
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
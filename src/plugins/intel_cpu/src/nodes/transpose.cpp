@@ -142,7 +142,7 @@ void Transpose::prepareParams() {
         auto dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
         auto dstDesc = dstMemPtr->getDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
         auto srcDesc = dnnl::memory::desc(dstDesc.get_dims(), dstDesc.get_data_type(), memory::format_tag::acdb);
-        auto result = getReorderPrim(context->getParamsCache(), getEngine(), srcDesc, dstDesc);
+        auto result = getReorderPrim(getParamsCache(), getEngine(), srcDesc, dstDesc);
         if (!result) {
             IE_THROW() << "Reorder primitive descriptor was not found for Transpose node " << getName() << ".";
         }
@@ -183,7 +183,7 @@ void Transpose::prepareParams() {
         return jitExec;
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = getParamsCache();
     auto result = cache->getOrCreate(transposeParams.permuteParams, builder);
 
     if (!result.first) {
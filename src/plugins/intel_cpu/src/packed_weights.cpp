@@ -0,0 +1,154 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "packed_weights.h"
+
+#include <common/utils.hpp>
+#include "utils/general_utils.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr char packedWeightsMagic[8] = {'C', 'P', 'U', 'P', 'A', 'C', 'K', 'W'};
+constexpr uint64_t packedWeightsVersion = 1;
+constexpr size_t packedWeightsAlignment = 64;
+
+/*
+    Format:
+    [ SectionHeader ]
+    [ Entry 0       ] [uint64_t key size][key][uint64_t data size][padding][data aligned to 64 bytes]
+    ...
+    [ Entry N-1     ]
+*/
+struct SectionHeader {
+    char magic[8];
+    uint64_t version;
+    uint64_t count;
+    uint64_t payloadSize;
+};
+
+size_t entryDataOffset(size_t entryOffset, const std::string& key) {
+    return rnd_up(entryOffset + 2 * sizeof(uint64_t) + key.size(), packedWeightsAlignment);
+}
+}  // namespace
+
+std::string PackedWeights::makeKey(const std::string& nodeName, const std::string& format, size_t srcSize) {
+    return nodeName + "_" + format + "_" + std::to_string(srcSize);
+}
+
+void PackedWeights::add(const std::string& key, const MemoryCPtr& memory) {
+    entries[key] = {memory->getData(), memory->getSize()};
+    memories.push_back(memory);
+}
+
+const void* PackedWeights::find(const std::string& key, size_t size) const {
+    auto found = entries.find(key);
+    if (found == entries.end() || found->second.size != size) {
+        misses++;
+        return nullptr;
+    }
+    hits++;
+    return found->second.data;
+}
+
+PackedWeights::Statistics PackedWeights::getStatistics() const {
+    Statistics result;
+    result.stored = entries.size();
+    result.hits = hits;
+    result.misses = misses;
+    return result;
+}
+
+void PackedWeights::serialize(std::ostream& stream) const {
+    if (entries.empty())
+        return;
+
+    size_t payloadSize = 0;
+    for (const auto& entry : entries)
+        payloadSize = entryDataOffset(payloadSize, entry.first) + entry.second.size;
+
+    SectionHeader hdr = {};
+    std::copy(std::begin(packedWeightsMagic), std::end(packedWeightsMagic), hdr.magic);
+    hdr.version = packedWeightsVersion;
+    hdr.count = entries.size();
+    hdr.payloadSize = payloadSize;
+    stream.write(reinterpret_cast<const char*>(&hdr), sizeof hdr);
+
+    const std::vector<char> padding(packedWeightsAlignment, 0);
+    size_t offset = 0;
+    for (const auto& entry : entries) {
+        const auto& key = entry.first;
+        const uint64_t keySize = key.size();
+        const uint64_t dataSize = entry.second.size;
+        const size_t dataOffset = entryDataOffset(offset, key);
+
+        stream.write(reinterpret_cast<const char*>(&keySize), sizeof keySize);
+        stream.write(key.data(), keySize);
+        stream.write(reinterpret_cast<const char*>(&dataSize), sizeof dataSize);
+        stream.write(padding.data(), dataOffset - (offset + 2 * sizeof(uint64_t) + keySize));
+        stream.write(static_cast<const char*>(entry.second.data), dataSize);
+
+        offset = dataOffset + dataSize;
+    }
+}
+
+PackedWeights::Ptr PackedWeights::deserialize(std::istream& stream) {
+    SectionHeader hdr = {};
+    stream.read(reinterpret_cast<char*>(&hdr), sizeof hdr);
+    if (!stream || !std::equal(std::begin(packedWeightsMagic), std::end(packedWeightsMagic), hdr.magic)) {
+        // the model was exported without packed weights
+        stream.clear();
+        return nullptr;
+    }
+
+    if (hdr.version != packedWeightsVersion || hdr.payloadSize == 0)
+        return nullptr;
+
+    auto result = std::make_shared<PackedWeights>();
+    // the whole section is read at once, the nodes use the data directly
+    void* data = dnnl::impl::malloc(hdr.payloadSize, packedWeightsAlignment);
+    if (!data)
+        IE_THROW() << "Failed to allocate " << hdr.payloadSize << " bytes of memory for the packed weights";
+    result->buffer = std::shared_ptr<void>(data, dnnl::impl::free);
+
+    stream.read(static_cast<char*>(data), hdr.payloadSize);
+    if (!stream)
+        IE_THROW(NetworkNotRead) << "The packed weights section of the exported model is truncated";
+
+    const auto* base = static_cast<const uint8_t*>(data);
+    size_t offset = 0;
+    auto readSize = [&]() {
+        if (offset + sizeof(uint64_t) > hdr.payloadSize)
+            IE_THROW(NetworkNotRead) << "The packed weights section of the exported model is corrupted";
+        uint64_t value = 0;
+        std::memcpy(&value, base + offset, sizeof value);
+        offset += sizeof value;
+        return static_cast<size_t>(value);
+    };
+
+    for (uint64_t i = 0; i < hdr.count; i++) {
+        const size_t keySize = readSize();
+        if (offset + keySize > hdr.payloadSize)
+            IE_THROW(NetworkNotRead) << "The packed weights section of the exported model is corrupted";
+        std::string key(reinterpret_cast<const char*>(base + offset), keySize);
+        offset += keySize;
+
+        const size_t dataSize = readSize();
+        offset = rnd_up(offset, packedWeightsAlignment);
+        if (offset + dataSize > hdr.payloadSize)
+            IE_THROW(NetworkNotRead) << "The packed weights section of the exported model is corrupted";
+
+        result->entries[key] = {base + offset, dataSize};
+        offset += dataSize;
+    }
+
+    return result;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
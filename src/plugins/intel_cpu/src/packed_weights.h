@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Storage of the weights already reordered to the layouts required by the primitives (packed weights).
+ * The packed weights are appended to the exported model, so the import does not need to reorder the weights
+ * again: the nodes use the imported data directly without any copy.
+ *
+ * The key includes the node name, the serialized target format and the source weights size, so the imported
+ * data is used only if the imported graph selects exactly the same layout (e.g. the ISA is the same).
+ *
+ * Is not thread safe for modification, but may be concurrently read.
+ */
+class PackedWeights {
+public:
+    typedef std::shared_ptr<PackedWeights> Ptr;
+    typedef std::shared_ptr<const PackedWeights> CPtr;
+
+    struct Statistics {
+        uint64_t stored = 0;  // the packed weights available
+        uint64_t hits = 0;    // the weights taken from the storage instead of the reorder
+        uint64_t misses = 0;  // the weights reordered since the storage has no data with the same key and size
+    };
+
+    static std::string makeKey(const std::string& nodeName, const std::string& format, size_t srcSize);
+
+    void add(const std::string& key, const MemoryCPtr& memory);
+
+    /**
+     * @brief Looks for the packed weights data
+     * @param key packed weights key created by makeKey()
+     * @param size expected size of the packed weights in bytes
+     * @return pointer to the data or nullptr if there is no packed weights with such key and size
+     */
+    const void* find(const std::string& key, size_t size) const;
+
+    bool empty() const {
+        return entries.empty();
+    }
+
+    Statistics getStatistics() const;
+
+    void serialize(std::ostream& stream) const;
+
+    /**
+     * @brief Reads the packed weights section written by serialize()
+     * @return the packed weights or nullptr if the stream does not contain such a section (e.g. older blob format)
+     */
+    static Ptr deserialize(std::istream& stream);
+
+private:
+    struct Entry {
+        const void* data;
+        size_t size;
+    };
+
+    std::map<std::string, Entry> entries;
+    std::vector<MemoryCPtr> memories;  // holds the data of the weights added for export
+    std::shared_ptr<void> buffer;      // holds the data of the imported weights
+
+    mutable std::atomic<uint64_t> hits{0};
+    mutable std::atomic<uint64_t> misses{0};
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
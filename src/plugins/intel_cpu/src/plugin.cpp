@@ -20,6 +20,7 @@
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "internal_properties.hpp"
 
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
@@ -27,6 +28,8 @@
 #include "performance_heuristics.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "weights_cache.hpp"
+#include "packed_weights.h"
+#include "openvino/util/file_util.hpp"
 #include "utils/denormals.hpp"
 
 #if defined(__linux__)
@@ -447,6 +450,18 @@ static Config::ModelType getModelType(const std::shared_ptr<const Model>& model)
            Config::ModelType::CNN : Config::ModelType::Unknown;
 }
 
+// the generated JIT kernels are stored next to the compiled models blobs
+static std::string getJitCacheDir(const std::shared_ptr<InferenceEngine::ICore>& core, const std::string& deviceName) {
+    if (!core)
+        return {};
+    try {
+        const auto cacheDir = core->get_property(deviceName, ov::cache_dir);
+        return cacheDir.empty() ? std::string{} : ov::util::path_join({cacheDir, "cpu_jit_kernels"});
+    } catch (const std::exception&) {
+        return {};
+    }
+}
+
 static Config::SnippetsMode getSnippetsMode(const std::map<std::string, std::string>& modelConfig, const Config& engineConfig) {
     const auto& snippetsMode = modelConfig.find(InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE);
     if (snippetsMode == modelConfig.end()) // not set explicitly
@@ -511,6 +526,7 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     Config conf = engConfig;
 
     conf.readProperties(config, modelType);
+    conf.jitCacheDir = getJitCacheDir(GetCore(), GetName());
     CalculateStreams(conf, nGraphFunc);
 
     transformations.PostLpt();
@@ -722,7 +738,15 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (ov::internal::supported_properties == name) {
         return decltype(ov::internal::supported_properties)::value_type{
             ov::PropertyName{ov::internal::caching_properties.name(), ov::PropertyMutability::RO},
-            ov::PropertyName{ov::internal::exclusive_async_requests.name(), ov::PropertyMutability::RW}};
+            ov::PropertyName{ov::internal::exclusive_async_requests.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::intel_cpu::enable_parallel_branches.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::intel_cpu::shared_runtime_cache.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::intel_cpu::shared_weights.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::intel_cpu::shared_weights_dir.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::intel_cpu::streams_work_stealing.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::intel_cpu::shape_infer_cache_capacity.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::intel_cpu::dynamic_memory_planning.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::intel_cpu::telemetry_sampling_rate.name(), ov::PropertyMutability::RW}};
     } else if (name == ov::device::full_name) {
         return decltype(ov::device::full_name)::value_type(deviceFullName);
     } else if (name == ov::available_devices) {
@@ -753,6 +777,22 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(engConfig.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(engConfig.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::enable_parallel_branches) {
+        return decltype(ov::intel_cpu::enable_parallel_branches)::value_type(engConfig.enableParallelBranches);
+    } else if (name == ov::intel_cpu::shared_runtime_cache) {
+        return decltype(ov::intel_cpu::shared_runtime_cache)::value_type(engConfig.sharedRtCache);
+    } else if (name == ov::intel_cpu::shared_weights) {
+        return decltype(ov::intel_cpu::shared_weights)::value_type(engConfig.sharedWeights);
+    } else if (name == ov::intel_cpu::shared_weights_dir) {
+        return decltype(ov::intel_cpu::shared_weights_dir)::value_type(engConfig.sharedWeightsDir);
+    } else if (name == ov::intel_cpu::streams_work_stealing) {
+        return decltype(ov::intel_cpu::streams_work_stealing)::value_type(engConfig.streamExecutorConfig._work_stealing);
+    } else if (name == ov::intel_cpu::shape_infer_cache_capacity) {
+        return decltype(ov::intel_cpu::shape_infer_cache_capacity)::value_type(engConfig.shapeInferCacheCapacity);
+    } else if (name == ov::intel_cpu::dynamic_memory_planning) {
+        return decltype(ov::intel_cpu::dynamic_memory_planning)::value_type(engConfig.dynamicMemoryPlanning);
+    } else if (name == ov::intel_cpu::telemetry_sampling_rate) {
+        return decltype(ov::intel_cpu::telemetry_sampling_rate)::value_type(engConfig.telemetrySamplingRate);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -821,14 +861,18 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
     CNNNetwork cnnnetwork;
     deserializer >> cnnnetwork;
 
+    // optional section with the weights already reordered by the exported model
+    auto packedWeights = PackedWeights::deserialize(networkModel);
+
     auto function = cnnnetwork.getFunction();
     Config::ModelType modelType = getModelType(function);
     Config conf = engConfig;
     conf.readProperties(config, modelType);
+    conf.jitCacheDir = getJitCacheDir(GetCore(), GetName());
 
     CalculateStreams(conf, function, true);
 
-    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this(), packedWeights);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -0,0 +1,275 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_weights_store.h"
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+#include "onednn/dnnl.h"
+#include "common/primitive_hashing_utils.hpp"
+#include "openvino/core/hash_util.hpp"
+#include "openvino/core/version.hpp"
+#include "openvino/util/file_util.hpp"
+
+#if defined(__linux__)
+# include <fcntl.h>
+# include <sys/file.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr char fileMagic[8] = {'O', 'V', 'C', 'P', 'U', 'W', 'E', 'I'};
+// the data starts at the page boundary after the header
+constexpr size_t dataOffset = 4096;
+
+// the header is followed by the data checksum line
+std::string fileHeader(const std::string& key, size_t dataSize) {
+    std::ostringstream header;
+    header.write(fileMagic, sizeof(fileMagic));
+    header << ov::get_openvino_version().buildNumber << '\n' << key << '\n' << dataSize << '\n';
+    return header.str();
+}
+
+std::string checksumLine(const void* data, size_t dataSize) {
+    std::ostringstream line;
+    line << std::hex << ov::util::hash_xxh64(data, dataSize) << '\n';
+    return line.str();
+}
+
+#if defined(__linux__)
+// the published files are trusted only if nobody but the current user can create or modify them
+bool isPrivateDirectory(const std::string& dir) {
+    struct stat dirStat = {};
+    if (stat(dir.c_str(), &dirStat) != 0 || !S_ISDIR(dirStat.st_mode) || dirStat.st_uid != geteuid())
+        return false;
+    if ((dirStat.st_mode & (S_IRWXG | S_IRWXO)) != 0 && chmod(dir.c_str(), S_IRWXU) != 0)
+        return false;
+    return true;
+}
+
+bool isOwnFile(const struct stat& fileStat) {
+    return S_ISREG(fileStat.st_mode) && fileStat.st_uid == geteuid() && (fileStat.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+}
+
+bool isSameFile(const struct stat& lhs, const struct stat& rhs) {
+    return lhs.st_dev == rhs.st_dev && lhs.st_ino == rhs.st_ino;
+}
+#endif
+}   // namespace
+
+SharedWeightsStore::Ptr SharedWeightsStore::get(const std::string& dir) {
+    static std::mutex registryMutex;
+    static std::map<std::string, std::weak_ptr<SharedWeightsStore>> registry;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    auto& store = registry[dir];
+    auto result = store.lock();
+    if (!result) {
+        result = std::make_shared<SharedWeightsStore>(dir);
+        store = result;
+    }
+    return result;
+}
+
+SharedWeightsStore::SharedWeightsStore(std::string dir) : directory(std::move(dir)) {
+    if (directory.empty())
+        return;
+#if defined(__linux__)
+    ov::util::create_directory_recursive(directory);
+    // the weights are shared within the process only if the directory may be modified by the other users
+    if (!isPrivateDirectory(directory))
+        directory.clear();
+#else
+    directory.clear();
+#endif
+}
+
+std::string SharedWeightsStore::makeKey(const DnnlMemoryDesc& srcDesc,
+                                       const DnnlMemoryDesc& dstDesc,
+                                       const void* data,
+                                       uint64_t dataHash) {
+    using namespace dnnl::impl::primitive_hashing;
+    // the seed of the data hash which is independent of the hash identifying the source
+    constexpr uint64_t dataSeed = 0x9E3779B97F4A7C15ull;
+    const auto size = srcDesc.getCurrentMemSize();
+    // the descriptors hashes cover the data types, the dimensions, the layouts and the compensations, the two
+    // independent 64 bit hashes make the collision of the different weights improbable
+    std::ostringstream key;
+    key << dstDesc.serializeFormat() << "_" << std::hex << get_md_hash(*srcDesc.getDnnlDesc().get()) << "_"
+        << get_md_hash(*dstDesc.getDnnlDesc().get()) << "_" << size << "_" << dataHash << "_"
+        << ov::util::hash_data(data, size, dataSeed);
+    return key.str();
+}
+
+MemoryPtr SharedWeightsStore::findOrCreate(const dnnl::engine& eng,
+                                           const std::string& key,
+                                           int numaNodeId,
+                                           const MemoryDescPtr& desc,
+                                           const std::function<MemoryPtr()>& create) {
+    const auto nodeKey = key + "_" + std::to_string(numaNodeId);
+    std::shared_ptr<Entry> entry;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto& found = entries[nodeKey];
+        if (!found) {
+            found = std::make_shared<Entry>();
+            pruneExpiredEntries();
+        }
+        entry = found;
+    }
+
+    // the different weights are reordered simultaneously, the same ones are reordered once
+    std::lock_guard<std::mutex> lock(entry->guard);
+    if (auto memory = entry->memory.lock()) {
+        hits++;
+        return memory;
+    }
+
+    MemoryPtr memory;
+    std::string path;
+    if (!directory.empty()) {
+        std::ostringstream name;
+        name << std::hex << ov::util::hash_xxh64(nodeKey.data(), nodeKey.size()) << ".bin";
+        path = ov::util::path_join({directory, name.str()});
+        memory = mapFile(eng, nodeKey, path, desc);
+        if (memory)
+            mapped++;
+    }
+    if (!memory) {
+        memory = create();
+        packed++;
+        if (!path.empty()) {
+            publish(nodeKey, path, *memory);
+            // the own copy is replaced by the published one, so this process shares the pages too
+            if (auto published = mapFile(eng, nodeKey, path, desc))
+                memory = published;
+        }
+    }
+    entry->memory = memory;
+    return memory;
+}
+
+void SharedWeightsStore::pruneExpiredEntries() {
+    // the entry is not used by the other threads if the map holds the only reference, guard is locked by the caller
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->second.use_count() == 1 && it->second->memory.expired())
+            it = entries.erase(it);
+        else
+            ++it;
+    }
+}
+
+MemoryPtr SharedWeightsStore::mapFile(const dnnl::engine& eng,
+                                      const std::string& key,
+                                      const std::string& path,
+                                      const MemoryDescPtr& desc) const {
+#if defined(__linux__)
+    const auto dataSize = desc->getCurrentMemSize();
+    const auto header = fileHeader(key, dataSize);
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return nullptr;
+    // each process which maps the file holds the shared lock, so the last one is able to take the exclusive lock
+    // and remove the file; the file removed while waiting for the lock is not used
+    struct stat fileStat = {};
+    struct stat pathStat = {};
+    if (flock(fd, LOCK_SH) != 0 || fstat(fd, &fileStat) != 0 || stat(path.c_str(), &pathStat) != 0 ||
+        !isSameFile(fileStat, pathStat) || !isOwnFile(fileStat) ||
+        static_cast<size_t>(fileStat.st_size) != dataOffset + dataSize) {
+        close(fd);
+        return nullptr;
+    }
+    void* region = mmap(nullptr, dataOffset + dataSize, PROT_READ, MAP_SHARED, fd, 0);
+    if (region == MAP_FAILED) {
+        close(fd);
+        return nullptr;
+    }
+    std::shared_ptr<void> mapping(region, [dataSize, fd, path, fileStat](void* ptr) {
+        munmap(ptr, dataOffset + dataSize);
+        struct stat pathStat = {};
+        if (flock(fd, LOCK_EX | LOCK_NB) == 0 && stat(path.c_str(), &pathStat) == 0 && isSameFile(fileStat, pathStat))
+            unlink(path.c_str());
+        close(fd);
+    });
+    const auto data = static_cast<const uint8_t*>(region) + dataOffset;
+    const auto checksum = checksumLine(data, dataSize);
+    if (header.size() + checksum.size() > dataOffset || std::memcmp(region, header.data(), header.size()) != 0 ||
+        std::memcmp(static_cast<const uint8_t*>(region) + header.size(), checksum.data(), checksum.size()) != 0)
+        return nullptr;
+
+    // the memory object does not own the data, so the mapping lives in the same control block
+    struct MappedMemory {
+        std::shared_ptr<void> mapping;
+        Memory memory;
+        MappedMemory(std::shared_ptr<void> mapping, const dnnl::engine& eng, const MemoryDescPtr& desc)
+            : mapping(std::move(mapping)),
+              memory(eng,
+                     desc,
+                     static_cast<const uint8_t*>(this->mapping.get()) + dataOffset,
+                     false) {}
+    };
+    auto holder = std::make_shared<MappedMemory>(std::move(mapping), eng, desc);
+    return MemoryPtr(holder, &holder->memory);
+#else
+    (void)eng;
+    (void)key;
+    (void)path;
+    (void)desc;
+    return nullptr;
+#endif
+}
+
+void SharedWeightsStore::publish(const std::string& key, const std::string& path, const IMemory& memory) const {
+#if defined(__linux__)
+    const auto dataSize = memory.getSize();
+    const auto header = fileHeader(key, dataSize) + checksumLine(memory.getData(), dataSize);
+    if (header.size() > dataOffset)
+        return;
+
+    // the file is written under the unique name and renamed, so the other processes never map a partial file
+    std::ostringstream tmpPath;
+    tmpPath << path << "." << getpid() << ".tmp";
+    const int fd = open(tmpPath.str().c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+        return;
+    auto writeAll = [fd](const void* data, size_t size) {
+        auto ptr = static_cast<const char*>(data);
+        while (size > 0) {
+            const auto written = write(fd, ptr, size);
+            if (written <= 0)
+                return false;
+            ptr += written;
+            size -= static_cast<size_t>(written);
+        }
+        return true;
+    };
+    const std::string padding(dataOffset - header.size(), '\0');
+    const bool written = writeAll(header.data(), header.size()) && writeAll(padding.data(), padding.size()) &&
+                         writeAll(memory.getData(), dataSize);
+    if (close(fd) != 0 || !written || std::rename(tmpPath.str().c_str(), path.c_str()) != 0)
+        std::remove(tmpPath.str().c_str());
+#else
+    (void)key;
+    (void)path;
+    (void)memory;
+#endif
+}
+
+SharedWeightsStore::Statistics SharedWeightsStore::getStatistics() const {
+    Statistics result;
+    result.hits = hits;
+    result.packed = packed;
+    result.mapped = mapped;
+    return result;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
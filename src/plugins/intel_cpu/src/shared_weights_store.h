@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Storage of the reordered (packed) weights shared by all the compiled models of the process which enable it.
+ *
+ * Unlike WeightsSharing, which deduplicates the weights between the streams of one compiled model, the key is built
+ * from two independent weights content hashes and the source and target memory descriptors only, so the identical
+ * weights of different models (e.g. several variants of the same backbone) are reordered once per NUMA node.
+ *
+ * If the directory is set, the packed weights are also published as files (a tmpfs directory like /dev/shm is
+ * supposed) and mapped read-only by the other processes of the same user, so all the processes share the same
+ * physical pages. The directory is made private (0700) and is not used if it belongs to another user. The file keeps
+ * the full key, the OpenVINO build number and the data checksum, which are checked on load together with the file
+ * owner. The file is removed by the last process which releases it.
+ *
+ * The weights are kept while any graph uses them. Is thread safe.
+ */
+class SharedWeightsStore {
+public:
+    typedef std::shared_ptr<SharedWeightsStore> Ptr;
+
+    struct Statistics {
+        uint64_t hits = 0;    // the weights found in the process
+        uint64_t packed = 0;  // the weights reordered by the process
+        uint64_t mapped = 0;  // the weights mapped from the files published by the other processes
+    };
+
+    /**
+     * @brief Returns the store publishing the weights into the directory, the stores are shared within the process
+     * @param dir the directory for the cross-process sharing or empty string to share the weights within the process
+     */
+    static Ptr get(const std::string& dir);
+
+    /**
+     * @brief Creates the key of the weights
+     * @param srcDesc the descriptor of the weights
+     * @param dstDesc the descriptor of the packed weights
+     * @param data the weights, they are hashed by the hash independent of dataHash
+     * @param dataHash the hash identifying the weights content, e.g. the hash cached in the weights constant
+     */
+    static std::string makeKey(const DnnlMemoryDesc& srcDesc,
+                               const DnnlMemoryDesc& dstDesc,
+                               const void* data,
+                               uint64_t dataHash);
+
+    /**
+     * @brief Looks for the packed weights and calls create() on a miss
+     * @param eng the engine of the consumer
+     * @param key the weights key created by makeKey()
+     * @param numaNodeId the NUMA node of the consumer, the weights are packed once per node
+     * @param desc the descriptor of the packed weights
+     * @param create reorders the weights
+     */
+    MemoryPtr findOrCreate(const dnnl::engine& eng,
+                           const std::string& key,
+                           int numaNodeId,
+                           const MemoryDescPtr& desc,
+                           const std::function<MemoryPtr()>& create);
+
+    Statistics getStatistics() const;
+
+    explicit SharedWeightsStore(std::string dir);
+
+private:
+    struct Entry {
+        std::mutex guard;
+        std::weak_ptr<IMemory> memory;
+    };
+
+    void pruneExpiredEntries();
+    MemoryPtr mapFile(const dnnl::engine& eng,
+                      const std::string& key,
+                      const std::string& path,
+                      const MemoryDescPtr& desc) const;
+    void publish(const std::string& key, const std::string& path, const IMemory& memory) const;
+
+    std::string directory;
+    mutable std::mutex guard;
+    std::map<std::string, std::shared_ptr<Entry>> entries;
+
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> packed{0};
+    std::atomic<uint64_t> mapped{0};
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,119 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "telemetry.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+size_t mostSignificantBit(uint64_t value) {
+    size_t msb = 0;
+    while (value >>= 1)
+        msb++;
+    return msb;
+}
+}  // namespace
+
+size_t LatencyHistogram::bucketIndex(uint64_t value) {
+    if (value < subBuckets)
+        return static_cast<size_t>(value);
+    const size_t msb = mostSignificantBit(value);
+    const size_t index = (msb - subBucketsBits + 1) * subBuckets + ((value >> (msb - subBucketsBits)) & (subBuckets - 1));
+    return std::min(index, bucketsCount - 1);
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(size_t index) {
+    if (index < subBuckets)
+        return index;
+    const size_t shift = index / subBuckets - 1;
+    const uint64_t sub = index % subBuckets;
+    return ((subBuckets + sub + 1) << shift) - 1;
+}
+
+uint64_t LatencyHistogram::count() const {
+    uint64_t total = 0;
+    for (const auto& bucket : m_buckets)
+        total += bucket.load(std::memory_order_relaxed);
+    return total;
+}
+
+uint64_t LatencyHistogram::percentile(double p) const {
+    std::array<uint64_t, bucketsCount> snapshot;
+    uint64_t total = 0;
+    for (size_t i = 0; i < bucketsCount; i++) {
+        snapshot[i] = m_buckets[i].load(std::memory_order_relaxed);
+        total += snapshot[i];
+    }
+    if (total == 0)
+        return 0;
+
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(total))));
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < bucketsCount; i++) {
+        accumulated += snapshot[i];
+        if (accumulated >= rank)
+            return bucketUpperBound(i);
+    }
+    return bucketUpperBound(bucketsCount - 1);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < bucketsCount; i++)
+        m_buckets[i].fetch_add(other.m_buckets[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+GraphTelemetry::GraphTelemetry(size_t samplingRate, const std::vector<std::string>& nodeNames)
+    : m_samplingRate(std::max<size_t>(samplingRate, 1)), m_nodeNames(nodeNames) {
+    m_nodeLatencies.reserve(m_nodeNames.size());
+    for (size_t i = 0; i < m_nodeNames.size(); i++)
+        m_nodeLatencies.emplace_back(new LatencyHistogram());
+}
+
+void GraphTelemetry::Report::accumulate(GraphTelemetry& telemetry) {
+    inferences += telemetry.m_inferences.load(std::memory_order_relaxed);
+    sampledInferences += telemetry.m_requestLatency.count();
+    updateShapesTime += telemetry.updateShapesTime.load(std::memory_order_relaxed);
+    prepareParamsTime += telemetry.prepareParamsTime.load(std::memory_order_relaxed);
+    executeTime += telemetry.executeTime.load(std::memory_order_relaxed);
+    reorderExecutions += telemetry.reorderExecutions.load(std::memory_order_relaxed);
+    requestLatency.merge(telemetry.m_requestLatency);
+
+    for (size_t i = 0; i < telemetry.m_nodeNames.size(); i++) {
+        auto& histogram = nodeLatencies[telemetry.m_nodeNames[i]];
+        if (!histogram)
+            histogram.reset(new LatencyHistogram());
+        histogram->merge(*telemetry.m_nodeLatencies[i]);
+    }
+}
+
+std::map<std::string, uint64_t> GraphTelemetry::Report::toMap() const {
+    std::map<std::string, uint64_t> result = {
+        {"inferences", inferences},
+        {"sampled_inferences", sampledInferences},
+        {"request_p50_ns", requestLatency.percentile(50)},
+        {"request_p99_ns", requestLatency.percentile(99)},
+        {"update_shapes_ns", updateShapesTime},
+        {"prepare_params_ns", prepareParamsTime},
+        {"execute_ns", executeTime},
+        {"reorder_executions", reorderExecutions},
+    };
+
+    // the nodes which are not executed (e.g. constants) are not reported
+    for (const auto& node : nodeLatencies) {
+        const auto count = node.second->count();
+        if (count == 0)
+            continue;
+        result["node." + node.first + ".count"] = count;
+        result["node." + node.first + ".p50_ns"] = node.second->percentile(50);
+        result["node." + node.first + ".p99_ns"] = node.second->percentile(99);
+    }
+    return result;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,143 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Lock free latency histogram with the log-linear buckets: every power of two range is split into 4 buckets,
+ * so the percentiles are estimated with the relative error below 25%. The values are in nanoseconds.
+ */
+class LatencyHistogram {
+public:
+    static constexpr size_t subBucketsBits = 2;
+    static constexpr size_t subBuckets = 1 << subBucketsBits;
+    // covers the values up to 2^48 ns (~3 days), the bigger ones go to the last bucket
+    static constexpr size_t bucketsCount = 48 * subBuckets;
+
+    void add(uint64_t value) {
+        m_buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64_t count() const;
+
+    /**
+     * @brief Estimates the percentile of the recorded values
+     * @param p percentile in the range [0, 100]
+     * @return upper bound of the bucket the percentile falls into, 0 if there are no values
+     */
+    uint64_t percentile(double p) const;
+
+    void merge(const LatencyHistogram& other);
+
+    static size_t bucketIndex(uint64_t value);
+    static uint64_t bucketUpperBound(size_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, bucketsCount> m_buckets{};
+};
+
+/**
+ * Low overhead telemetry of a graph collected on the sampled inferences (every N-th one): the request and per node
+ * latency histograms, the time spent in the shape inference, the dynamic parameters preparation and the execution,
+ * and the number of the executed reorders. The sampling keeps the overhead of the unsampled inferences to one counter
+ * increment, so the telemetry can stay enabled under load.
+ *
+ * The counters are atomic, so the telemetry may be updated by the parallel node execution and read by another thread.
+ */
+class GraphTelemetry {
+public:
+    using Ptr = std::shared_ptr<GraphTelemetry>;
+    using Clock = std::chrono::steady_clock;
+
+    GraphTelemetry(size_t samplingRate, const std::vector<std::string>& nodeNames);
+
+    /**
+     * @brief Counts the inference and decides whether it is sampled
+     */
+    bool sample() {
+        return m_inferences.fetch_add(1, std::memory_order_relaxed) % m_samplingRate == 0;
+    }
+
+    LatencyHistogram& requestLatency() {
+        return m_requestLatency;
+    }
+
+    LatencyHistogram* nodeLatency(size_t execIndex) {
+        return execIndex < m_nodeLatencies.size() ? m_nodeLatencies[execIndex].get() : nullptr;
+    }
+
+    std::atomic<uint64_t> updateShapesTime{0};
+    std::atomic<uint64_t> prepareParamsTime{0};
+    std::atomic<uint64_t> executeTime{0};
+    std::atomic<uint64_t> reorderExecutions{0};
+
+    /**
+     * @brief Accumulates the telemetry of one graph into the common report, so the streams of a compiled model
+     * are reported together
+     */
+    class Report {
+    public:
+        void accumulate(GraphTelemetry& telemetry);
+        std::map<std::string, uint64_t> toMap() const;
+
+    private:
+        uint64_t inferences = 0;
+        uint64_t sampledInferences = 0;
+        uint64_t updateShapesTime = 0;
+        uint64_t prepareParamsTime = 0;
+        uint64_t executeTime = 0;
+        uint64_t reorderExecutions = 0;
+        LatencyHistogram requestLatency;
+        std::map<std::string, std::unique_ptr<LatencyHistogram>> nodeLatencies;
+    };
+
+private:
+    const size_t m_samplingRate;
+    std::atomic<uint64_t> m_inferences{0};
+    LatencyHistogram m_requestLatency;
+    std::vector<std::string> m_nodeNames;
+    std::vector<std::unique_ptr<LatencyHistogram>> m_nodeLatencies;
+};
+
+/**
+ * Adds the time spent in the scope to the histogram and/or the total, does nothing if both are null.
+ */
+class TelemetryScope {
+public:
+    TelemetryScope(LatencyHistogram* histogram, std::atomic<uint64_t>* total) : m_histogram(histogram), m_total(total) {
+        if (m_histogram || m_total)
+            m_start = GraphTelemetry::Clock::now();
+    }
+
+    ~TelemetryScope() {
+        if (!m_histogram && !m_total)
+            return;
+        const auto duration = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(GraphTelemetry::Clock::now() - m_start).count());
+        if (m_histogram)
+            m_histogram->add(duration);
+        if (m_total)
+            m_total->fetch_add(duration, std::memory_order_relaxed);
+    }
+
+private:
+    LatencyHistogram* m_histogram;
+    std::atomic<uint64_t>* m_total;
+    GraphTelemetry::Clock::time_point m_start;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
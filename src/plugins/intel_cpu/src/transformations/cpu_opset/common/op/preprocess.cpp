@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "preprocess.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::PreprocessNode::PreprocessNode(const ov::OutputVector& planes, const Config& config)
+    : Op(planes), m_config(config) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::PreprocessNode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(PreprocessNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::PreprocessNode>(new_args, m_config);
+}
+
+bool ov::intel_cpu::PreprocessNode::visit_attributes(ov::AttributeVisitor &visitor) {
+    INTERNAL_OP_SCOPE(PreprocessNode_visit_attributes);
+    visitor.on_attribute("i420", m_config.i420);
+    visitor.on_attribute("bgr", m_config.bgr);
+    visitor.on_attribute("resize", m_config.resize);
+    visitor.on_attribute("height", m_config.height);
+    visitor.on_attribute("width", m_config.width);
+    visitor.on_attribute("scale", m_config.scale);
+    visitor.on_attribute("shift", m_config.shift);
+    visitor.on_attribute("planar", m_config.planar);
+    return true;
+}
+
+void ov::intel_cpu::PreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(PreprocessNode_validate_and_infer_types);
+    const auto planes = get_input_size();
+    NGRAPH_CHECK(planes == 1 || planes == (m_config.i420 ? 3 : 2), "Incorrect number of image planes: ", planes);
+    NGRAPH_CHECK(m_config.scale.size() == 3 && m_config.shift.size() == 3, "scale and shift must contain 3 values");
+    NGRAPH_CHECK(!m_config.resize || (m_config.height > 0 && m_config.width > 0), "Incorrect target size of the resize");
+
+    const auto& et = get_input_element_type(0);
+    NGRAPH_CHECK(et == ov::element::u8 || et == ov::element::f32, "Image planes must be u8 or f32 whereas current element type is ", et);
+
+    const auto& y_shape = get_input_partial_shape(0);
+    NGRAPH_CHECK(y_shape.rank().compatible(4), "Image planes must have 4D shape whereas current shape is ", y_shape);
+
+    ov::PartialShape out_shape = ov::PartialShape::dynamic(4);
+    if (y_shape.rank().is_static()) {
+        out_shape[0] = y_shape[0];
+        if (m_config.resize) {
+            out_shape[1] = m_config.height;
+            out_shape[2] = m_config.width;
+        } else {
+            if (planes != 1)
+                out_shape[1] = y_shape[1];
+            else if (y_shape[1].is_static())
+                out_shape[1] = y_shape[1].get_length() * 2 / 3;
+            out_shape[2] = y_shape[2];
+        }
+    }
+    out_shape[3] = 3;
+
+    if (m_config.planar)
+        out_shape = ov::PartialShape{out_shape[0], out_shape[3], out_shape[1], out_shape[2]};
+
+    set_output_type(0, ov::element::f32, out_shape);
+}
+
+const ov::intel_cpu::PreprocessNode::Config& ov::intel_cpu::PreprocessNode::get_config() const {
+    return m_config;
+}
@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/core/node.hpp>
+#include <openvino/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+/**
+ * The operation performs the preprocessing of a YUV image in a single pass: color conversion, bilinear resize,
+ * per channel normalization and layout conversion. It replaces the chain of operations which
+ * ov::preprocess::PrePostProcessor builds for such inputs (see PreprocessFusion).
+ * Inputs:
+ *     1. NV12 or I420 image planes of type T in the same form as for NV12toRGB/I420toRGB operations:
+ *        a single plane [N, H * 3 / 2, W, 1], or separate planes: Y [N, H, W, 1] and UV [N, H / 2, W / 2, 2] for NV12,
+ *        Y [N, H, W, 1], U [N, H / 2, W / 2, 1] and V [N, H / 2, W / 2, 1] for I420. Required
+ * Outputs:
+ *     1. RGB or BGR image of type f32: [N, H', W', 3] or [N, 3, H', W'] for the planar layout, where H', W' are
+ *        the target size of the resize or H, W if there is no resize.
+ *        Every channel value is computed as: resize(color_convert(x)) * scale[c] + shift[c]
+ * Types:
+ *     T - U8 and FP32 are supported. U8 color conversion results are rounded as in NV12toRGB/I420toRGB operations.
+ */
+class PreprocessNode : public ov::op::Op {
+public:
+    OPENVINO_OP("Preprocess", "cpu_plugin_opset");
+
+    struct Config {
+        bool i420 = false;              // I420 color format of the source image, NV12 otherwise
+        bool bgr = false;               // BGR color format of the result, RGB otherwise
+        bool resize = false;            // bilinear resize with the half pixel coordinate transformation
+        int64_t height = 0;             // target height of the resize
+        int64_t width = 0;              // target width of the resize
+        std::vector<float> scale = {1.f, 1.f, 1.f};
+        std::vector<float> shift = {0.f, 0.f, 0.f};
+        bool planar = false;            // NCHW layout of the result, NHWC otherwise
+    };
+
+    PreprocessNode() = default;
+    PreprocessNode(const ov::OutputVector& planes, const Config& config);
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+    void validate_and_infer_types() override;
+    const Config& get_config() const;
+
+private:
+    Config m_config;
+};
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_low_bit_weights_decompression.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+#include "itt.hpp"
+
+namespace {
+const char* const lowBitWeightsKey = "lowBitWeightsDecompression";
+}   // namespace
+
+ov::intel_cpu::MarkLowBitWeightsDecompression::MarkLowBitWeightsDecompression() {
+    MATCHER_SCOPE(MarkLowBitWeightsDecompression);
+    auto weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>([](const ov::Output<ov::Node>& output) {
+        const auto& type = output.get_element_type();
+        return type == ov::element::u4 || type == ov::element::i4;
+    });
+    auto convert = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({weights});
+
+    ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
+        m.get_match_root()->get_rt_info()[lowBitWeightsKey] = true;
+        return false;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(convert, matcher_name);
+    this->register_matcher(m, callback);
+}
+
+bool ov::intel_cpu::MarkLowBitWeightsDecompression::isMarked(const std::shared_ptr<const ov::Node>& node) {
+    const auto& rtInfo = node->get_rt_info();
+    const auto it = rtInfo.find(lowBitWeightsKey);
+    return it != rtInfo.end() && it->second.as<bool>();
+}
@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     u4/i4 weights are unpacked to u8/i8 by ConvertPrecision, so the Convert operations decompressing them
+ *     are marked beforehand to let FullyConnected keep such weights packed into 4 bits.
+ */
+class MarkLowBitWeightsDecompression: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MarkLowBitWeightsDecompression", "0");
+    MarkLowBitWeightsDecompression();
+
+    static bool isMarked(const std::shared_ptr<const ov::Node>& node);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -15,6 +15,8 @@
 #include <openvino/op/transpose.hpp>
 #include <openvino/op/reshape.hpp>
 
+#include <algorithm>
+
 #include "itt.hpp"
 
 ov::intel_cpu::MoveFCReshapeToWeights::MoveFCReshapeToWeights() {
@@ -57,37 +59,46 @@ ov::intel_cpu::MoveFCReshapeToWeights::MoveFCReshapeToWeights() {
 
         const auto& fc_input_shape = fully_connected->get_input_shape(1);
         const auto reshape = with_transpose ? weights_path->get_input_node_shared_ptr(0) : weights_path;
+        const auto mul = reshape->get_input_node_shared_ptr(0);
+        const auto mul_parent = mul->get_input_node_shared_ptr(0);
+        const bool with_subtract = ov::is_type<ov::op::v1::Subtract>(mul_parent);
+        const auto convert = with_subtract ? mul_parent->get_input_node_shared_ptr(0) : mul_parent;
+        const auto weights = convert->get_input_node_shared_ptr(0);
+
+        // The unit dimension of the 3D weights is either the leading one ([1, OC, IC])
+        // or the group one in case of group-wise compression with a single group ([OC, 1, IC])
+        const auto& weights_shape = weights->get_output_shape(0);
+        const ov::Shape weights_2d_shape = with_transpose ? ov::Shape{fc_input_shape[1], fc_input_shape[0]} : fc_input_shape;
+        auto squeezed_shape = [](ov::Shape shape, size_t axis) {
+            shape.erase(shape.begin() + axis);
+            return shape;
+        };
+        const std::vector<size_t> candidate_axes = with_transpose ? std::vector<size_t>{0} : std::vector<size_t>{0, 1};
+        const auto axis_it = std::find_if(candidate_axes.begin(), candidate_axes.end(), [&](size_t axis) {
+            return weights_shape[axis] == 1 && squeezed_shape(weights_shape, axis) == weights_2d_shape;
+        });
+        if (axis_it == candidate_axes.end())
+            return false;
+        const size_t squeeze_axis = *axis_it;
 
         auto check_decompression_const = [&](const std::shared_ptr<ov::Node>& node) {
             if (!ov::is_type<ov::op::v0::Constant>(node))
                 return false;
-            ov::Shape expected_shape(3, 1);
-            const size_t out_channels_idx = with_transpose ? 2 : 1;
-            expected_shape[out_channels_idx] = fc_input_shape[0];
+            // Decompression constants are broadcasted along the input channels
+            const size_t in_channels_idx = with_transpose ? 0 : 1;
+            ov::Shape expected_shape = weights_shape;
+            expected_shape[in_channels_idx >= squeeze_axis ? in_channels_idx + 1 : in_channels_idx] = 1;
             return node->get_output_shape(0) == expected_shape;
         };
 
-        const auto mul = reshape->get_input_node_shared_ptr(0);
         if (!check_decompression_const(mul->get_input_node_shared_ptr(1)))
             return false;
-        const auto mul_parent = mul->get_input_node_shared_ptr(0);
-        const bool with_subtract = ov::is_type<ov::op::v1::Subtract>(mul_parent);
         if (with_subtract && !check_decompression_const(mul_parent->get_input_node_shared_ptr(1)))
             return false;
 
-        const auto convert = with_subtract ? mul_parent->get_input_node_shared_ptr(0) : mul_parent;
-        const auto weights = convert->get_input_node_shared_ptr(0);
-        ov::Shape expected_weights_shape(3, 1);
-        expected_weights_shape[1] = fc_input_shape[with_transpose ? 1 : 0];
-        expected_weights_shape[2] = fc_input_shape[with_transpose ? 0 : 1];
-        if (weights->get_output_shape(0) != expected_weights_shape)
-            return false;
-
-        auto squeeze_constant = [](const std::shared_ptr<ov::Node>& node) {
+        auto squeeze_constant = [&](const std::shared_ptr<ov::Node>& node) {
             const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node);
-            auto shape = constant->get_shape();
-            shape.erase(shape.begin());
-            const auto new_constant = std::make_shared<ov::op::v0::Constant>(*constant, shape);
+            const auto new_constant = std::make_shared<ov::op::v0::Constant>(*constant, squeezed_shape(constant->get_shape(), squeeze_axis));
             ov::replace_node(constant, new_constant);
             ov::copy_runtime_info(constant, new_constant);
             new_constant->set_friendly_name(constant->get_friendly_name());
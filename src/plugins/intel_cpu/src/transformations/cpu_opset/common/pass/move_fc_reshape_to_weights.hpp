@@ -10,8 +10,9 @@ namespace ov {
 namespace intel_cpu {
 
 /**
- * This transformation is applied to the FC with compressed 3D u8 weights. It moves Reshape at the weights path to the constants
- * in order to constant fold the Reshape node.
+ * This transformation is applied to the FC with compressed 3D u8 (or unpacked u4/i4) weights. It moves Reshape at the weights path
+ * to the constants in order to constant fold the Reshape node. The unit dimension of the weights can be either the leading one
+ * or the group one ([OC, 1, IC] weights with [OC, 1, 1] decompression constants produced by group-wise compression with a single group).
  * Example:
  *                    Weights(3D)                                            Weights(2D)
  *                       |                                                      |
@@ -0,0 +1,200 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "preprocess_fusion.hpp"
+#include "transformations/cpu_opset/common/op/preprocess.hpp"
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/opsets/opset11.hpp>
+#include <openvino/core/rt_info.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+
+#include "transformations/itt.hpp"
+
+namespace {
+
+struct ChainState {
+    bool is_f32 = false;
+    size_t h_axis = 1;
+    size_t w_axis = 2;
+    size_t c_axis = 3;
+    ov::intel_cpu::PreprocessNode::Config config;
+};
+
+// Returns per channel values of the eltwise constant or an empty vector if the constant is not a scalar
+// nor a per channel one for the current layout of the chain
+std::vector<float> get_channel_values(const std::shared_ptr<ov::Node>& node, const ChainState& state) {
+    const auto constant = ov::as_type_ptr<ov::opset1::Constant>(node);
+    if (!constant || constant->get_output_element_type(0) != ov::element::f32)
+        return {};
+
+    const auto& shape = constant->get_output_shape(0);
+    if (shape.size() > 4)
+        return {};
+    const size_t offset = 4 - shape.size();
+    for (size_t i = 0; i < shape.size(); i++) {
+        if (shape[i] != 1 && (i + offset != state.c_axis || shape[i] != 3))
+            return {};
+    }
+
+    const auto values = constant->cast_vector<float>();
+    if (values.size() == 1)
+        return std::vector<float>(3, values[0]);
+    return values;
+}
+
+bool fuse_interpolate(const std::shared_ptr<ov::Node>& node, ChainState& state) {
+    const auto interpolate = ov::as_type_ptr<ov::opset11::Interpolate>(node);
+    if (!interpolate || !state.is_f32 || state.config.resize || interpolate->get_input_size() != 3)
+        return false;
+
+    using Base = ov::op::util::InterpolateBase;
+    const auto& attrs = interpolate->get_attrs();
+    auto is_zero = [](size_t v) { return v == 0; };
+    if (attrs.mode != Base::InterpolateMode::LINEAR ||
+        attrs.shape_calculation_mode != Base::ShapeCalcMode::SIZES ||
+        attrs.coordinate_transformation_mode != Base::CoordinateTransformMode::HALF_PIXEL ||
+        attrs.antialias ||
+        !std::all_of(attrs.pads_begin.begin(), attrs.pads_begin.end(), is_zero) ||
+        !std::all_of(attrs.pads_end.begin(), attrs.pads_end.end(), is_zero))
+        return false;
+
+    const auto sizes = ov::as_type_ptr<ov::opset1::Constant>(interpolate->get_input_node_shared_ptr(1));
+    const auto axes = ov::as_type_ptr<ov::opset1::Constant>(interpolate->get_input_node_shared_ptr(2));
+    if (!sizes || !axes)
+        return false;
+
+    const auto sizes_values = sizes->cast_vector<int64_t>();
+    const auto axes_values = axes->cast_vector<int64_t>();
+    if (sizes_values.size() != 2 || axes_values.size() != 2)
+        return false;
+
+    int64_t height = 0, width = 0;
+    for (size_t i = 0; i < 2; i++) {
+        const auto axis = axes_values[i] < 0 ? axes_values[i] + 4 : axes_values[i];
+        if (axis == static_cast<int64_t>(state.h_axis))
+            height = sizes_values[i];
+        else if (axis == static_cast<int64_t>(state.w_axis))
+            width = sizes_values[i];
+    }
+    if (height <= 0 || width <= 0)
+        return false;
+
+    state.config.resize = true;
+    state.config.height = height;
+    state.config.width = width;
+    return true;
+}
+
+bool fuse_eltwise(const std::shared_ptr<ov::Node>& node, const ov::Output<ov::Node>& data, ChainState& state) {
+    const bool is_add = ov::is_type<ov::opset1::Add>(node);
+    const bool is_sub = ov::is_type<ov::opset1::Subtract>(node);
+    const bool is_mul = ov::is_type<ov::opset1::Multiply>(node);
+    const bool is_div = ov::is_type<ov::opset1::Divide>(node);
+    if (!(is_add || is_sub || is_mul || is_div) || !state.is_f32)
+        return false;
+
+    const auto& broadcast = ov::as_type_ptr<ov::op::util::BinaryElementwiseArithmetic>(node)->get_autob();
+    if (broadcast.m_type != ov::op::AutoBroadcastType::NUMPY)
+        return false;
+
+    size_t data_port = 0;
+    if (node->input_value(0) != data) {
+        // the data must be the minuend or the dividend
+        if (is_sub || is_div)
+            return false;
+        data_port = 1;
+    }
+
+    const auto values = get_channel_values(node->get_input_node_shared_ptr(1 - data_port), state);
+    if (values.size() != 3)
+        return false;
+    if (is_div && std::any_of(values.begin(), values.end(), [](float v) { return v == 0.f; }))
+        return false;
+
+    auto& scale = state.config.scale;
+    auto& shift = state.config.shift;
+    for (size_t c = 0; c < 3; c++) {
+        if (is_add) {
+            shift[c] += values[c];
+        } else if (is_sub) {
+            shift[c] -= values[c];
+        } else if (is_mul) {
+            scale[c] *= values[c];
+            shift[c] *= values[c];
+        } else {
+            scale[c] /= values[c];
+            shift[c] /= values[c];
+        }
+    }
+    return true;
+}
+
+bool fuse_transpose(const std::shared_ptr<ov::Node>& node, ChainState& state) {
+    if (!ov::is_type<ov::opset1::Transpose>(node) || state.config.planar)
+        return false;
+
+    const auto order = ov::as_type_ptr<ov::opset1::Constant>(node->get_input_node_shared_ptr(1));
+    if (!order || order->cast_vector<int64_t>() != std::vector<int64_t>{0, 3, 1, 2})
+        return false;
+
+    state.config.planar = true;
+    state.h_axis = 2;
+    state.w_axis = 3;
+    state.c_axis = 1;
+    return true;
+}
+
+}   // namespace
+
+ov::intel_cpu::PreprocessFusion::PreprocessFusion() {
+    MATCHER_SCOPE(PreprocessFusion);
+    auto color_convert_m = ov::pass::pattern::wrap_type<ov::opset8::NV12toRGB, ov::opset8::NV12toBGR,
+                                                        ov::opset8::I420toRGB, ov::opset8::I420toBGR>();
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        const auto color_convert = m.get_match_root();
+        const auto& input_type = color_convert->get_input_element_type(0);
+        if (input_type != ov::element::u8 && input_type != ov::element::f32)
+            return false;
+
+        ChainState state;
+        state.is_f32 = input_type == ov::element::f32;
+        state.config.i420 = ov::is_type<ov::opset8::I420toRGB>(color_convert) || ov::is_type<ov::opset8::I420toBGR>(color_convert);
+        state.config.bgr = ov::is_type<ov::opset8::NV12toBGR>(color_convert) || ov::is_type<ov::opset8::I420toBGR>(color_convert);
+
+        ov::NodeVector fused{color_convert};
+        ov::Output<ov::Node> current = color_convert->output(0);
+        while (current.get_target_inputs().size() == 1) {
+            const auto next = current.get_target_inputs().begin()->get_node()->shared_from_this();
+            bool is_fused = false;
+            if (const auto convert = ov::as_type_ptr<ov::opset1::Convert>(next)) {
+                is_fused = !state.is_f32 && convert->get_destination_type() == ov::element::f32;
+                state.is_f32 = state.is_f32 || is_fused;
+            } else if (next->input_value(0) == current) {
+                is_fused = fuse_interpolate(next, state) || fuse_transpose(next, state) || fuse_eltwise(next, current, state);
+            } else {
+                is_fused = fuse_eltwise(next, current, state);
+            }
+            if (!is_fused)
+                break;
+            fused.push_back(next);
+            current = next->output(0);
+        }
+
+        // without the resize the JIT ColorConvert node and the eltwise nodes are faster than the fused loop
+        if (!state.config.resize || !state.is_f32)
+            return false;
+
+        const auto last = fused.back();
+        const auto preprocess = std::make_shared<ov::intel_cpu::PreprocessNode>(color_convert->input_values(), state.config);
+        preprocess->set_friendly_name(last->get_friendly_name());
+        ov::copy_runtime_info(fused, preprocess);
+        ov::replace_node(last, preprocess);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(color_convert_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * PreprocessFusion replaces the preprocessing chain of a YUV model input, as it is built by
+ * ov::preprocess::PrePostProcessor, with a single PreprocessNode:
+ *
+ *     Parameter(s)
+ *      |
+ * NV12toRGB/NV12toBGR/I420toRGB/I420toBGR
+ *      |
+ * any sequence of:
+ *     Convert (u8 -> f32)
+ *     Interpolate-11 (linear, half pixel, sizes of H and W)
+ *     Add/Subtract/Multiply/Divide by a scalar or per channel constant
+ *     Transpose (NHWC -> NCHW)
+ *
+ * Since bilinear weights sum to one, the per channel affine transformations commute with the resize and are
+ * collapsed into a single scale and shift. The chain is fused only if it is computed in f32 after the color
+ * conversion, so the only element type conversion is the Convert right after the u8 color conversion, and only if it
+ * contains the resize: otherwise the JIT ColorConvert and eltwise nodes are faster.
+ */
+class PreprocessFusion: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("PreprocessFusion", "0");
+    PreprocessFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
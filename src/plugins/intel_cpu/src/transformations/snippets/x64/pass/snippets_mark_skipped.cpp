@@ -4,6 +4,8 @@
 #include "snippets_mark_skipped.hpp"
 
 #include "snippets/pass/tokenization.hpp"
+#include "snippets/pass/collapse_subgraph.hpp"
+#include "snippets/pass/common_optimizations.hpp"
 #include "snippets/op/subgraph.hpp"
 #include "snippets/utils.hpp"
 
@@ -13,6 +15,8 @@
 
 #include "itt.hpp"
 
+#include <numeric>
+
 
 namespace ov {
 namespace intel_cpu {
@@ -463,6 +467,25 @@ auto is_skipped_op(const std::shared_ptr<ov::Node>& op) -> bool {
 }
 } // namespace
 
+bool isUnsupportedParallelWorkAmount(const std::shared_ptr<const ov::Node>& node, const ov::Shape& shape, size_t concurrency) {
+    const auto parallel_work_amount = std::accumulate(shape.rbegin() + 2, shape.rend(), size_t(1), std::multiplies<size_t>());
+    // Heuristic values:
+    //    parallelism work amount - not enough work amount for parallelism
+    // TODO: The heuristic will be removed after parallelism support on JIT level
+    const auto needed_num_of_threads = 12lu;
+    return concurrency / 2 > parallel_work_amount &&
+           parallel_work_amount < needed_num_of_threads &&
+           !snippets::pass::CommonOptimizations::CanOptimizeParallelWA(node, concurrency);
+}
+
+bool isSuitableSnippetsReduce(const std::shared_ptr<const ov::Node>& node, size_t concurrency) {
+    if (!ov::is_type<ov::op::util::ArithmeticReductionKeepDims>(node) ||
+        !snippets::pass::TokenizeSnippets::AppropriateForSubgraph(node))
+        return false;
+    const auto& shape = node->get_input_shape(0);
+    return shape.size() >= 2 && !isUnsupportedParallelWorkAmount(node, shape, concurrency);
+}
+
 bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
     RUN_ON_MODEL_SCOPE(SnippetsMarkSkipped);
     int channelAxis = DEFAULT_AXIS;
@@ -485,6 +508,9 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
         } else if (isSuitableBinaryConvolutionParent(node)) {
             SetNodeFusingType(node, NodeFusingType::FusedWithBinaryConvolution);
             channelAxis = DEFAULT_AXIS;
+        } else if (isSuitableSnippetsReduce(node, concurrency)) {
+            // The fusing chain isn't started since Reduce will be in Subgraph
+            channelAxis = DEFAULT_AXIS;
         } else if (isSuitableReduceParent(node)) {
             const auto reduce = std::dynamic_pointer_cast<const ov::op::util::ArithmeticReductionKeepDims>(node);
             channelAxis = getChannelAxis(reduce->get_reduction_axes(), reduce->get_keep_dims());
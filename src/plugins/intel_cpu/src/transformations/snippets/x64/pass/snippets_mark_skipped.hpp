@@ -17,12 +17,25 @@ namespace intel_cpu {
 class SnippetsMarkSkipped : public ov::pass::ModelPass {
 public:
     OPENVINO_RTTI("SnippetsMarkSkipped", "0");
-    SnippetsMarkSkipped(bool enableBF16 = false) : ModelPass(), enableBF16(enableBF16) {}
+    SnippetsMarkSkipped(bool enableBF16 = false, size_t concurrency = 0) : ModelPass(), enableBF16(enableBF16), concurrency(concurrency) {}
     bool run_on_model(const std::shared_ptr<ov::Model> &) override;
 private:
     bool enableBF16 = false;
+    size_t concurrency = 0;
 };
 
+/**
+ * @brief Returns true if there is not enough parallel work for Subgraph which is parallelized only by the outer dimensions
+ *        of the shape (all except the last two). Used for the tokenization of MHA and Reduce.
+ */
+bool isUnsupportedParallelWorkAmount(const std::shared_ptr<const ov::Node>& node, const ov::Shape& shape, size_t concurrency);
+
+/**
+ * @brief Returns true if Reduce is tokenized into Subgraph together with its consumers (e.g. LayerNorm pattern)
+ *        instead of being fused into Reduce node. Shared by SnippetsMarkSkipped and the tokenization callback.
+ */
+bool isSuitableSnippetsReduce(const std::shared_ptr<const ov::Node>& node, size_t concurrency);
+
 /*
 NotSet - not part of a fusing chain
 FusedTerminator - the node is fused, but the chain can't be continued
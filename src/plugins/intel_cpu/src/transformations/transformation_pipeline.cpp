@@ -107,12 +107,13 @@
 #include "transformations/cpu_opset/common/pass/insert_convert_after_extension.hpp"
 #include "transformations/cpu_opset/common/pass/move_eltwise_up_data_movement.hpp"
 #include "transformations/cpu_opset/common/pass/swap_convert_transpose.hpp"
+#include "transformations/cpu_opset/common/pass/preprocess_fusion.hpp"
+#include "transformations/cpu_opset/common/pass/mark_low_bit_weights_decompression.hpp"
 
 // Snippets
 #include "snippets/pass/tokenization.hpp"
 #include "snippets/pass/mha_tokenization.hpp"
 #include "snippets/pass/collapse_subgraph.hpp"
-#include "snippets/pass/common_optimizations.hpp"
 #include "snippets/pass/extract_reshapes_from_mha.hpp"
 
 // Misc
@@ -209,8 +210,9 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
         CPU_REGISTER_PASS_COMMON(manager, ov::pass::MarkDequantizationSubgraph, defaultPrecisions);
     } else {
         // MarkDequantizationSubgraph is used even in non-LPT pipeline on X64 platforms
-        // in order to keep compressed u8 MatMul weights with decompression operations as is
-        CPU_REGISTER_PASS_X64(manager, ov::pass::MarkDequantizationSubgraph, ov::element::TypeVector{ov::element::u8}, true);
+        // in order to keep compressed u8/u4/i4 MatMul weights with decompression operations as is
+        CPU_REGISTER_PASS_X64(manager, ov::pass::MarkDequantizationSubgraph,
+                              ov::element::TypeVector{ov::element::u8, ov::element::u4, ov::element::i4}, true);
         CPU_SET_CALLBACK_X64(manager, [](const_node_ptr &node) -> bool {
             auto get_single_consumer = [](const_node_ptr &node) -> std::shared_ptr<ov::Node> {
                 const auto consumers = node->get_output_target_inputs(0);
@@ -223,6 +225,13 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
             if (!consumer)
                 return true;
 
+            // group-wise compressed weights are reshaped from [OC, G, IC / G] to [OC, IC] after the decompression
+            if (ov::is_type<ov::opset1::Reshape>(consumer)) {
+                consumer = get_single_consumer(consumer);
+                if (!consumer)
+                    return true;
+            }
+
             if (ov::is_type<ov::opset1::MatMul>(consumer)) {
                 return false;
             } else if (ov::is_type<ov::opset1::Transpose>(consumer)) {
@@ -233,6 +242,8 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
             }
             return true;
         }, ov::pass::MarkDequantizationSubgraph);
+        // the weights lose u4/i4 types in ConvertPrecision, so their decompression is marked to be fused into FullyConnected
+        CPU_REGISTER_PASS_X64(manager, MarkLowBitWeightsDecompression);
     }
 
     auto get_convert_precisions = []() {
@@ -257,6 +268,8 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     static const auto precisions = get_convert_precisions();
     type_to_fuse_map type_to_fuse = {{ov::opset10::Convert::get_type_info_static(), fuse_type_to_convert}};
 
+    // fused before CommonOptimizations to keep the preprocessing chain in the form it is built by PrePostProcessor
+    CPU_REGISTER_PASS_COMMON(manager, PreprocessFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::AUGRUCellFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::BroadcastTransition);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::CommonOptimizations);
@@ -588,7 +601,7 @@ void Transformations::MainSnippets(void) {
     ngraph::pass::Manager snippetsManager;
     snippetsManager.set_per_pass_validation(false);
     if (snippetsMode != Config::SnippetsMode::IgnoreCallback)
-        CPU_REGISTER_PASS_X64(snippetsManager, SnippetsMarkSkipped, inferencePrecision != ov::element::f32);
+        CPU_REGISTER_PASS_X64(snippetsManager, SnippetsMarkSkipped, inferencePrecision != ov::element::f32, tokenization_config.concurrency);
     CPU_REGISTER_PASS_X64(snippetsManager, snippets::pass::SnippetsTokenization, tokenization_config);
 
     const bool isMHASupported =
@@ -635,16 +648,7 @@ void Transformations::MainSnippets(void) {
             return true;
         };
         auto is_unsupported_parallel_work_amount = [&](const std::shared_ptr<const ov::Node>& n, const ov::Shape& shape) {
-            const auto parallel_work_amount = std::accumulate(shape.rbegin() + 2, shape.rend(), 1, std::multiplies<size_t>());
-            // Heuristic values:
-            //    parallelism work amount - not enough work amount for parallelism
-            // TODO: The heuristic will be removed after parallelism support on JIT level
-            const auto needed_num_of_threads = 12lu;
-            const auto is_unsupported_parallel_work_amount =
-                parallel_get_num_threads() / 2 > parallel_work_amount &&
-                static_cast<size_t>(parallel_work_amount) < needed_num_of_threads &&
-                !ov::snippets::pass::CommonOptimizations::CanOptimizeParallelWA(n, tokenization_config.concurrency);
-            return is_unsupported_parallel_work_amount;
+            return isUnsupportedParallelWorkAmount(n, shape, tokenization_config.concurrency);
         };
 #endif // OPENVINO_ARCH_X86_64
         CPU_SET_CALLBACK_X64(snippetsManager, [&](const std::shared_ptr<const ov::Node>& n) -> bool {
@@ -666,7 +670,7 @@ void Transformations::MainSnippets(void) {
             return !is_supported_matmul(n) || is_unsupported_parallel_work_amount(n, n->get_output_shape(0));
         }, snippets::pass::ExtractReshapesFromMHA);
         CPU_SET_CALLBACK_X64(snippetsManager,
-            [](const std::shared_ptr<const ov::Node>& n) -> bool {
+            [&](const std::shared_ptr<const ov::Node>& n) -> bool {
                 if (n->is_dynamic())
                     return true;
                 // CPU Plugin support Swish in Subgraph via conversion to SwichCPU which assumes second input to be constant
@@ -685,6 +689,10 @@ void Transformations::MainSnippets(void) {
                                                        ov::is_type<const ov::op::v3::Broadcast>(n));
                 if (is_disabled_tokenization)
                     return true;
+                // the same check as in SnippetsMarkSkipped, so the skipped Reduce doesn't break the fusing chain
+                if (ov::is_type<const ov::op::util::ArithmeticReductionKeepDims>(n) &&
+                    !isSuitableSnippetsReduce(n, tokenization_config.concurrency))
+                    return true;
                 const auto& inputs = n->inputs();
                 // todo: clarify whether we can evaluate snippets on const paths
                 const bool has_only_const_inputs = std::all_of(inputs.begin(), inputs.end(),
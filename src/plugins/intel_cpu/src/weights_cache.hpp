@@ -5,6 +5,8 @@
 #pragma once
 
 #include "cpu_memory.h"
+#include "openvino/core/hash_util.hpp"
+#include "openvino/op/constant.hpp"
 
 #include <unordered_map>
 #include <functional>
@@ -25,26 +27,20 @@ namespace intel_cpu {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
+    // Computes 64-bit hash of the data content, the big buffers are hashed in parallel
     uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
+        return ov::util::hash_data(data, size);
+    }
+    // Returns the hash of the constant data, it is computed once and cached in the constant
+    uint64_t hash(const ov::op::v0::Constant& constant) const {
+        // the data of the lazy constant is its source converted to the element type, so the source is hashed
+        // instead of producing the data
+        if (const auto source = constant.get_lazy_source()) {
+            const auto type = static_cast<uint64_t>(static_cast<ov::element::Type_t>(constant.get_element_type()));
+            return ov::util::hash_xxh64(&type, sizeof(type), ov::util::hash_constant_data(*source));
+        }
+        return ov::util::hash_constant_data(constant);
     }
-
-protected:
-    static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
 };
 
 /**
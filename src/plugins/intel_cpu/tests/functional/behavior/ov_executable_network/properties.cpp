@@ -12,6 +12,7 @@
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "internal_properties.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
 
 namespace {
@@ -40,6 +41,12 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::execution_devices.name()),
         RO_property(ov::intel_cpu::denormals_optimization.name()),
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RO_property(ov::intel_cpu::runtime_cache_statistics.name()),
+        RO_property(ov::intel_cpu::shape_infer_cache_statistics.name()),
+        RO_property(ov::intel_cpu::telemetry.name()),
+        RO_property(ov::intel_cpu::jit_cache_statistics.name()),
+        RO_property(ov::intel_cpu::shared_weights_statistics.name()),
+        RO_property(ov::intel_cpu::packed_weights_statistics.name()),
     };
 
     ov::Core ie;
@@ -6,6 +6,7 @@
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "ngraph_functions/builders.hpp"
 #include <common_test_utils/ov_tensor_utils.hpp>
+#include <exec_graph_info.hpp>
 
 using namespace InferenceEngine;
 using namespace ov;
@@ -61,7 +62,7 @@ protected:
 
         ngraph::ParameterVector body_params;
         for (size_t i = 0; i < shapes.size(); i++) {
-            ngraph::PartialShape shape = shapes[i].first;
+            ngraph::PartialShape shape = inputDynamicShapes[i];
             shape[sequence_axis] = 1;
             auto paramNode = std::make_shared<ngraph::opset1::Parameter>(inType, shape);
             body_params.push_back(paramNode);
@@ -125,6 +126,11 @@ std::vector<std::vector<InputShape>> inputs = {
         },
     },
 
+    {  // static shapes: the iteration chunks are dense, so the body ports are bound as views of the TI tensors
+        {{}, {{1, 12, 10}}},
+        {{}, {{1, 12, 10}}},
+    },
+
     {  //second test suit
         {   //dynamic shape for first input
             {{1, 12}, 5, {1, 12}},
@@ -154,5 +160,200 @@ INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorSimple, TensorIteratorCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          TensorIteratorCPUTest::getTestCaseName);
 
+/*
+ *  The hidden state is passed to the next iteration by the back edge:
+ *      H_next = Tanh(X_i + H)
+ */
+using TensorIteratorBackEdgeParams = typename std::tuple<
+        InputShape,                                 // Sequence input shape
+        size_t,                                     // Sequence axis
+        ngraph::op::RecurrentSequenceDirection>;    // Direction
+
+class TensorIteratorBackEdgeCPUTest : public testing::WithParamInterface<TensorIteratorBackEdgeParams>,
+                                      virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<TensorIteratorBackEdgeParams> obj) {
+        InputShape shape;
+        size_t sequence_axis;
+        ngraph::op::RecurrentSequenceDirection direction;
+        std::tie(shape, sequence_axis, direction) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({shape.first}) << "_";
+        result << "TS=";
+        for (const auto& item : shape.second) {
+            result << ov::test::utils::vec2str(item) << "_";
+        }
+        result << "axis=" << sequence_axis << "_";
+        result << "direction=" << direction;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        InputShape shape;
+        size_t sequence_axis;
+        ngraph::op::RecurrentSequenceDirection direction;
+        std::tie(shape, sequence_axis, direction) = this->GetParam();
+
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ov::Shape state_shape = shape.second.front();
+        state_shape[sequence_axis] = 1;
+        init_input_shapes({shape, {{}, {state_shape}}});
+
+        ov::ParameterVector params;
+        for (auto&& input_shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ElementType::f32, input_shape));
+        }
+
+        auto body_x = std::make_shared<ngraph::opset1::Parameter>(ElementType::f32, state_shape);
+        auto body_h = std::make_shared<ngraph::opset1::Parameter>(ElementType::f32, state_shape);
+        auto add = std::make_shared<ngraph::opset1::Add>(body_x, body_h);
+        auto h_next = ngraph::builder::makeActivation(add, ElementType::f32, ngraph::helpers::Tanh);
+        auto body = std::make_shared<ov::Model>(ngraph::OutputVector{h_next}, ov::ParameterVector{body_x, body_h}, "body");
+
+        auto tensor_iterator = std::make_shared<ngraph::opset5::TensorIterator>();
+        tensor_iterator->set_function(body);
+        if (direction == ngraph::op::RecurrentSequenceDirection::FORWARD) {
+            tensor_iterator->set_sliced_input(body_x, params[0], 0, 1, 1, -1, sequence_axis);
+            tensor_iterator->get_concatenated_slices(h_next, 0, 1, 1, -1, sequence_axis);
+        } else {
+            tensor_iterator->set_sliced_input(body_x, params[0], -1, -1, 1, 0, sequence_axis);
+            tensor_iterator->get_concatenated_slices(h_next, -1, -1, 1, 0, sequence_axis);
+        }
+        tensor_iterator->set_merged_input(body_h, params[1], h_next);
+        auto last_h = tensor_iterator->get_iter_value(h_next, -1);
+
+        function = std::make_shared<ov::Model>(ngraph::OutputVector{tensor_iterator->output(0), last_h}, params);
+    }
+};
+
+TEST_P(TensorIteratorBackEdgeCPUTest, CompareWithRefs) {
+    run();
+}
+
+const std::vector<InputShape> backEdgeInputs = {
+    {{}, {{1, 7, 16}}},
+    {{}, {{4, 7, 16}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorBackEdge, TensorIteratorBackEdgeCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(backEdgeInputs),
+                                 ::testing::Values(1),
+                                 ::testing::ValuesIn(direction)),
+                         TensorIteratorBackEdgeCPUTest::getTestCaseName);
+
+/*
+ *  The back edge source is not an output of the TensorIterator, so it can be served by the swapped buffers:
+ *      Y_i = Tanh(X_i + H)
+ *      H_next = Sigmoid(X_i + H)
+ *  The body ports of the iteration chunks are bound as views only if the chunks are dense.
+ */
+using TensorIteratorZeroCopyParams = typename std::tuple<
+        InputShape,                                 // Sequence input shape
+        ngraph::op::RecurrentSequenceDirection,     // Direction
+        size_t,                                     // Expected number of the sliced ports bound as views
+        size_t>;                                    // Expected number of the swapped back edges
+
+class TensorIteratorZeroCopyCPUTest : public testing::WithParamInterface<TensorIteratorZeroCopyParams>,
+                                      virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<TensorIteratorZeroCopyParams> obj) {
+        InputShape shape;
+        ngraph::op::RecurrentSequenceDirection direction;
+        size_t views, swaps;
+        std::tie(shape, direction, views, swaps) = obj.param;
+
+        std::ostringstream result;
+        result << "TS=";
+        for (const auto& item : shape.second) {
+            result << ov::test::utils::vec2str(item) << "_";
+        }
+        result << "direction=" << direction << "_";
+        result << "views=" << views << "_";
+        result << "swaps=" << swaps;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        InputShape shape;
+        ngraph::op::RecurrentSequenceDirection direction;
+        std::tie(shape, direction, expectedViews, expectedSwaps) = this->GetParam();
+
+        const size_t sequence_axis = 1;
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ov::Shape state_shape = shape.second.front();
+        state_shape[sequence_axis] = 1;
+        init_input_shapes({shape, {{}, {state_shape}}});
+
+        ov::ParameterVector params;
+        for (auto&& input_shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ElementType::f32, input_shape));
+        }
+
+        auto body_x = std::make_shared<ngraph::opset1::Parameter>(ElementType::f32, state_shape);
+        auto body_h = std::make_shared<ngraph::opset1::Parameter>(ElementType::f32, state_shape);
+        auto add = std::make_shared<ngraph::opset1::Add>(body_x, body_h);
+        auto y = ngraph::builder::makeActivation(add, ElementType::f32, ngraph::helpers::Tanh);
+        auto h_next = ngraph::builder::makeActivation(add, ElementType::f32, ngraph::helpers::Sigmoid);
+        auto body = std::make_shared<ov::Model>(ngraph::OutputVector{y, h_next}, ov::ParameterVector{body_x, body_h}, "body");
+
+        auto tensor_iterator = std::make_shared<ngraph::opset5::TensorIterator>();
+        tensor_iterator->set_function(body);
+        if (direction == ngraph::op::RecurrentSequenceDirection::FORWARD) {
+            tensor_iterator->set_sliced_input(body_x, params[0], 0, 1, 1, -1, sequence_axis);
+            tensor_iterator->get_concatenated_slices(y, 0, 1, 1, -1, sequence_axis);
+        } else {
+            tensor_iterator->set_sliced_input(body_x, params[0], -1, -1, 1, 0, sequence_axis);
+            tensor_iterator->get_concatenated_slices(y, -1, -1, 1, 0, sequence_axis);
+        }
+        tensor_iterator->set_merged_input(body_h, params[1], h_next);
+        auto last_h = tensor_iterator->get_iter_value(h_next, -1);
+
+        function = std::make_shared<ov::Model>(ngraph::OutputVector{tensor_iterator->output(0), last_h}, params);
+    }
+
+    void checkPortBindings() const {
+        size_t tensorIterators = 0;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            if (it == rtInfo.end() || it->second.as<std::string>() != "TensorIterator")
+                continue;
+            tensorIterators++;
+            ASSERT_EQ(rtInfo.at("boundViews").as<std::string>(), std::to_string(expectedViews));
+            ASSERT_EQ(rtInfo.at("swappedBackEdges").as<std::string>(), std::to_string(expectedSwaps));
+        }
+        ASSERT_EQ(tensorIterators, 1u);
+    }
+
+    size_t expectedViews = 0;
+    size_t expectedSwaps = 0;
+};
+
+TEST_P(TensorIteratorZeroCopyCPUTest, CompareWithRefs) {
+    run();
+    checkPortBindings();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorZeroCopy_Dense, TensorIteratorZeroCopyCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Values(InputShape{{}, {{1, 7, 16}}}),
+                                 ::testing::ValuesIn(direction),
+                                 ::testing::Values(2),   // the sliced input and the concatenated output
+                                 ::testing::Values(1)),
+                         TensorIteratorZeroCopyCPUTest::getTestCaseName);
+
+// the outer dimension is not 1, so the iteration chunks are strided and copied, the back edge is swapped anyway
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorZeroCopy_Strided, TensorIteratorZeroCopyCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Values(InputShape{{}, {{4, 7, 16}}}),
+                                 ::testing::ValuesIn(direction),
+                                 ::testing::Values(0),
+                                 ::testing::Values(1)),
+                         TensorIteratorZeroCopyCPUTest::getTestCaseName);
+
 }  // namespace
 } // namespace CPULayerTestsDefinitions
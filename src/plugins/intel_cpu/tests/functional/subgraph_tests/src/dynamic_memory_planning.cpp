@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+/*This test runs the following subgraph:
+
+                      param
+                        |
+                      Relu
+                    /      \
+                MatMul    NonZero
+                  |          |
+               Softmax    Convert
+                  |          |
+               Result     Multiply
+                             |
+                           Result
+
+The main purpose of the test is to check the memory plans of the intermediate dynamic tensors:
+- the Relu output lives while both the branches are computed, so it must not share the arena with them
+- the input shapes grow and shrink, so the plans are switched and the arena is reallocated
+- the NonZero output size depends on the input values, so for the repeated input shapes it may exceed the size
+  planned for it and must fall back to the group memory without breaking the tensors placed into the arena
+*/
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+class DynamicMemoryPlanningCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({"CPU_DYNAMIC_MEMORY_PLANNING", "YES"});
+
+        const auto precision = ov::element::f32;
+        ov::test::InputShape input_shape{{-1, 64}, {{4, 64}, {7, 64}, {4, 64}, {16, 64}, {1, 64}, {4, 64}, {7, 64}}};
+        init_input_shapes({input_shape});
+
+        ov::ParameterVector params;
+        for (auto&& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, shape));
+        }
+        auto relu = ngraph::builder::makeActivation(params.front(), precision, ngraph::helpers::ActivationTypes::Relu);
+
+        auto weights = ngraph::builder::makeConstant(precision, {64, 32}, std::vector<float>{}, true);
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(relu, weights);
+        auto softmax = std::make_shared<ov::op::v1::Softmax>(matmul, 1);
+
+        auto nonzero = std::make_shared<ov::op::v3::NonZero>(relu, ov::element::i32);
+        auto convert = std::make_shared<ov::op::v0::Convert>(nonzero, precision);
+        auto scale = ngraph::builder::makeConstant(precision, {1}, std::vector<float>({2.0f}));
+        auto multiply = ngraph::builder::makeEltwise(convert, scale, ngraph::helpers::EltwiseTypes::MULTIPLY);
+
+        ngraph::ResultVector results = {std::make_shared<ngraph::opset3::Result>(softmax),
+                                        std::make_shared<ngraph::opset3::Result>(multiply)};
+        function = std::make_shared<ov::Model>(results, params, "DynamicMemoryPlanning");
+    }
+
+    // the share of the positive values changes from one inference to another, so the NonZero output of the
+    // repeated input shapes is bigger than the one the plan was built for
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInput = function->inputs().front();
+        auto tensor = ov::Tensor{funcInput.get_element_type(), targetInputStaticShapes.front()};
+        auto data = tensor.data<float>();
+        const size_t step = 3 - inferenceIdx % 3;
+        for (size_t i = 0; i < tensor.get_size(); i++) {
+            data[i] = i % step == 0 ? 1.f + static_cast<float>(i % 5) : -1.f;
+        }
+        inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+        inferenceIdx++;
+    }
+
+    size_t inferenceIdx = 0;
+};
+
+TEST_F(DynamicMemoryPlanningCPUTest, smoke_CompareWithRefs) {
+    run();
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+
+/*This test runs the following subgraph:
+
+         data            features
+           |                |
+      Convolution         MatMul
+           |                |
+         Relu             Result
+           |
+         Result
+
+The main purpose of the test is to check the export/import round trip of the weights reordered (packed) by the
+Convolution and FullyConnected nodes: the exported blob stores the packed weights, and the imported model uses them
+without any reorder and produces the same results as the original compiled model.
+*/
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+class ExportImportPackedWeightsCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    static std::shared_ptr<ov::Model> makeModel() {
+        const auto precision = ov::element::f32;
+        auto data = std::make_shared<ov::op::v0::Parameter>(precision, ov::Shape{1, 16, 28, 28});
+        auto conv = ngraph::builder::makeConvolution(data, precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 32);
+        auto relu = ngraph::builder::makeActivation(conv, precision, ngraph::helpers::ActivationTypes::Relu);
+
+        auto features = std::make_shared<ov::op::v0::Parameter>(precision, ov::Shape{4, 256});
+        auto weights = ngraph::builder::makeConstant(precision, {256, 128}, std::vector<float>{}, true);
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(features, weights);
+
+        return std::make_shared<ov::Model>(ov::NodeVector{relu, matmul}, ov::ParameterVector{data, features},
+                                           "PackedWeights");
+    }
+
+    static std::vector<ov::Tensor> infer(ov::CompiledModel& compiledModel, const std::vector<ov::Tensor>& inputs) {
+        auto request = compiledModel.create_infer_request();
+        for (size_t i = 0; i < inputs.size(); i++)
+            request.set_input_tensor(i, inputs[i]);
+        request.infer();
+
+        std::vector<ov::Tensor> outputs;
+        for (size_t i = 0; i < compiledModel.outputs().size(); i++) {
+            const auto& output = request.get_output_tensor(i);
+            ov::Tensor copy(output.get_element_type(), output.get_shape());
+            output.copy_to(copy);
+            outputs.push_back(copy);
+        }
+        return outputs;
+    }
+
+    static std::map<std::string, uint64_t> statistics(const ov::CompiledModel& compiledModel) {
+        return compiledModel.get_property("CPU_PACKED_WEIGHTS_STATISTICS").as<std::map<std::string, uint64_t>>();
+    }
+};
+
+TEST_F(ExportImportPackedWeightsCPUTest, smoke_ReusedAfterImport) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeModel(), ov::test::utils::DEVICE_CPU);
+    std::vector<ov::Tensor> inputs;
+    for (const auto& input : compiledModel.inputs())
+        inputs.push_back(ov::test::utils::create_and_fill_tensor(input.get_element_type(), input.get_shape()));
+    const auto expected = infer(compiledModel, inputs);
+
+    // the compiled model packs the weights itself
+    const auto compiledStatistics = statistics(compiledModel);
+    ASSERT_EQ(compiledStatistics.at("stored"), 0u);
+    ASSERT_EQ(compiledStatistics.at("hits"), 0u);
+
+    std::stringstream stream;
+    compiledModel.export_model(stream);
+    auto importedModel = core.import_model(stream, ov::test::utils::DEVICE_CPU);
+    const auto actual = infer(importedModel, inputs);
+
+    // all the weights packed by the original model are taken from the blob, none is reordered again
+    const auto importedStatistics = statistics(importedModel);
+    ASSERT_GT(importedStatistics.at("stored"), 0u);
+    ASSERT_GE(importedStatistics.at("hits"), importedStatistics.at("stored"));
+    ASSERT_EQ(importedStatistics.at("misses"), 0u);
+
+    // the same primitives are executed over the same weights, so the results are bitwise equal
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i].get_shape(), actual[i].get_shape());
+        ASSERT_EQ(std::memcmp(expected[i].data(), actual[i].data(), expected[i].get_byte_size()), 0) << "output " << i;
+    }
+}
+
+}  // namespace SubgraphTestsDefinitions
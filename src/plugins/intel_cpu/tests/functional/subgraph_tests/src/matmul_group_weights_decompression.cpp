@@ -0,0 +1,141 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/utils/data_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+/*
+ *                         Subtract_const(U4/I4, [OC, G, 1])
+ *                             /
+ *    Weights(U4/I4)      Convert(F32)
+ *    [OC, G, IC / G]      /
+ *       |                /
+ *    Convert(F32)       /
+ *            \         /
+ *            Subtract(opt)      Multiply_const(F32, [OC, G, 1])
+ *                  \             /
+ *                     Multiply
+ *                        |
+ *                  Reshape([OC, IC])
+ *                        |
+ *      Data(F32)        /
+ *            \         /
+ *    Matmul(transpose_b = true)
+ */
+using MatmulGroupWeightsDecompressionParams = std::tuple<InputShape,              // data shape
+                                                         ov::Shape,               // weights shape [OC, G, IC / G]
+                                                         ov::test::ElementType,   // weights precision
+                                                         bool>;                   // decompression subtract
+
+class MatmulGroupWeightsDecompression : public testing::WithParamInterface<MatmulGroupWeightsDecompressionParams>,
+                                        virtual public SubgraphBaseTest,
+                                        public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MatmulGroupWeightsDecompressionParams> obj) {
+        InputShape data_shape;
+        ov::Shape weights_shape;
+        ov::test::ElementType weights_precision;
+        bool decompression_sub;
+        std::tie(data_shape, weights_shape, weights_precision, decompression_sub) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({data_shape.first}) << "_TS=(";
+        for (const auto& shape : data_shape.second) {
+            result << ov::test::utils::vec2str(shape) << "_";
+        }
+        result << ")_weights_shape=" << ov::test::utils::vec2str(weights_shape) << "_";
+        result << "weights_precision=" << weights_precision << "_";
+        result << "decompression_subtract=" << decompression_sub;
+        return result.str();
+    }
+
+protected:
+    static std::shared_ptr<ov::Node> makeCompressedConstant(const ov::element::Type& precision, const ov::Shape& shape) {
+        const auto size = ov::shape_size(shape);
+        if (precision == ov::element::i4) {
+            return std::make_shared<ov::op::v0::Constant>(precision, shape,
+                                                          NGraphFunctions::Utils::generateVector<ov::element::Type_t::i8>(size, 7, -8));
+        }
+        return std::make_shared<ov::op::v0::Constant>(precision, shape,
+                                                      NGraphFunctions::Utils::generateVector<ov::element::Type_t::u8>(size, 15, 0));
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        InputShape data_shape;
+        ov::Shape weights_shape;
+        ov::test::ElementType weights_precision;
+        bool decompression_sub;
+        std::tie(data_shape, weights_shape, weights_precision, decompression_sub) = GetParam();
+        init_input_shapes({data_shape});
+
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0])};
+        auto weights = makeCompressedConstant(weights_precision, weights_shape);
+        weights->set_friendly_name("Compressed_weights");
+        std::shared_ptr<ov::Node> weights_path = std::make_shared<ov::op::v0::Convert>(weights, ov::element::f32);
+
+        const ov::Shape decompression_shape{weights_shape[0], weights_shape[1], 1};
+        if (decompression_sub) {
+            auto shift_const = makeCompressedConstant(weights_precision, decompression_shape);
+            auto shift_convert = std::make_shared<ov::op::v0::Convert>(shift_const, ov::element::f32);
+            weights_path = std::make_shared<ov::op::v1::Subtract>(weights_path, shift_convert);
+        }
+        auto scale_const = ngraph::builder::makeConstant<float>(ov::element::f32, decompression_shape, {}, true);
+        weights_path = std::make_shared<ov::op::v1::Multiply>(weights_path, scale_const);
+
+        const std::vector<size_t> target_shape{weights_shape[0], weights_shape[1] * weights_shape[2]};
+        auto reshape_const = ov::op::v0::Constant::create(ov::element::i32, {2}, target_shape);
+        weights_path = std::make_shared<ov::op::v1::Reshape>(weights_path, reshape_const, false);
+
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(params[0], weights_path, false, true);
+        function = makeNgraphFunction(ov::element::f32, params, matmul, "MatmulGroupWeightsDecompression");
+    }
+
+    void checkResults() {
+        // decompression operations are fused into FullyConnected on platforms with the low-bit decompression kernel
+        const size_t expected_count = with_cpu_x86_avx2() ? 0 : 1;
+        CheckNumberOfNodesWithType(compiledModel, "Convert", expected_count);
+        CheckNumberOfNodesWithType(compiledModel, "Eltwise", expected_count);
+    }
+};
+
+TEST_P(MatmulGroupWeightsDecompression, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    checkResults();
+}
+
+namespace {
+
+const std::vector<InputShape> data_shapes = {
+    {{-1, -1, 128}, {{1, 1, 128}, {1, 5, 128}}},
+    {{}, {{3, 7, 128}}},
+    // the batches bigger than the kernel rows limit are computed with the weights decompressed once per OC block
+    {{-1, -1, 128}, {{1, 2, 128}, {2, 40, 128}, {1, 3, 128}}},
+};
+const std::vector<ov::Shape> weights_shapes = {
+    {64, 4, 32},
+    {35, 2, 64},
+    {16, 8, 16},
+};
+const std::vector<ov::test::ElementType> weights_precisions = {ov::element::u4, ov::element::i4};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulGroupCompressedWeights,
+                         MatmulGroupWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(data_shapes),
+                                            ::testing::ValuesIn(weights_shapes),
+                                            ::testing::ValuesIn(weights_precisions),
+                                            ::testing::Values(true, false)),
+                         MatmulGroupWeightsDecompression::getTestCaseName);
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -4,6 +4,7 @@
 
 #include "test_utils/fusing_test_utils.hpp"
 #include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/utils/data_utils.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "transformations/rt_info/decompression.hpp"
 
@@ -94,6 +95,19 @@ public:
     }
 
 protected:
+    static std::shared_ptr<ov::Node> makeCompressedConstant(const ov::element::Type& precision, const ov::Shape& shape) {
+        // u8 values cover the whole range to be decompressed by oneDNN,
+        // while u4/i4 values are decompressed by the low-bit weights decompression kernel
+        const auto size = ov::shape_size(shape);
+        if (precision == ov::element::i4) {
+            return std::make_shared<ov::op::v0::Constant>(precision, shape,
+                                                          NGraphFunctions::Utils::generateVector<ov::element::Type_t::i8>(size, 7, -8));
+        }
+        const uint8_t up_to = precision == ov::element::u8 ? 255 : 15;
+        return std::make_shared<ov::op::v0::Constant>(precision, shape,
+                                                      NGraphFunctions::Utils::generateVector<ov::element::Type_t::u8>(size, up_to, 0));
+    }
+
     std::shared_ptr<ov::Model> initSubgraph(std::vector<ov::PartialShape>& inputShapes,
                                                 const ov::element::Type data_precision,
                                                 const ov::element::Type weights_precision,
@@ -110,7 +124,7 @@ protected:
         };
 
         auto weights_shape = transpose_if_necessary(inputShapes[1].to_shape());
-        auto weights = ngraph::builder::makeConstant<uint8_t>(weights_precision, weights_shape, {}, true);
+        auto weights = makeCompressedConstant(weights_precision, weights_shape);
         weights->set_friendly_name("Compressed_weights");
         auto weights_convert = std::make_shared<ngraph::opset1::Convert>(weights, data_precision);
 
@@ -119,7 +133,7 @@ protected:
         auto scaleshift_target_shape = transpose_if_necessary(ov::Shape{1, output_channels});
         auto scaleshift_const_shape = reshape_on_decompression ? ov::Shape{output_channels} : scaleshift_target_shape;
         if (add_subtract) {
-            auto shift_const = ngraph::builder::makeConstant<uint8_t>(weights_precision, scaleshift_const_shape, {}, true);
+            auto shift_const = makeCompressedConstant(weights_precision, scaleshift_const_shape);
             std::shared_ptr<ov::Node> shift_convert = std::make_shared<ngraph::opset1::Convert>(shift_const, data_precision);
             if (reshape_on_decompression) {
                 auto shift_reshape_const = ov::opset10::Constant::create(ov::element::i32, {scaleshift_target_shape.size()}, scaleshift_target_shape);
@@ -186,9 +200,13 @@ protected:
         const auto& test_param = GetParam();
         ov::test::ElementType weights_precision = std::get<1>(test_param);
         bool should_fuse = std::get<7>(test_param);
+        // 4-bit weights are unpacked to 8-bit ones by the plugin
+        const auto expected_weights_precision = weights_precision == ov::element::u4 ? ov::element::u8
+                                              : weights_precision == ov::element::i4 ? ov::element::i8
+                                              : weights_precision;
         for (const auto& n : compiledModel.get_runtime_model()->get_ordered_ops()) {
             if (n->get_friendly_name() == "Compressed_weights") {
-                ASSERT_EQ(n->get_output_element_type(0), weights_precision);
+                ASSERT_EQ(n->get_output_element_type(0), expected_weights_precision);
             }
         }
 
@@ -227,6 +245,11 @@ bool shouldUseDecompressionKernelBig() {
     return true;
 }
 
+bool shouldUseLowBitDecompressionKernel() {
+    // Low-bit weights decompression kernel has no AMX shape limitations
+    return with_cpu_x86_avx2();
+}
+
 bool shouldUseDecompressionKernelBasic() {
     // AMX decompression support has shape limitations
     if (with_cpu_x86_avx512_core_amx())
@@ -269,6 +292,20 @@ INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_basic,
                                             ::testing::Values(shouldUseDecompressionKernelBasic())),
                          MatmulWeightsDecompression::getTestCaseName);
 
+const std::vector<ov::test::ElementType> low_bit_weights_precisions = {ov::element::u4, ov::element::i4};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_low_bit,
+                         MatmulWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes_basic),
+                                            ::testing::ValuesIn(low_bit_weights_precisions),
+                                            ::testing::Values(true),
+                                            ::testing::Values(true),
+                                            ::testing::Values(true),
+                                            ::testing::ValuesIn(filterAdditionalConfigBasic()),
+                                            ::testing::ValuesIn(fusingParamsSet),
+                                            ::testing::Values(shouldUseLowBitDecompressionKernel())),
+                         MatmulWeightsDecompression::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_big,
                          MatmulWeightsDecompression,
                          ::testing::Combine(::testing::ValuesIn(input_shapes_big),
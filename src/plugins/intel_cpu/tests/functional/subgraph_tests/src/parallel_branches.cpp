@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "openvino/core/parallel.hpp"
+
+/*This test runs the following subgraph:
+
+                      param
+                        |
+                      Relu
+                    /   |   \
+               MatMul MatMul  Add
+                 |      |      |
+                Add   Sigmoid MatMul
+                  \     |     /
+                     Concat
+                       |
+                     Result
+
+The main purpose of the test is to check that the independent branches are really executed in parallel and
+produce the same results as the sequential execution, i.e. the memory reuse plan stays correct.
+*/
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+class ParallelBranchesCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({"CPU_ENABLE_PARALLEL_BRANCHES", "YES"});
+
+        const auto precision = ov::element::f32;
+        ov::test::InputShape input_shape{{}, {{4, 64}}};
+        init_input_shapes({input_shape});
+
+        ov::ParameterVector params;
+        for (auto&& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, shape));
+        }
+        auto relu = ngraph::builder::makeActivation(params.front(), precision, ngraph::helpers::ActivationTypes::Relu);
+        auto add_const = ngraph::builder::makeConstant(precision, {1}, std::vector<float>({1.0f}));
+
+        auto weights_1 = ngraph::builder::makeConstant(precision, {64, 32}, std::vector<float>{}, true);
+        auto matmul_1 = std::make_shared<ov::op::v0::MatMul>(relu, weights_1);
+        auto add_1 = ngraph::builder::makeEltwise(matmul_1, add_const, ngraph::helpers::EltwiseTypes::ADD);
+
+        auto weights_2 = ngraph::builder::makeConstant(precision, {64, 32}, std::vector<float>{}, true);
+        auto matmul_2 = std::make_shared<ov::op::v0::MatMul>(relu, weights_2);
+        auto sigmoid = ngraph::builder::makeActivation(matmul_2, precision, ngraph::helpers::ActivationTypes::Sigmoid);
+
+        auto add_3 = ngraph::builder::makeEltwise(relu, add_const, ngraph::helpers::EltwiseTypes::ADD);
+        auto weights_3 = ngraph::builder::makeConstant(precision, {64, 32}, std::vector<float>{}, true);
+        auto matmul_3 = std::make_shared<ov::op::v0::MatMul>(add_3, weights_3);
+
+        auto concat = ngraph::builder::makeConcat({add_1, sigmoid, matmul_3}, 1);
+        ngraph::ResultVector results = {std::make_shared<ngraph::opset3::Result>(concat)};
+        function = std::make_shared<ov::Model>(results, params, "ParallelBranches");
+    }
+
+    // the numbers of nodes of the groups executed simultaneously
+    std::map<std::string, size_t> getParallelStages() const {
+        std::map<std::string, size_t> stages;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find("parallelStage");
+            if (it != rtInfo.end())
+                stages[it->second.as<std::string>()]++;
+        }
+        return stages;
+    }
+};
+
+TEST_F(ParallelBranchesCPUTest, smoke_CompareWithRefs) {
+    run();
+
+    const auto stages = getParallelStages();
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    if (parallel_get_max_threads() > 1) {
+        // at least the MatMul operations of the three branches do not depend on each other
+        ASSERT_FALSE(stages.empty());
+        for (const auto& stage : stages) {
+            ASSERT_GT(stage.second, 1u) << "Stage " << stage.first << " consists of a single node";
+        }
+        return;
+    }
+#endif
+    // the branches are executed sequentially without TBB
+    ASSERT_TRUE(stages.empty());
+}
+
+} // namespace SubgraphTestsDefinitions
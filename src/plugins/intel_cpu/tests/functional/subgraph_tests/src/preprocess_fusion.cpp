@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <openvino/core/preprocess/pre_post_process.hpp>
+
+/*This test runs the following subgraph:
+
+     Y   UV
+      \  /
+   NV12toRGB/I420toRGB
+        |
+     Convert
+        |
+   Interpolate
+        |
+  Subtract (mean)
+        |
+  Divide (scale)
+        |
+    Transpose
+        |
+   Convolution
+        |
+      Result
+
+The preprocessing subgraph is built by PrePostProcessor and is expected to be executed by a single Preprocess node.
+*/
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+using PreprocessFusionCPUTestParams = std::tuple<ov::preprocess::ColorFormat,  // source color format
+                                                 ov::Shape>;                     // source image shape in NHWC layout
+
+class PreprocessFusionCPUTest : public testing::WithParamInterface<PreprocessFusionCPUTestParams>,
+                                virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<PreprocessFusionCPUTestParams>& obj) {
+        ov::preprocess::ColorFormat format;
+        ov::Shape shape;
+        std::tie(format, shape) = obj.param;
+
+        std::ostringstream result;
+        result << "format=" << static_cast<int>(format) << "_";
+        result << "IS=" << ov::test::utils::vec2str(shape);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        ov::preprocess::ColorFormat format;
+        ov::Shape shape;
+        std::tie(format, shape) = this->GetParam();
+
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, ov::Shape{1, 3, 224, 224});
+        auto conv = ngraph::builder::makeConvolution(param, precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 8);
+        function = std::make_shared<ov::Model>(ov::NodeVector{conv}, ov::ParameterVector{param}, "PreprocessFusion");
+
+        ov::preprocess::PrePostProcessor ppp(function);
+        ppp.input().tensor()
+            .set_element_type(ov::element::u8)
+            .set_color_format(format)
+            .set_spatial_static_shape(shape[1], shape[2]);
+        ppp.input().preprocess()
+            .convert_color(ov::preprocess::ColorFormat::RGB)
+            .convert_element_type(ov::element::f32)
+            .resize(ov::preprocess::ResizeAlgorithm::RESIZE_LINEAR)
+            .mean({123.675f, 116.28f, 103.53f})
+            .scale({58.395f, 57.12f, 57.375f});
+        ppp.input().model().set_layout("NCHW");
+        function = ppp.build();
+
+        std::vector<ov::Shape> shapes;
+        for (const auto& param : function->get_parameters())
+            shapes.push_back(param->get_shape());
+        init_input_shapes(static_shapes_to_test_representation(shapes));
+        // u8 color conversion results are rounded, so the values may differ by one step before the normalization
+        abs_threshold = 2e-2;
+    }
+};
+
+TEST_P(PreprocessFusionCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Preprocess", 1);
+}
+
+namespace {
+
+const std::vector<ov::preprocess::ColorFormat> formats = {
+    ov::preprocess::ColorFormat::NV12_SINGLE_PLANE,
+    ov::preprocess::ColorFormat::NV12_TWO_PLANES,
+    ov::preprocess::ColorFormat::I420_SINGLE_PLANE,
+    ov::preprocess::ColorFormat::I420_THREE_PLANES,
+};
+
+const std::vector<ov::Shape> shapes = {
+    {1, 480, 640, 3},
+    {1, 112, 100, 3},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_PreprocessFusion, PreprocessFusionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(formats),
+                                            ::testing::ValuesIn(shapes)),
+                         PreprocessFusionCPUTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+/*This test runs the following subgraphs:
+
+        LayerNorm                         RMSNorm
+
+          param                            param
+          /   \                            /   \
+    ReduceMean |                        Power   |
+          \   /                           |     |
+        Subtract                     ReduceMean |
+          /   \                           |     |
+      Power    |                         Add    |
+        |      |                          |     |
+   ReduceMean  |                        Sqrt    |
+        |      |                          \    /
+       Add     |                          Divide
+        |      |                            |
+      Sqrt     |                         Multiply
+         \    /                             |
+         Divide                           Result
+           |
+        Multiply
+           |
+          Add
+           |
+         Result
+
+The main purpose of the test is to check that the normalization blocks decomposed by the frameworks are tokenized
+into a single Subgraph node: the Reduce operations by the last axis are decomposed by snippets into the accumulation
+Loop and Horizon op instead of being executed by the separate Reduce nodes.
+*/
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+enum class NormPattern { LayerNorm, RMSNorm };
+
+using ReduceNormSnippetsCPUTestParams = std::tuple<NormPattern,  // normalization pattern
+                                                   ov::Shape>;   // input shape
+
+class ReduceNormSnippetsCPUTest : public testing::WithParamInterface<ReduceNormSnippetsCPUTestParams>,
+                                  virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ReduceNormSnippetsCPUTestParams>& obj) {
+        NormPattern pattern;
+        ov::Shape shape;
+        std::tie(pattern, shape) = obj.param;
+
+        std::ostringstream result;
+        result << (pattern == NormPattern::LayerNorm ? "LayerNorm" : "RMSNorm") << "_";
+        result << "IS=" << ov::test::utils::vec2str(shape);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32.to_string()});
+
+        NormPattern pattern;
+        ov::Shape shape;
+        std::tie(pattern, shape) = this->GetParam();
+        init_input_shapes(static_shapes_to_test_representation({shape}));
+
+        const auto precision = ov::element::f32;
+        const auto channels = shape.back();
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, shape);
+        auto axes = ngraph::builder::makeConstant(ov::element::i64, {1}, std::vector<int64_t>{-1});
+        auto power_const = ngraph::builder::makeConstant(precision, {1}, std::vector<float>{2.f});
+        auto eps = ngraph::builder::makeConstant(precision, {1}, std::vector<float>{1e-5f});
+        auto gamma = ngraph::builder::makeConstant(precision, {channels}, std::vector<float>{}, true);
+
+        std::shared_ptr<ov::Node> norm;
+        if (pattern == NormPattern::LayerNorm) {
+            auto mean = ngraph::builder::makeReduce(param, axes, true, ngraph::helpers::ReductionType::Mean);
+            auto centered = ngraph::builder::makeEltwise(param, mean, ngraph::helpers::EltwiseTypes::SUBTRACT);
+            auto sqr = ngraph::builder::makeEltwise(centered, power_const, ngraph::helpers::EltwiseTypes::POWER);
+            auto var = ngraph::builder::makeReduce(sqr, axes, true, ngraph::helpers::ReductionType::Mean);
+            auto var_eps = ngraph::builder::makeEltwise(var, eps, ngraph::helpers::EltwiseTypes::ADD);
+            auto stddev = std::make_shared<ov::op::v0::Sqrt>(var_eps);
+            auto normalized = ngraph::builder::makeEltwise(centered, stddev, ngraph::helpers::EltwiseTypes::DIVIDE);
+            auto scaled = ngraph::builder::makeEltwise(normalized, gamma, ngraph::helpers::EltwiseTypes::MULTIPLY);
+            auto beta = ngraph::builder::makeConstant(precision, {channels}, std::vector<float>{}, true);
+            norm = ngraph::builder::makeEltwise(scaled, beta, ngraph::helpers::EltwiseTypes::ADD);
+        } else {
+            auto sqr = ngraph::builder::makeEltwise(param, power_const, ngraph::helpers::EltwiseTypes::POWER);
+            auto mean_sqr = ngraph::builder::makeReduce(sqr, axes, true, ngraph::helpers::ReductionType::Mean);
+            auto mean_sqr_eps = ngraph::builder::makeEltwise(mean_sqr, eps, ngraph::helpers::EltwiseTypes::ADD);
+            auto rms = std::make_shared<ov::op::v0::Sqrt>(mean_sqr_eps);
+            auto normalized = ngraph::builder::makeEltwise(param, rms, ngraph::helpers::EltwiseTypes::DIVIDE);
+            norm = ngraph::builder::makeEltwise(normalized, gamma, ngraph::helpers::EltwiseTypes::MULTIPLY);
+        }
+
+        ngraph::ResultVector results = {std::make_shared<ngraph::opset3::Result>(norm)};
+        function = std::make_shared<ov::Model>(results, ov::ParameterVector{param}, "ReduceNormSnippets");
+    }
+};
+
+TEST_P(ReduceNormSnippetsCPUTest, CompareWithRefs) {
+    // snippets are supported on x64 only
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP();
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Reduce", 0);
+}
+
+namespace {
+
+const std::vector<NormPattern> patterns = {
+    NormPattern::LayerNorm,
+    NormPattern::RMSNorm,
+};
+
+// the outer dimensions give enough parallel work amount for the Subgraph, the last one has a tail
+const std::vector<ov::Shape> shapes = {
+    {2, 8, 16, 64},
+    {1, 12, 3, 37},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ReduceNormSnippets, ReduceNormSnippetsCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(patterns),
+                                            ::testing::ValuesIn(shapes)),
+                         ReduceNormSnippetsCPUTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace SubgraphTestsDefinitions
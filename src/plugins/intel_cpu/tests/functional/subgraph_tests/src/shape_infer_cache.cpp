@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+/*This test runs the following subgraph:
+
+              data      target_shape
+               |            |
+             Relu           |
+               \           /
+                  Reshape
+                     |
+                  Softmax
+                     |
+                   Result
+
+The main purpose of the test is to check the memoized shape inference results:
+- Relu and Softmax output shapes depend on the input shapes only, so they are taken from the cache when the input
+  shapes repeat: Relu precedes the data dependent Reshape, so it is restored by the graph input shapes lookup, while
+  Softmax follows Reshape and uses the own cache of the node
+- Reshape output shape depends on the target_shape values, which change while the input shapes repeat, so the
+  Reshape shape inference must never be memoized
+*/
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+class ShapeInferCacheCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({"CPU_SHAPE_INFER_CACHE_CAPACITY", "16"});
+
+        const auto precision = ov::element::f32;
+        ov::test::InputShape data_shape{{-1, 64}, {{4, 64}, {4, 64}, {8, 64}, {4, 64}, {8, 64}, {4, 64}}};
+        ov::test::InputShape target_shape{{2}, {{2}, {2}, {2}, {2}, {2}, {2}}};
+        init_input_shapes({data_shape, target_shape});
+
+        auto data = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes[0]);
+        auto target = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, inputDynamicShapes[1]);
+        auto relu = ngraph::builder::makeActivation(data, precision, ngraph::helpers::ActivationTypes::Relu);
+        auto reshape = std::make_shared<ov::op::v1::Reshape>(relu, target, false);
+        auto softmax = std::make_shared<ov::op::v1::Softmax>(reshape, 1);
+
+        ngraph::ResultVector results = {std::make_shared<ngraph::opset3::Result>(softmax)};
+        function = std::make_shared<ov::Model>(results, ov::ParameterVector{data, target}, "ShapeInferCache");
+    }
+
+    // the same data shapes are reshaped to {N * 2, 32} and to {N * 4, 16} in turn
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        auto data_tensor = ov::test::utils::create_and_fill_tensor(funcInputs[0].get_element_type(),
+                                                                  targetInputStaticShapes[0]);
+        inputs.insert({funcInputs[0].get_node_shared_ptr(), data_tensor});
+
+        const auto factor = inferenceIdx++ % 2 == 0 ? 2 : 4;
+        auto shape_tensor = ov::Tensor{ov::element::i64, targetInputStaticShapes[1]};
+        auto shape_data = shape_tensor.data<ov::element_type_traits<ov::element::i64>::value_type>();
+        shape_data[0] = static_cast<int64_t>(targetInputStaticShapes[0][0] * factor);
+        shape_data[1] = static_cast<int64_t>(64 / factor);
+        inputs.insert({funcInputs[1].get_node_shared_ptr(), shape_tensor});
+    }
+
+    size_t inferenceIdx = 0;
+};
+
+TEST_F(ShapeInferCacheCPUTest, smoke_CompareWithRefs) {
+    run();
+
+    const auto statistics =
+        compiledModel.get_property("CPU_SHAPE_INFER_CACHE_STATISTICS").as<std::map<std::string, uint64_t>>();
+    ASSERT_GT(statistics.at("hits"), 0u);
+    ASSERT_GT(statistics.at("misses"), 0u);
+    // the graph input shapes repeat, so Relu shapes are restored by the graph lookup
+    ASSERT_GT(statistics.at("graph_hits"), 0u);
+    ASSERT_GT(statistics.at("graph_misses"), 0u);
+}
+
+} // namespace SubgraphTestsDefinitions
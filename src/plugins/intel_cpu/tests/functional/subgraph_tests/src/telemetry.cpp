@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+/*This test runs the following subgraph:
+
+                      param
+                        |
+                      Relu
+                        |
+                      MatMul
+                        |
+                     Softmax
+                        |
+                      Result
+
+The main purpose of the test is to check that the sampled runtime telemetry does not affect the inference results,
+and that the telemetry of the dynamic graph is collected and reported by the compiled model.
+*/
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+class TelemetryCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({"CPU_TELEMETRY_SAMPLING_RATE", "1"});
+
+        const auto precision = ov::element::f32;
+        ov::test::InputShape input_shape{{-1, 64}, {{4, 64}, {7, 64}, {1, 64}}};
+        init_input_shapes({input_shape});
+
+        ov::ParameterVector params;
+        for (auto&& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, shape));
+        }
+        auto relu = ngraph::builder::makeActivation(params.front(), precision, ngraph::helpers::ActivationTypes::Relu);
+        relu->set_friendly_name("relu");
+        auto weights = ngraph::builder::makeConstant(precision, {64, 32}, std::vector<float>{}, true);
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(relu, weights);
+        auto softmax = std::make_shared<ov::op::v1::Softmax>(matmul, 1);
+
+        ngraph::ResultVector results = {std::make_shared<ngraph::opset3::Result>(softmax)};
+        function = std::make_shared<ov::Model>(results, params, "Telemetry");
+    }
+};
+
+TEST_F(TelemetryCPUTest, smoke_CompareWithRefs) {
+    run();
+
+    const auto telemetry = compiledModel.get_property("CPU_TELEMETRY").as<std::map<std::string, uint64_t>>();
+    ASSERT_EQ(telemetry.at("sampled_inferences"), telemetry.at("inferences"));
+    ASSERT_GT(telemetry.at("sampled_inferences"), 0u);
+    ASSERT_GT(telemetry.at("request_p99_ns"), 0u);
+    ASSERT_GE(telemetry.at("request_p99_ns"), telemetry.at("request_p50_ns"));
+    ASSERT_GT(telemetry.at("update_shapes_ns"), 0u);
+    ASSERT_GT(telemetry.at("execute_ns"), 0u);
+    ASSERT_GT(telemetry.at("node.relu.count"), 0u);
+    ASSERT_EQ(telemetry.count("runtime_cache_hits"), 1u);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset6.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include <gtest/gtest.h>
+
+/*This test runs the following subgraph:
+
+            param    ReadValue
+                \    /    |
+                 Add      |
+                /   \     |
+           Result  Assign |
+                          |
+                      Multiply --- Result
+
+The state consumers and the producer of the new state use the memory of the infer request state directly. The main
+purpose of the test is to check that the double buffered state memory keeps the states of the different infer requests
+independent, and that the state can be read, set and reset between the inferences.
+*/
+
+namespace SubgraphTestsDefinitions {
+
+TEST(VariableStateInPlaceCPUTest, smoke_AccumulateState) {
+    const ov::Shape shape{1, 16};
+    const auto precision = ov::element::f32;
+    auto param = std::make_shared<ov::opset6::Parameter>(precision, shape);
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{shape, precision, "state"});
+    auto readValue = std::make_shared<ov::opset6::ReadValue>(param, variable);
+    auto add = std::make_shared<ov::opset6::Add>(readValue, param);
+    auto assign = std::make_shared<ov::opset6::Assign>(add, variable);
+    auto scale = ov::opset6::Constant::create(precision, {1}, {2.0f});
+    auto multiply = std::make_shared<ov::opset6::Multiply>(readValue, scale);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset6::Result>(add),
+                                                              std::make_shared<ov::opset6::Result>(multiply)},
+                                             ov::SinkVector{assign},
+                                             ov::ParameterVector{param});
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(model, ov::test::utils::DEVICE_CPU);
+    auto request1 = compiledModel.create_infer_request();
+    auto request2 = compiledModel.create_infer_request();
+
+    ov::Tensor input(precision, shape);
+    std::fill_n(input.data<float>(), input.get_size(), 1.0f);
+    request1.set_input_tensor(input);
+    request2.set_input_tensor(input);
+
+    auto checkState = [&](ov::InferRequest& request, float expected) {
+        auto states = request.query_state();
+        ASSERT_EQ(states.size(), 1u);
+        const auto state = states.front().get_state();
+        for (size_t i = 0; i < state.get_size(); i++)
+            ASSERT_EQ(state.data<float>()[i], expected);
+    };
+
+    // the states of the requests sharing the same graph are independent
+    for (size_t i = 1; i <= 3; i++) {
+        request1.infer();
+        checkState(request1, static_cast<float>(i));
+        const auto previousState = request1.get_output_tensor(1);
+        ASSERT_EQ(previousState.data<float>()[0], 2.0f * (i - 1));
+    }
+    request2.infer();
+    checkState(request2, 1.0f);
+    checkState(request1, 3.0f);
+
+    ov::Tensor newState(precision, shape);
+    std::fill_n(newState.data<float>(), newState.get_size(), 10.0f);
+    request1.query_state().front().set_state(newState);
+    request1.infer();
+    checkState(request1, 11.0f);
+
+    request1.query_state().front().reset();
+    request1.infer();
+    checkState(request1, 1.0f);
+}
+
+} // namespace SubgraphTestsDefinitions
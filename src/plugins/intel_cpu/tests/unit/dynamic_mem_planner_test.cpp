@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <dynamic_mem_planner.h>
+
+using namespace ov::intel_cpu;
+
+namespace {
+bool overlap(const MemoryMngrPtr& lhs, size_t lhsSize, const MemoryMngrPtr& rhs, size_t rhsSize) {
+    auto l = static_cast<uint8_t*>(lhs->getRawPtr());
+    auto r = static_cast<uint8_t*>(rhs->getRawPtr());
+    return l < r + rhsSize && r < l + lhsSize;
+}
+} // namespace
+
+TEST(DynamicMemoryPlannerTest, PlanPerInputShapes) {
+    DynamicMemoryPlanner planner;
+    // a -> b -> c, "a" and "c" do not live at the same time
+    auto a = planner.addBlock({0, 1, 0, 0});
+    auto b = planner.addBlock({1, 2, 0, 1});
+    auto c = planner.addBlock({2, 3, 0, 2});
+
+    auto infer = [&](const std::vector<VectorDims>& inputDims, size_t sizeA, size_t sizeB, size_t sizeC) {
+        planner.beginInfer(inputDims);
+        bool reallocated = false;
+        reallocated |= a->resize(sizeA);
+        reallocated |= b->resize(sizeB);
+        reallocated |= c->resize(sizeC);
+        planner.endInfer();
+        return reallocated;
+    };
+
+    ASSERT_TRUE(infer({{1, 16}}, 1024, 2048, 1024));
+    ASSERT_EQ(planner.getPlansCount(), 1u);
+    ASSERT_EQ(planner.getArenaSize(), 3072u);
+    ASSERT_TRUE(a->hasExtBuffer());
+    ASSERT_FALSE(overlap(a, 1024, b, 2048));
+    ASSERT_FALSE(overlap(b, 2048, c, 1024));
+    ASSERT_EQ(a->getRawPtr(), c->getRawPtr());
+
+    // the steady state: the planned memory is used without reallocations
+    ASSERT_FALSE(infer({{1, 16}}, 1024, 2048, 1024));
+    ASSERT_EQ(planner.getPlansCount(), 1u);
+
+    // the bigger shapes exceed the planned sizes
+    ASSERT_TRUE(infer({{4, 16}}, 4096, 8192, 4096));
+    ASSERT_EQ(planner.getPlansCount(), 2u);
+    ASSERT_EQ(planner.getArenaSize(), 12288u);
+    ASSERT_FALSE(infer({{4, 16}}, 4096, 8192, 4096));
+
+    // switching back to the smaller plan does not need the shape inference to reallocate anything,
+    // but the arena is trimmed as the plan needs less than a half of it
+    ASSERT_FALSE(infer({{1, 16}}, 1024, 2048, 1024));
+    ASSERT_EQ(planner.getPlansCount(), 2u);
+    ASSERT_EQ(planner.getArenaSize(), 3072u);
+    ASSERT_FALSE(overlap(a, 1024, b, 2048));
+    ASSERT_FALSE(overlap(b, 2048, c, 1024));
+}
+
+TEST(DynamicMemoryPlannerTest, UnplannedTensorsShareGroupMemory) {
+    DynamicMemoryPlanner planner;
+    // a -> b -> c, "a" and "c" do not live at the same time
+    auto a = planner.addBlock({0, 1, 0, 0});
+    auto b = planner.addBlock({1, 2, 0, 1});
+    auto c = planner.addBlock({2, 3, 0, 2});
+
+    // there is no plan for the first inference, so the tensors are grouped like without the planner
+    planner.beginInfer({{1, 16}});
+    ASSERT_TRUE(a->resize(1024));
+    ASSERT_TRUE(b->resize(2048));
+    ASSERT_TRUE(c->resize(512));
+    ASSERT_FALSE(a->hasExtBuffer());
+    ASSERT_EQ(a->getRawPtr(), c->getRawPtr());
+    ASSERT_FALSE(overlap(a, 1024, b, 2048));
+    planner.endInfer();
+    ASSERT_TRUE(a->hasExtBuffer());
+
+    // "c" exceeds the planned size and takes the group memory while the others stay in the arena
+    planner.beginInfer({{2, 16}});
+    ASSERT_FALSE(a->resize(1024));
+    ASSERT_FALSE(b->resize(2048));
+    ASSERT_TRUE(c->resize(4096));
+    ASSERT_TRUE(a->hasExtBuffer());
+    ASSERT_FALSE(c->hasExtBuffer());
+    ASSERT_FALSE(overlap(b, 2048, c, 4096));
+    planner.endInfer();
+    ASSERT_EQ(planner.getPlansCount(), 2u);
+    ASSERT_TRUE(c->hasExtBuffer());
+}
@@ -0,0 +1,290 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include <cache/jit_code_cache.h>
+#include <common_test_utils/common_utils.hpp>
+#include <common_test_utils/file_utils.hpp>
+
+#if defined(OPENVINO_ARCH_X86_64)
+# include <cpu/x64/jit_generator.hpp>
+#endif
+
+#if defined(__linux__)
+# include <sys/stat.h>
+#endif
+
+using namespace ov::intel_cpu;
+
+TEST(JitCodeCacheTest, KeyDependsOnParameters) {
+    JitCodeCache::Key key1("kernel");
+    key1 << size_t(1) << true;
+    JitCodeCache::Key key2("kernel");
+    key2 << size_t(1) << true;
+    JitCodeCache::Key key3("kernel");
+    key3 << size_t(2) << true;
+    JitCodeCache::Key key4("other_kernel");
+    key4 << size_t(1) << true;
+
+    ASSERT_EQ(key1.str(), key2.str());
+    ASSERT_EQ(key1.hash(), key2.hash());
+    ASSERT_NE(key1.str(), key3.str());
+    ASSERT_NE(key1.hash(), key3.hash());
+    ASSERT_NE(key1.str(), key4.str());
+}
+
+TEST(JitCodeCacheTest, FindRelocations) {
+    const size_t size = 64;
+    std::vector<uint8_t> a(size, 0x90), b(size, 0x90);
+    const auto baseA = reinterpret_cast<uintptr_t>(a.data());
+    const auto baseB = reinterpret_cast<uintptr_t>(b.data());
+    // the absolute addresses of the same offset inside the code copies
+    const uint64_t addressA = baseA + 48, addressB = baseB + 48;
+    std::memcpy(a.data() + 2, &addressA, sizeof(addressA));
+    std::memcpy(b.data() + 2, &addressB, sizeof(addressB));
+
+    std::vector<uint32_t> relocations;
+    ASSERT_TRUE(JitCodeCache::findRelocations(a.data(), b.data(), size, relocations));
+    ASSERT_EQ(relocations, std::vector<uint32_t>{2});
+
+    // the difference which is not an address inside the code
+    b[20] = 0xC3;
+    ASSERT_FALSE(JitCodeCache::findRelocations(a.data(), b.data(), size, relocations));
+}
+
+#if defined(__linux__)
+TEST(JitCodeCacheTest, ReferencesProcessMemory) {
+    static const int table[4] = {1, 2, 3, 4};
+    const size_t size = 64;
+    std::vector<uint8_t> code(size, 0x90);
+    // the relocated address of the code itself is allowed
+    const uint64_t ownAddress = reinterpret_cast<uintptr_t>(code.data()) + 48;
+    std::memcpy(code.data() + 2, &ownAddress, sizeof(ownAddress));
+    const std::vector<uint32_t> relocations{2};
+    ASSERT_FALSE(JitCodeCache::referencesProcessMemory(code.data(), size, relocations));
+
+    // the address of the static table is equal in both copies, but is not valid in another process
+    const uint64_t tableAddress = reinterpret_cast<uintptr_t>(table);
+    std::memcpy(code.data() + 21, &tableAddress, sizeof(tableAddress));
+    ASSERT_TRUE(JitCodeCache::referencesProcessMemory(code.data(), size, relocations));
+}
+#endif  // __linux__
+
+#if defined(OPENVINO_ARCH_X86_64) && defined(__linux__)
+namespace {
+using namespace dnnl::impl::cpu::x64;
+
+// returns the value from the table addressed by the absolute address of the table in the code
+struct jit_table_kernel : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_table_kernel)
+
+    explicit jit_table_kernel(int value) : jit_generator(jit_name()), value(value) {}
+
+    void generate() override {
+        Xbyak::Label table;
+        mov(rax, table);
+        mov(eax, dword[rax]);
+        ret();
+        align(64);
+        L(table);
+        dd(value);
+    }
+
+    int value;
+};
+
+const int staticValue = 5;
+
+// returns the value of the static variable addressed by its absolute address
+struct jit_static_kernel : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_static_kernel)
+
+    explicit jit_static_kernel(int) : jit_generator(jit_name()) {}
+
+    void generate() override {
+        mov(rax, reinterpret_cast<size_t>(&staticValue));
+        mov(eax, dword[rax]);
+        ret();
+    }
+};
+
+// the copy is created with copyArg, so the kernels generating different code can be emulated
+template <typename Kernel, typename Arg>
+JitCodeCache::CodePtr createKernel(JitCodeCache& cache, const JitCodeCache::Key& key, Kernel& kernel, Arg copyArg) {
+    std::unique_ptr<Kernel> copy;
+    return cache.getOrCreate(
+        key,
+        [&kernel]() {
+            kernel.create_kernel();
+            return JitCodeCache::Code{kernel.jit_ker(), kernel.getSize()};
+        },
+        [&copy, copyArg]() {
+            copy.reset(new Kernel(copyArg));
+            copy->create_kernel();
+            return JitCodeCache::Code{copy->jit_ker(), copy->getSize()};
+        });
+}
+
+int run(const JitCodeCache::CodePtr& code) {
+    return reinterpret_cast<int (*)()>(code.get())();
+}
+
+class JitCodeCacheStorageTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dir = ov::test::utils::generateTestFilePrefix() + "_jit_cache";
+        ov::test::utils::createDirectory(dir);
+        // the cache is used only if the directory can't be modified by the others
+        chmod(dir.c_str(), S_IRWXU);
+    }
+
+    void TearDown() override {
+        chmod(dir.c_str(), S_IRWXU);
+        ov::test::utils::removeFilesWithExt(dir, "bin");
+        ov::test::utils::removeDir(dir);
+    }
+
+    std::string storedFile() const {
+        const auto files = ov::test::utils::listFilesWithExt(dir, "bin");
+        return files.size() == 1 ? files.front() : std::string{};
+    }
+
+    std::string dir;
+};
+}  // namespace
+
+TEST_F(JitCodeCacheStorageTest, StoreAndLoadRelocatedCode) {
+    JitCodeCache::Key key("jit_table_kernel");
+    key << 42;
+
+    {
+        JitCodeCache cache(dir);
+        jit_table_kernel kernel(42);
+        const auto code = createKernel(cache, key, kernel, 42);
+        ASSERT_EQ(42, run(code));
+        const auto statistics = cache.getStatistics();
+        ASSERT_EQ(statistics.misses, 1u);
+        ASSERT_EQ(statistics.stored, 1u);
+    }
+
+    struct stat st;
+    ASSERT_EQ(0, stat(storedFile().c_str(), &st));
+    ASSERT_EQ(0u, st.st_mode & (S_IRWXG | S_IRWXO)) << "the file must be accessible by the owner only";
+
+    // another cache over the same directory emulates the next process
+    JitCodeCache cache(dir);
+    jit_table_kernel kernel(42);
+    const auto code = createKernel(cache, key, kernel, 42);
+    ASSERT_EQ(42, run(code));
+    ASSERT_EQ(nullptr, kernel.jit_ker()) << "the loaded kernel must not be generated";
+    // the loaded code is shared while it is used
+    jit_table_kernel another(42);
+    ASSERT_EQ(code, createKernel(cache, key, another, 42));
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits, 2u);
+    ASSERT_EQ(statistics.misses, 0u);
+}
+
+TEST_F(JitCodeCacheStorageTest, DifferentCopiesAreNotStored) {
+    JitCodeCache::Key key("jit_table_kernel");
+    key << 7;
+
+    // the value differs between the copies, so it is not an address inside the code
+    JitCodeCache cache(dir);
+    jit_table_kernel kernel(7);
+    const auto code = createKernel(cache, key, kernel, 8);
+    ASSERT_EQ(7, run(code));
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.notRelocatable, 1u);
+    ASSERT_EQ(statistics.stored, 0u);
+}
+
+TEST_F(JitCodeCacheStorageTest, ProcessAddressesAreNotStored) {
+    JitCodeCache::Key key("jit_static_kernel");
+
+    // the address is equal in both copies, so only the process memory check finds it
+    JitCodeCache cache(dir);
+    jit_static_kernel kernel(0);
+    const auto code = createKernel(cache, key, kernel, 0);
+    ASSERT_EQ(staticValue, run(code));
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.notRelocatable, 1u);
+    ASSERT_EQ(statistics.stored, 0u);
+    ASSERT_TRUE(storedFile().empty());
+}
+
+TEST_F(JitCodeCacheStorageTest, ModifiedFileIsRejected) {
+    JitCodeCache::Key key("jit_table_kernel");
+    key << 42;
+    {
+        JitCodeCache cache(dir);
+        jit_table_kernel kernel(42);
+        createKernel(cache, key, kernel, 42);
+    }
+
+    // replace the value in the table at the end of the code, the checksum is stored after the code
+    const auto path = storedFile();
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-static_cast<std::streamoff>(sizeof(uint64_t) + sizeof(int)), std::ios::end);
+        const int value = 13;
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    JitCodeCache cache(dir);
+    jit_table_kernel kernel(42);
+    const auto code = createKernel(cache, key, kernel, 42);
+    ASSERT_EQ(42, run(code));
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.rejected, 1u);
+    ASSERT_EQ(statistics.hits, 0u);
+    ASSERT_EQ(statistics.misses, 1u);
+}
+
+TEST_F(JitCodeCacheStorageTest, DirectoryWritableByOthersIsNotUsed) {
+    ASSERT_EQ(0, chmod(dir.c_str(), S_IRWXU | S_IRWXG | S_IRWXO));
+
+    JitCodeCache::Key key("jit_table_kernel");
+    key << 42;
+    JitCodeCache cache(dir);
+    jit_table_kernel kernel(42);
+    ASSERT_EQ(42, run(createKernel(cache, key, kernel, 42)));
+    ASSERT_EQ(cache.getStatistics().stored, 0u);
+    ASSERT_TRUE(storedFile().empty());
+}
+
+TEST_F(JitCodeCacheStorageTest, CapacityIsKept) {
+    size_t fileSize = 0;
+    {
+        JitCodeCache cache(dir);
+        JitCodeCache::Key key("jit_table_kernel");
+        key << 0;
+        jit_table_kernel kernel(0);
+        createKernel(cache, key, kernel, 0);
+        struct stat st;
+        ASSERT_EQ(0, stat(storedFile().c_str(), &st));
+        fileSize = st.st_size;
+    }
+
+    // the files of all the kernels are of the same size
+    JitCodeCache cache(dir, 2 * fileSize);
+    std::vector<std::unique_ptr<jit_table_kernel>> kernels;
+    for (int i = 1; i < 4; i++) {
+        JitCodeCache::Key key("jit_table_kernel");
+        key << i;
+        kernels.emplace_back(new jit_table_kernel(i));
+        createKernel(cache, key, *kernels.back(), i);
+    }
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.stored, 3u);
+    ASSERT_EQ(statistics.evicted, 2u);
+    ASSERT_EQ(ov::test::utils::listFilesWithExt(dir, "bin").size(), 2u);
+}
+#endif  // OPENVINO_ARCH_X86_64 && __linux__
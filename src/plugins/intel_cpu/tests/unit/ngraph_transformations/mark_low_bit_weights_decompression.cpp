@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <transformations/cpu_opset/common/pass/mark_low_bit_weights_decompression.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <openvino/core/model.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/pass/manager.hpp>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::shared_ptr<ov::opset1::Convert> makeDecompression(const ov::element::Type& weightsType) {
+    auto weights = ov::opset1::Constant::create(weightsType, ov::Shape{16, 32}, {1});
+    return std::make_shared<ov::opset1::Convert>(weights, ov::element::f32);
+}
+
+bool runAndCheckMark(const std::shared_ptr<ov::opset1::Convert>& convert) {
+    auto data = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{4, 32});
+    auto matmul = std::make_shared<ov::opset1::MatMul>(data, convert, false, true);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{matmul}, ov::ParameterVector{data});
+
+    ov::pass::Manager manager;
+    manager.register_pass<MarkLowBitWeightsDecompression>();
+    manager.run_passes(model);
+    return MarkLowBitWeightsDecompression::isMarked(convert);
+}
+
+}   // namespace
+
+TEST(MarkLowBitWeightsDecompressionTest, U4WeightsAreMarked) {
+    ASSERT_TRUE(runAndCheckMark(makeDecompression(ov::element::u4)));
+}
+
+TEST(MarkLowBitWeightsDecompressionTest, I4WeightsAreMarked) {
+    ASSERT_TRUE(runAndCheckMark(makeDecompression(ov::element::i4)));
+}
+
+TEST(MarkLowBitWeightsDecompressionTest, U8WeightsAreNotMarked) {
+    // u8 values may fit into 4 bits, but only the element type tells the weights are compressed to 4 bits
+    ASSERT_FALSE(runAndCheckMark(makeDecompression(ov::element::u8)));
+}
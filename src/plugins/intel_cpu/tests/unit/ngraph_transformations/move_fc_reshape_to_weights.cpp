@@ -105,3 +105,25 @@ INSTANTIATE_TEST_SUITE_P(TransformationTests_wo_transpose, MoveFCReshapeToWeight
                                 ::testing::ValuesIn(add_transpose),
                                 ::testing::ValuesIn(add_subtract)),
                             MoveFCReshapeToWeightsTests::getTestCaseName);
+
+TEST_F(TransformationTestsF, MoveFCReshapeToWeightsSingleGroup) {
+    auto init_model = [](const ov::Shape& weights_shape, const ov::Shape& decompression_shape, const bool add_reshape) {
+        auto data = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{-1, -1, 32});
+        std::shared_ptr<ov::Node> weights_path = ov::opset1::Constant::create(ov::element::u4, weights_shape, {1});
+        weights_path = std::make_shared<ov::opset1::Convert>(weights_path, ov::element::f32);
+        auto sub_const = ov::opset1::Constant::create(ov::element::f32, decompression_shape, {1});
+        weights_path = std::make_shared<ov::opset1::Subtract>(weights_path, sub_const);
+        auto mul_const = ov::opset1::Constant::create(ov::element::f32, decompression_shape, {1});
+        weights_path = std::make_shared<ov::opset1::Multiply>(weights_path, mul_const);
+        if (add_reshape) {
+            auto reshape_const = ov::opset1::Constant::create(ov::element::i32, {2}, {16, 32});
+            weights_path = std::make_shared<ov::opset1::Reshape>(weights_path, reshape_const, false);
+        }
+        auto fully_connected = std::make_shared<FullyConnectedNode>(data, weights_path, ov::Rank(3));
+        return std::make_shared<ov::Model>(ov::NodeVector{fully_connected}, ov::ParameterVector{data});
+    };
+
+    model = init_model({16, 1, 32}, {16, 1, 1}, true);
+    model_ref = init_model({16, 32}, {16, 1}, false);
+    manager.register_pass<MoveFCReshapeToWeights>();
+}
@@ -0,0 +1,146 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include <transformations/cpu_opset/common/pass/preprocess_fusion.hpp>
+#include <transformations/cpu_opset/common/op/preprocess.hpp>
+
+#include "openvino/opsets/opset1.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/opsets/opset11.hpp"
+
+using namespace testing;
+
+namespace {
+
+const std::vector<float> mean_values = {123.675f, 116.28f, 103.53f};
+const std::vector<float> scale_values = {58.395f, 57.12f, 57.375f};
+
+std::shared_ptr<ov::Node> make_interpolate(const ov::Output<ov::Node>& input, int64_t height, int64_t width) {
+    using Base = ov::op::util::InterpolateBase;
+    Base::InterpolateAttrs attrs(Base::InterpolateMode::LINEAR, Base::ShapeCalcMode::SIZES, {0, 0, 0, 0}, {0, 0, 0, 0});
+    auto sizes = ov::opset1::Constant::create(ov::element::i64, {2}, {height, width});
+    auto axes = ov::opset1::Constant::create(ov::element::i64, {2}, {1, 2});
+    return std::make_shared<ov::opset11::Interpolate>(input, sizes, axes, attrs);
+}
+
+}   // namespace
+
+class PreprocessFusionTest: public TransformationTestsF {
+public:
+    PreprocessFusionTest() : TransformationTestsF() {
+        comparator.enable(FunctionsComparator::CmpValues::ATTRIBUTES);
+        comparator.enable(FunctionsComparator::CmpValues::NAMES);
+    }
+};
+
+TEST_F(PreprocessFusionTest, NV12ResizeMeanScaleTranspose) {
+    const ov::PartialShape y_shape{1, 480, 640, 1};
+    const ov::PartialShape uv_shape{1, 240, 320, 2};
+    {
+        auto y = std::make_shared<ov::opset1::Parameter>(ov::element::u8, y_shape);
+        auto uv = std::make_shared<ov::opset1::Parameter>(ov::element::u8, uv_shape);
+        auto color_convert = std::make_shared<ov::opset8::NV12toRGB>(y, uv);
+        auto convert = std::make_shared<ov::opset1::Convert>(color_convert, ov::element::f32);
+        auto resize = make_interpolate(convert, 224, 224);
+        auto mean = std::make_shared<ov::opset1::Subtract>(
+            resize, ov::opset1::Constant::create(ov::element::f32, {1, 1, 1, 3}, mean_values));
+        auto scale = std::make_shared<ov::opset1::Divide>(
+            mean, ov::opset1::Constant::create(ov::element::f32, {1, 1, 1, 3}, scale_values));
+        auto transpose = std::make_shared<ov::opset1::Transpose>(
+            scale, ov::opset1::Constant::create(ov::element::i64, {4}, {0, 3, 1, 2}));
+        transpose->set_friendly_name("preprocess");
+
+        model = std::make_shared<ov::Model>(ov::NodeVector{transpose}, ov::ParameterVector{y, uv});
+        manager.register_pass<ov::intel_cpu::PreprocessFusion>();
+    }
+    {
+        ov::intel_cpu::PreprocessNode::Config config;
+        config.resize = true;
+        config.height = 224;
+        config.width = 224;
+        config.planar = true;
+        for (size_t c = 0; c < 3; c++) {
+            config.scale[c] = 1.f / scale_values[c];
+            config.shift[c] = -mean_values[c] / scale_values[c];
+        }
+
+        auto y = std::make_shared<ov::opset1::Parameter>(ov::element::u8, y_shape);
+        auto uv = std::make_shared<ov::opset1::Parameter>(ov::element::u8, uv_shape);
+        auto preprocess = std::make_shared<ov::intel_cpu::PreprocessNode>(ov::OutputVector{y, uv}, config);
+        preprocess->set_friendly_name("preprocess");
+
+        model_ref = std::make_shared<ov::Model>(ov::NodeVector{preprocess}, ov::ParameterVector{y, uv});
+    }
+}
+
+TEST_F(PreprocessFusionTest, I420SinglePlaneResizeScale) {
+    const ov::PartialShape shape{2, 360, 320, 1};
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto color_convert = std::make_shared<ov::opset8::I420toBGR>(input);
+        auto resize = make_interpolate(color_convert, 120, 160);
+        auto scale = std::make_shared<ov::opset1::Multiply>(
+            ov::opset1::Constant::create(ov::element::f32, {1}, {2.f}), resize);
+        auto shift = std::make_shared<ov::opset1::Add>(
+            scale, ov::opset1::Constant::create(ov::element::f32, {3}, {1.f, 2.f, 3.f}));
+        shift->set_friendly_name("preprocess");
+
+        model = std::make_shared<ov::Model>(ov::NodeVector{shift}, ov::ParameterVector{input});
+        manager.register_pass<ov::intel_cpu::PreprocessFusion>();
+    }
+    {
+        ov::intel_cpu::PreprocessNode::Config config;
+        config.i420 = true;
+        config.bgr = true;
+        config.resize = true;
+        config.height = 120;
+        config.width = 160;
+        config.scale = {2.f, 2.f, 2.f};
+        config.shift = {1.f, 2.f, 3.f};
+
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto preprocess = std::make_shared<ov::intel_cpu::PreprocessNode>(ov::OutputVector{input}, config);
+        preprocess->set_friendly_name("preprocess");
+
+        model_ref = std::make_shared<ov::Model>(ov::NodeVector{preprocess}, ov::ParameterVector{input});
+    }
+}
+
+TEST_F(PreprocessFusionTest, U8ColorConversionResultIsUsedTwice) {
+    auto y = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::PartialShape{1, 480, 640, 1});
+    auto uv = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::PartialShape{1, 240, 320, 2});
+    auto color_convert = std::make_shared<ov::opset8::NV12toRGB>(y, uv);
+    auto convert0 = std::make_shared<ov::opset1::Convert>(color_convert, ov::element::f32);
+    auto convert1 = std::make_shared<ov::opset1::Convert>(color_convert, ov::element::f32);
+
+    model = std::make_shared<ov::Model>(ov::NodeVector{convert0, convert1}, ov::ParameterVector{y, uv});
+    manager.register_pass<ov::intel_cpu::PreprocessFusion>();
+}
+
+// without the resize the color conversion and the eltwise chain are kept for the JIT nodes
+TEST_F(PreprocessFusionTest, ConvertScaleWithoutResizeIsNotFused) {
+    auto y = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::PartialShape{1, 480, 640, 1});
+    auto uv = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::PartialShape{1, 240, 320, 2});
+    auto color_convert = std::make_shared<ov::opset8::NV12toRGB>(y, uv);
+    auto convert = std::make_shared<ov::opset1::Convert>(color_convert, ov::element::f32);
+    auto scale = std::make_shared<ov::opset1::Multiply>(
+        convert, ov::opset1::Constant::create(ov::element::f32, {1}, {2.f}));
+
+    model = std::make_shared<ov::Model>(ov::NodeVector{scale}, ov::ParameterVector{y, uv});
+    manager.register_pass<ov::intel_cpu::PreprocessFusion>();
+}
+
+TEST_F(PreprocessFusionTest, U8ResizeIsNotFused) {
+    auto y = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::PartialShape{1, 480, 640, 1});
+    auto uv = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::PartialShape{1, 240, 320, 2});
+    auto color_convert = std::make_shared<ov::opset8::NV12toRGB>(y, uv);
+    auto resize = make_interpolate(color_convert, 224, 224);
+    auto convert = std::make_shared<ov::opset1::Convert>(resize, ov::element::f32);
+
+    model = std::make_shared<ov::Model>(ov::NodeVector{convert}, ov::ParameterVector{y, uv});
+    manager.register_pass<ov::intel_cpu::PreprocessFusion>();
+}
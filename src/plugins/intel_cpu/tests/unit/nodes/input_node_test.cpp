@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "graph_context.h"
+#include "nodes/input.h"
+#include "openvino/op/constant.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+void checkLazyConstantIsConvertedFromSource(const WeightsSharing::Ptr& weightsCache) {
+    const ov::Shape shape{64, 130};
+    std::vector<ov::float16> values(ov::shape_size(shape));
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = ov::float16(static_cast<float>(i % 700) / 8 - 40);
+    auto source = std::make_shared<ov::op::v0::Constant>(ov::element::f16, shape, values.data());
+
+    size_t transforms = 0;
+    auto transform = [&transforms](const ov::op::v0::Constant& source, void* data) {
+        transforms++;
+        const auto converted = source.cast_vector<float>();
+        std::copy(converted.begin(), converted.end(), static_cast<float*>(data));
+    };
+    auto constant = std::make_shared<ov::op::v0::Constant>(ov::element::f32, shape, source, transform);
+
+    Config conf;
+    auto context = std::make_shared<GraphContext>(conf, nullptr, weightsCache, false);
+    node::Input input(constant, context);
+
+    // the node converts the f16 source itself, the converted data is not produced in the constant
+    EXPECT_TRUE(constant->is_lazy());
+    EXPECT_EQ(transforms, 0u);
+
+    const auto memory = input.getMemoryPtr();
+    ASSERT_TRUE(memory);
+    ASSERT_EQ(memory->getSize(), values.size() * sizeof(float));
+    const auto data = static_cast<const float*>(memory->getData());
+    for (size_t i = 0; i < values.size(); i++)
+        ASSERT_EQ(data[i], static_cast<float>(values[i])) << i;
+}
+
+}  // namespace
+
+TEST(InputNodeTest, LazyConstantIsConvertedFromSource) {
+    checkLazyConstantIsConvertedFromSource(nullptr);
+}
+
+TEST(InputNodeTest, LazyConstantIsConvertedFromSourceWithWeightsCache) {
+    checkLazyConstantIsConvertedFromSource(std::make_shared<WeightsSharing>());
+}
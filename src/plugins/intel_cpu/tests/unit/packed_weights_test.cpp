@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+
+#include <cpu_memory.h>
+#include <packed_weights.h>
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+MemoryPtr makeMemory(const dnnl::engine& eng, size_t count, float value) {
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape{count});
+    auto memory = std::make_shared<Memory>(eng, desc);
+    auto data = static_cast<float*>(memory->getData());
+    for (size_t i = 0; i < count; i++) {
+        data[i] = value + i;
+    }
+    return memory;
+}
+} // namespace
+
+TEST(PackedWeightsTest, SerializeDeserialize) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    const auto key1 = PackedWeights::makeKey("conv1", "aBcd16b", 64);
+    const auto key2 = PackedWeights::makeKey("fc", "BA16a64b4a", 128);
+    auto mem1 = makeMemory(eng, 17, 1.f);
+    auto mem2 = makeMemory(eng, 256, 5.f);
+
+    PackedWeights exported;
+    exported.add(key1, mem1);
+    exported.add(key2, mem2);
+
+    std::stringstream stream;
+    stream << "model";
+    exported.serialize(stream);
+
+    std::string prefix(5, '\0');
+    stream.read(&prefix[0], prefix.size());
+    auto imported = PackedWeights::deserialize(stream);
+    ASSERT_NE(imported, nullptr);
+
+    auto data1 = imported->find(key1, mem1->getSize());
+    ASSERT_NE(data1, nullptr);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(data1) % 64, 0);
+    ASSERT_EQ(std::memcmp(data1, mem1->getData(), mem1->getSize()), 0);
+
+    auto data2 = imported->find(key2, mem2->getSize());
+    ASSERT_NE(data2, nullptr);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(data2) % 64, 0);
+    ASSERT_EQ(std::memcmp(data2, mem2->getData(), mem2->getSize()), 0);
+
+    // the size mismatch means another layout is selected
+    ASSERT_EQ(imported->find(key1, mem1->getSize() + 4), nullptr);
+    ASSERT_EQ(imported->find(PackedWeights::makeKey("conv1", "abcd", 64), mem1->getSize()), nullptr);
+}
+
+TEST(PackedWeightsTest, NoSection) {
+    std::stringstream stream;
+    stream << "model";
+    std::string model(5, '\0');
+    stream.read(&model[0], model.size());
+
+    ASSERT_EQ(PackedWeights::deserialize(stream), nullptr);
+    ASSERT_FALSE(stream.fail());
+}
+
+TEST(PackedWeightsTest, TruncatedSection) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    PackedWeights exported;
+    exported.add(PackedWeights::makeKey("conv1", "aBcd16b", 64), makeMemory(eng, 100, 0.f));
+
+    std::stringstream stream;
+    exported.serialize(stream);
+    auto content = stream.str();
+    std::stringstream truncated(content.substr(0, content.size() / 2));
+
+    ASSERT_ANY_THROW(PackedWeights::deserialize(truncated));
+}
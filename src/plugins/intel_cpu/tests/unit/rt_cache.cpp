@@ -9,6 +9,8 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/sharded_lru_cache.h"
+#include "nodes/common/dnnl_executor.h"
 
 using namespace ov::intel_cpu;
 
@@ -379,3 +381,176 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(ShardedLruCacheTests, PutGet) {
+    constexpr size_t capacity = 1024;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    ASSERT_EQ(cache.getCapacity(), capacity);
+
+    for (int i = 0; i < 64; ++i) {
+        ASSERT_EQ(cache.put({i}, i + 1), 0u);
+    }
+    for (int i = 0; i < 64; ++i) {
+        ASSERT_EQ(cache.get({i}), i + 1);
+    }
+    ASSERT_EQ(cache.get({64}), int());
+
+    ASSERT_EQ(cache.evict(capacity), 64u);
+    for (int i = 0; i < 64; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(ShardedLruCacheTests, SmallCapacityKeepsLruPolicy) {
+    constexpr size_t capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < static_cast<int>(capacity); ++i) {
+        ASSERT_EQ(cache.put({i}, i), 0u);
+    }
+    ASSERT_EQ(cache.get({0}), 0);
+    ASSERT_EQ(cache.put({static_cast<int>(capacity)}, 100), 1u);
+    // the least recently used record is displaced
+    ASSERT_EQ(cache.get({0}), 0);
+    ASSERT_EQ(cache.get({1}), int());
+    ASSERT_EQ(cache.get({static_cast<int>(capacity)}), 100);
+}
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr int capacity = 10;
+    auto builder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    MultiCache cache(capacity);
+
+    for (int i = 0; i < capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, builder);
+    }
+    for (int i = 0; i < capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, builder);
+    }
+    for (int i = capacity; i < capacity + 3; ++i) {
+        cache.getOrCreate(IntKey{i}, builder);
+    }
+
+    auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits, static_cast<size_t>(capacity));
+    ASSERT_EQ(stats.misses, static_cast<size_t>(capacity + 3));
+    ASSERT_EQ(stats.evictions, 3u);
+}
+
+TEST(MultiCacheTests, SharedCacheSync) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int capacity = 2048;
+    constexpr size_t numThreads = 30;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity);
+
+    auto testRoutine = [&]() {
+        for (int j = 0; j < 2; ++j) {
+            for (int i = 0; i < capacity / 2; ++i) {
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+                auto strResult = cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+                ASSERT_NE(strResult.first, StrValueType());
+                ASSERT_EQ(*strResult.first, std::to_string(i));
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits + stats.misses, numThreads * 2 * capacity);
+    // every record is created at least once and the concurrent creation of the same record is rare
+    ASSERT_GE(stats.misses, static_cast<size_t>(capacity));
+    ASSERT_GT(stats.hits, 0u);
+}
+
+namespace {
+struct StatelessValue {
+    int data;
+};
+} // namespace
+
+namespace ov {
+namespace intel_cpu {
+template<>
+struct IsStatelessCacheValue<std::shared_ptr<StatelessValue>> : std::true_type {};
+} // namespace intel_cpu
+} // namespace ov
+
+TEST(MultiCacheTests, OnlyStatelessRecordsAreShared) {
+    constexpr size_t capacity = 10;
+
+    auto statelessBuilder = [](const IntKey& key) { return std::make_shared<StatelessValue>(StatelessValue{key.data}); };
+    auto statefulBuilder = [](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    auto shared = std::make_shared<MultiCache>(capacity);
+    MultiCache stream0(capacity, shared);
+    MultiCache stream1(capacity, shared);
+
+    auto stateless0 = stream0.getOrCreate(IntKey{1}, statelessBuilder);
+    auto stateless1 = stream1.getOrCreate(IntKey{1}, statelessBuilder);
+    ASSERT_EQ(stateless0.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(stateless1.second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(stateless0.first, stateless1.first);
+
+    auto stateful0 = stream0.getOrCreate(IntKey{1}, statefulBuilder);
+    auto stateful1 = stream1.getOrCreate(IntKey{1}, statefulBuilder);
+    ASSERT_EQ(stateful0.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(stateful1.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_NE(stateful0.first, stateful1.first);
+    ASSERT_EQ(stream0.getOrCreate(IntKey{1}, statefulBuilder).first, stateful0.first);
+
+    ASSERT_EQ(shared->getStatistics().misses, 1u);
+    ASSERT_EQ(shared->getStatistics().hits, 1u);
+    ASSERT_EQ(stream0.getStatistics().misses, 1u);
+    ASSERT_EQ(stream0.getStatistics().hits, 1u);
+    ASSERT_EQ(stream1.getStatistics().misses, 1u);
+}
+
+namespace {
+class DerivedExecutor : public DnnlExecutor {
+public:
+    explicit DerivedExecutor(const dnnl::primitive_desc& pd) : DnnlExecutor(pd) {}
+};
+} // namespace
+
+TEST(MultiCacheTests, DerivedDnnlExecutorsAreShared) {
+    static_assert(IsStatelessCacheValue<std::shared_ptr<DerivedExecutor>>::value,
+                  "the executors derived from DnnlExecutor must be shared");
+    static_assert(!IsStatelessCacheValue<std::shared_ptr<int>>::value, "shared_ptr<int> must not be shared");
+
+    constexpr size_t capacity = 10;
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto builder = [&](const IntKey& key) {
+        const dnnl::memory::dims dims{1, key.data};
+        const dnnl::memory::desc src(dims, dnnl::memory::data_type::f32, dnnl::memory::format_tag::ab);
+        const dnnl::memory::desc dst(dims, dnnl::memory::data_type::f32, dnnl::memory::format_tag::ba);
+        return std::make_shared<DerivedExecutor>(dnnl::reorder::primitive_desc(eng, src, eng, dst));
+    };
+
+    auto shared = std::make_shared<MultiCache>(capacity);
+    MultiCache stream0(capacity, shared);
+    MultiCache stream1(capacity, shared);
+
+    auto executor0 = stream0.getOrCreate(IntKey{4}, builder);
+    auto executor1 = stream1.getOrCreate(IntKey{4}, builder);
+    ASSERT_EQ(executor0.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(executor1.second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(executor0.first, executor1.first);
+
+    ASSERT_EQ(shared->getStatistics().misses, 1u);
+    ASSERT_EQ(shared->getStatistics().hits, 1u);
+    ASSERT_EQ(stream0.getStatistics().misses + stream0.getStatistics().hits, 0u);
+}
@@ -0,0 +1,174 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <cpu_memory.h>
+#include <memory_desc/dnnl_blocked_memory_desc.h>
+#include <shared_weights_store.h>
+#include <common_test_utils/common_utils.hpp>
+#include <common_test_utils/file_utils.hpp>
+#include <openvino/core/hash_util.hpp>
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+class SharedWeightsStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        srcDesc = std::make_shared<DnnlBlockedMemoryDesc>(Shape{VectorDims{32, 16}},
+                                                          dnnl::memory::data_type::f32,
+                                                          dnnl::memory::format_tag::ab);
+        dstDesc = std::make_shared<DnnlBlockedMemoryDesc>(Shape{VectorDims{32, 16}},
+                                                          dnnl::memory::data_type::f32,
+                                                          dnnl::memory::format_tag::ba);
+        weights.resize(32 * 16);
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = static_cast<float>(i);
+    }
+
+    // emulates the weights reorder and counts the calls
+    std::function<MemoryPtr()> packer(int& calls) {
+        return [this, &calls]() {
+            calls++;
+            Memory src(eng, srcDesc, weights.data());
+            MemoryPtr dst = std::make_shared<Memory>(eng, dstDesc);
+            dst->load(src);
+            return dst;
+        };
+    }
+
+    static uint64_t dataHash(const std::vector<float>& data) {
+        return ov::util::hash_data(data.data(), data.size() * sizeof(float));
+    }
+
+    dnnl::engine eng{dnnl::engine::kind::cpu, 0};
+    DnnlMemoryDescPtr srcDesc;
+    DnnlMemoryDescPtr dstDesc;
+    std::vector<float> weights;
+};
+}  // namespace
+
+TEST_F(SharedWeightsStoreTest, KeyDependsOnContentAndLayout) {
+    const auto key = SharedWeightsStore::makeKey(*srcDesc, *dstDesc, weights.data(), dataHash(weights));
+    const auto copy = weights;
+    ASSERT_EQ(key, SharedWeightsStore::makeKey(*srcDesc, *dstDesc, copy.data(), dataHash(copy)));
+    ASSERT_NE(key, SharedWeightsStore::makeKey(*srcDesc, *srcDesc, weights.data(), dataHash(weights)));
+
+    auto changed = weights;
+    changed[7] += 1.f;
+    ASSERT_NE(key, SharedWeightsStore::makeKey(*srcDesc, *dstDesc, changed.data(), dataHash(changed)));
+}
+
+TEST_F(SharedWeightsStoreTest, KeyHashesDataIndependently) {
+    // the source hash collision of the different weights does not produce the same key
+    auto changed = weights;
+    changed[7] += 1.f;
+    ASSERT_NE(SharedWeightsStore::makeKey(*srcDesc, *dstDesc, weights.data(), 42),
+              SharedWeightsStore::makeKey(*srcDesc, *dstDesc, changed.data(), 42));
+    ASSERT_NE(SharedWeightsStore::makeKey(*srcDesc, *dstDesc, weights.data(), 42),
+              SharedWeightsStore::makeKey(*srcDesc, *dstDesc, weights.data(), 43));
+}
+
+TEST_F(SharedWeightsStoreTest, PackedOncePerNumaNode) {
+    SharedWeightsStore store("");
+    const auto key = SharedWeightsStore::makeKey(*srcDesc, *dstDesc, weights.data(), dataHash(weights));
+    int calls = 0;
+
+    auto first = store.findOrCreate(eng, key, 0, dstDesc, packer(calls));
+    auto second = store.findOrCreate(eng, key, 0, dstDesc, packer(calls));
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(calls, 1);
+
+    auto otherNode = store.findOrCreate(eng, key, 1, dstDesc, packer(calls));
+    ASSERT_NE(first, otherNode);
+    ASSERT_EQ(calls, 2);
+
+    // the weights are not kept when no graph uses them
+    first.reset();
+    second.reset();
+    store.findOrCreate(eng, key, 0, dstDesc, packer(calls));
+    ASSERT_EQ(calls, 3);
+
+    const auto statistics = store.getStatistics();
+    ASSERT_EQ(statistics.hits, 1u);
+    ASSERT_EQ(statistics.packed, 3u);
+}
+
+#if defined(__linux__)
+TEST_F(SharedWeightsStoreTest, MappedByAnotherProcess) {
+    const auto dir = ov::test::utils::generateTestFilePrefix() + "_shared_weights";
+    const auto key = SharedWeightsStore::makeKey(*srcDesc, *dstDesc, weights.data(), dataHash(weights));
+    int calls = 0;
+
+    SharedWeightsStore publisher(dir);
+    ov::test::utils::createDirectory(dir);
+    auto published = publisher.findOrCreate(eng, key, 0, dstDesc, packer(calls));
+    ASSERT_EQ(calls, 1);
+
+    // another store over the same directory emulates another process
+    SharedWeightsStore consumer(dir);
+    auto mapped = consumer.findOrCreate(eng, key, 0, dstDesc, packer(calls));
+    ASSERT_EQ(calls, 1);
+    ASSERT_EQ(consumer.getStatistics().mapped, 1u);
+    ASSERT_EQ(mapped->getSize(), published->getSize());
+    ASSERT_EQ(std::memcmp(mapped->getData(), published->getData(), mapped->getSize()), 0);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(mapped->getData()) % 64, 0u);
+
+    ov::test::utils::removeFilesWithExt(dir, "bin");
+    ov::test::utils::removeDir(dir);
+}
+
+TEST_F(SharedWeightsStoreTest, FileRemovedByLastUser) {
+    const auto dir = ov::test::utils::generateTestFilePrefix() + "_shared_weights";
+    const auto key = SharedWeightsStore::makeKey(*srcDesc, *dstDesc, weights.data(), dataHash(weights));
+    int calls = 0;
+
+    SharedWeightsStore publisher(dir);
+    auto published = publisher.findOrCreate(eng, key, 0, dstDesc, packer(calls));
+    SharedWeightsStore consumer(dir);
+    auto mapped = consumer.findOrCreate(eng, key, 0, dstDesc, packer(calls));
+    ASSERT_EQ(consumer.getStatistics().mapped, 1u);
+    ASSERT_EQ(ov::test::utils::listFilesWithExt(dir, "bin").size(), 1u);
+
+    published.reset();
+    ASSERT_EQ(ov::test::utils::listFilesWithExt(dir, "bin").size(), 1u);
+    mapped.reset();
+    ASSERT_TRUE(ov::test::utils::listFilesWithExt(dir, "bin").empty());
+
+    ov::test::utils::removeDir(dir);
+}
+
+TEST_F(SharedWeightsStoreTest, ModifiedFileIsNotMapped) {
+    const auto dir = ov::test::utils::generateTestFilePrefix() + "_shared_weights";
+    const auto key = SharedWeightsStore::makeKey(*srcDesc, *dstDesc, weights.data(), dataHash(weights));
+    int calls = 0;
+
+    SharedWeightsStore publisher(dir);
+    auto published = publisher.findOrCreate(eng, key, 0, dstDesc, packer(calls));
+    const auto files = ov::test::utils::listFilesWithExt(dir, "bin");
+    ASSERT_EQ(files.size(), 1u);
+    {
+        // the data is changed after the header was written, so the checksum does not match
+        std::fstream file(files.front(), std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-1, std::ios::end);
+        file.put('\x7f');
+    }
+
+    SharedWeightsStore consumer(dir);
+    auto packed = consumer.findOrCreate(eng, key, 0, dstDesc, packer(calls));
+    ASSERT_EQ(calls, 2);
+    ASSERT_EQ(consumer.getStatistics().mapped, 0u);
+
+    published.reset();
+    packed.reset();
+    ov::test::utils::removeFilesWithExt(dir, "bin");
+    ov::test::utils::removeDir(dir);
+}
+#endif  // __linux__
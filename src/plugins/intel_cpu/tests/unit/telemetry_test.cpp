@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <telemetry.h>
+
+using namespace ov::intel_cpu;
+
+TEST(LatencyHistogramTest, BucketsAreContinuous) {
+    for (uint64_t value = 0; value < 100000; value++) {
+        const auto index = LatencyHistogram::bucketIndex(value);
+        ASSERT_LE(value, LatencyHistogram::bucketUpperBound(index));
+        if (index > 0)
+            ASSERT_GT(value, LatencyHistogram::bucketUpperBound(index - 1));
+    }
+    ASSERT_EQ(LatencyHistogram::bucketIndex(UINT64_MAX), LatencyHistogram::bucketsCount - 1);
+}
+
+TEST(LatencyHistogramTest, Percentiles) {
+    LatencyHistogram histogram;
+    ASSERT_EQ(histogram.percentile(50), 0u);
+
+    for (uint64_t i = 1; i <= 1000; i++)
+        histogram.add(i * 1000);
+    ASSERT_EQ(histogram.count(), 1000u);
+
+    const auto p50 = histogram.percentile(50);
+    const auto p99 = histogram.percentile(99);
+    ASSERT_GE(p50, 500000u);
+    ASSERT_LE(p50, 500000u * 5 / 4);
+    ASSERT_GE(p99, 990000u);
+    ASSERT_LE(p99, 990000u * 5 / 4);
+
+    LatencyHistogram merged;
+    merged.merge(histogram);
+    merged.merge(histogram);
+    ASSERT_EQ(merged.count(), 2000u);
+    ASSERT_EQ(merged.percentile(50), p50);
+}
+
+TEST(GraphTelemetryTest, SamplingAndReport) {
+    GraphTelemetry telemetry(4, {"input", "relu"});
+    size_t sampled = 0;
+    for (size_t i = 0; i < 16; i++) {
+        if (telemetry.sample()) {
+            sampled++;
+            telemetry.requestLatency().add(2000);
+            telemetry.nodeLatency(1)->add(1000);
+        }
+    }
+    ASSERT_EQ(sampled, 4u);
+    ASSERT_EQ(telemetry.nodeLatency(2), nullptr);
+
+    GraphTelemetry::Report report;
+    report.accumulate(telemetry);
+    report.accumulate(telemetry);
+    const auto result = report.toMap();
+    ASSERT_EQ(result.at("inferences"), 32u);
+    ASSERT_EQ(result.at("sampled_inferences"), 8u);
+    ASSERT_EQ(result.at("node.relu.count"), 8u);
+    ASSERT_GE(result.at("node.relu.p99_ns"), 1000u);
+    ASSERT_GE(result.at("request_p50_ns"), 2000u);
+    // the nodes without samples are not reported
+    ASSERT_EQ(result.count("node.input.count"), 0u);
+}
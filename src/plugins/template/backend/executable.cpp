@@ -12,6 +12,8 @@ ov::runtime::Executable::Executable() {}
 
 ov::runtime::Executable::~Executable() {}
 
+void ov::runtime::Executable::set_concurrent_execution(bool) {}
+
 bool ov::runtime::Executable::call_with_validate(std::vector<ov::Tensor>& outputs,
                                                  const std::vector<ov::Tensor>& inputs) {
     validate(outputs, inputs);
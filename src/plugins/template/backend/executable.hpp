@@ -40,6 +40,10 @@ public:
     /// \brief Cancel and terminate the current execution
     virtual void cancel() = 0;
 
+    /// \brief Enables the concurrent execution of the operations which don't depend on each other
+    /// \param enable The operations are executed one by one if it is false
+    virtual void set_concurrent_execution(bool enable);
+
     /// \brief Executes a single iteration of a Function.
     /// \param outputs vector of runtime::Tensor used as outputs
     /// \param inputs vector of runtime::Tensor used as inputs
@@ -4,12 +4,15 @@
 
 #include "int_executable.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <exception>
 #include <limits>
 #include <openvino/op/util/variable_context.hpp>
 
 #include "evaluates_map.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/result.hpp"
 #include "openvino/op/util/op_types.hpp"
@@ -104,12 +107,42 @@ ov::runtime::interpreter::INTExecutable::INTExecutable(const std::shared_ptr<ov:
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_model);
+    set_concurrent_execution(false);
 }
 
 void ov::runtime::interpreter::INTExecutable::cancel() {
     m_cancel_execution = true;
 }
 
+void ov::runtime::interpreter::INTExecutable::set_concurrent_execution(bool enable) {
+    m_steps.clear();
+    if (!enable) {
+        for (const auto& node : m_nodes)
+            m_steps.push_back({node});
+        return;
+    }
+
+    // the step of the operation is the length of the longest path from the model inputs to it
+    std::unordered_map<const Node*, size_t> node_steps;
+    size_t next_variable_step = 0;
+    for (const auto& node : m_nodes) {
+        size_t step = 0;
+        for (const auto& input : node->input_values())
+            step = std::max(step, node_steps.at(input.get_node()) + 1);
+        for (const auto& dependency : node->get_control_dependencies())
+            step = std::max(step, node_steps.at(dependency.get()) + 1);
+        // the operations with the variables share the variable context, so they are kept in the original order
+        if (std::dynamic_pointer_cast<ov::op::util::VariableExtension>(node)) {
+            step = std::max(step, next_variable_step);
+            next_variable_step = step + 1;
+        }
+        node_steps[node.get()] = step;
+        if (m_steps.size() <= step)
+            m_steps.resize(step + 1);
+        m_steps[step].push_back(node);
+    }
+}
+
 bool ov::runtime::interpreter::INTExecutable::call(std::vector<ov::Tensor>& outputs,
                                                    const std::vector<ov::Tensor>& inputs,
                                                    bool collect_performance) {
@@ -163,55 +196,86 @@ bool ov::runtime::interpreter::INTExecutable::call(std::vector<ov::Tensor>& outp
 
     auto overrider = TemporaryOverrideOutputs(m_model, tensor_map);
 
-    // for each ordered op in the graph
-    for (const auto& op : m_nodes) {
-        CHECK_TERMINATE()
-        if (std::dynamic_pointer_cast<ov::op::v0::Parameter>(op)) {
-            continue;
-        }
-        // get op inputs from map
-        std::vector<ov::Tensor> op_inputs;
-        for (auto input : op->inputs()) {
-            auto tensor = input.get_tensor_ptr();
-            op_inputs.push_back(tensor_map.at(tensor));
+    auto evaluate_op = [&](const std::shared_ptr<Node>& op,
+                           std::vector<ov::Tensor>& op_outputs,
+                           const std::vector<ov::Tensor>& op_inputs) {
+        PERF(op, collect_performance);
+        // Call evaluate for cloned_node with static shapes
+        if (!op->evaluate(op_outputs, op_inputs, context)) {
+            // TODO: extend evaluate map for the context
+            evaluate_node(op, op_outputs, op_inputs);
         }
+    };
 
-        // get op outputs from map or create
-        std::vector<ov::Tensor> op_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i) {
-            auto tensor = op->output(i).get_tensor_ptr();
-            ov::Tensor host_tensor;
-            auto it = tensor_map.find(tensor);
-            auto output = op->output(i);
-            if (op::util::is_output(op) || it == tensor_map.end() || !it->second) {
-                host_tensor = ov::Tensor(output.get_element_type(),
-                                         output.get_partial_shape().is_dynamic()
-                                             ? ov::Shape{0, std::numeric_limits<size_t>::max()}
-                                             : output.get_shape());
-            } else {
-                host_tensor = it->second;
+    // for each step of the ordered ops in the graph
+    for (const auto& step : m_steps) {
+        CHECK_TERMINATE()
+        std::vector<std::shared_ptr<Node>> ops;
+        std::vector<std::vector<ov::Tensor>> ops_inputs, ops_outputs;
+        for (const auto& op : step) {
+            if (std::dynamic_pointer_cast<ov::op::v0::Parameter>(op)) {
+                continue;
+            }
+            // get op inputs from map
+            std::vector<ov::Tensor> op_inputs;
+            for (auto input : op->inputs()) {
+                auto tensor = input.get_tensor_ptr();
+                op_inputs.push_back(tensor_map.at(tensor));
             }
-            op_outputs.push_back(host_tensor);
+
+            // get op outputs from map or create
+            std::vector<ov::Tensor> op_outputs;
+            for (size_t i = 0; i < op->get_output_size(); ++i) {
+                auto tensor = op->output(i).get_tensor_ptr();
+                ov::Tensor host_tensor;
+                auto it = tensor_map.find(tensor);
+                auto output = op->output(i);
+                if (op::util::is_output(op) || it == tensor_map.end() || !it->second) {
+                    host_tensor = ov::Tensor(output.get_element_type(),
+                                             output.get_partial_shape().is_dynamic()
+                                                 ? ov::Shape{0, std::numeric_limits<size_t>::max()}
+                                                 : output.get_shape());
+                } else {
+                    host_tensor = it->second;
+                }
+                op_outputs.push_back(host_tensor);
+            }
+            ops.push_back(op);
+            ops_inputs.push_back(std::move(op_inputs));
+            ops_outputs.push_back(std::move(op_outputs));
         }
 
-        {
-            PERF(op, collect_performance);
-            // Call evaluate for cloned_node with static shapes
-            if (!op->evaluate(op_outputs, op_inputs, context)) {
-                // TODO: extend evaluate map for the context
-                evaluate_node(op, op_outputs, op_inputs);
+        if (ops.size() == 1) {
+            evaluate_op(ops[0], ops_outputs[0], ops_inputs[0]);
+        } else if (!ops.empty()) {
+            std::vector<std::exception_ptr> exceptions(ops.size());
+            ov::parallel_for(ops.size(), [&](size_t i) {
+                try {
+                    evaluate_op(ops[i], ops_outputs[i], ops_inputs[i]);
+                } catch (...) {
+                    exceptions[i] = std::current_exception();
+                }
+            });
+            for (const auto& exception : exceptions) {
+                if (exception)
+                    std::rethrow_exception(exception);
             }
         }
+
         // Update tensors in tensor map
-        for (size_t i = 0; i < op->get_output_size(); ++i) {
-            auto tensor = op->output(i).get_tensor_ptr();
-            tensor_map.insert({tensor, op_outputs[i]});
-            if (op::util::is_output(op)) {
-                auto& output = outputs[results_map[tensor]];
-                if (!output || output.get_shape() != op_outputs[i].get_shape()) {
-                    outputs[results_map[tensor]] = op_outputs[i];
-                } else {
-                    op_outputs[i].copy_to(output);
+        for (size_t n = 0; n < ops.size(); ++n) {
+            const auto& op = ops[n];
+            auto& op_outputs = ops_outputs[n];
+            for (size_t i = 0; i < op->get_output_size(); ++i) {
+                auto tensor = op->output(i).get_tensor_ptr();
+                tensor_map.insert({tensor, op_outputs[i]});
+                if (op::util::is_output(op)) {
+                    auto& output = outputs[results_map[tensor]];
+                    if (!output || output.get_shape() != op_outputs[i].get_shape()) {
+                        outputs[results_map[tensor]] = op_outputs[i];
+                    } else {
+                        op_outputs[i].copy_to(output);
+                    }
                 }
             }
         }
@@ -30,6 +30,8 @@ public:
 
     void cancel() override;
 
+    void set_concurrent_execution(bool enable) override;
+
     bool call(std::vector<ov::Tensor>& outputs,
               const std::vector<ov::Tensor>& inputs,
               bool collect_performance = false) override;
@@ -57,6 +59,8 @@ protected:
     bool m_is_compiled = false;
     std::shared_ptr<ov::Model> m_model;
     std::vector<std::shared_ptr<Node>> m_nodes;
+    // the operations of one step don't depend on each other
+    std::vector<std::vector<std::shared_ptr<Node>>> m_steps;
     std::atomic_bool m_cancel_execution{false};
     std::mutex m_mutex;
 
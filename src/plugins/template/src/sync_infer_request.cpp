@@ -58,6 +58,7 @@ ov::template_plugin::InferRequest::InferRequest(const std::shared_ptr<const ov::
     };
 
     m_executable = get_template_model()->get_template_plugin()->m_backend->compile(get_template_model()->m_model);
+    m_executable->set_concurrent_execution(get_template_model()->m_cfg.concurrent_ops_execution);
 
     // Allocate plugin backend specific memory handles
     m_backend_input_tensors.resize(get_inputs().size());
@@ -0,0 +1,283 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/opsets/opset11.hpp"
+#include "template/properties.hpp"
+
+namespace {
+std::shared_ptr<ov::Model> make_branched_model(size_t branches) {
+    auto data = std::make_shared<ov::opset11::Parameter>(ov::element::f32, ov::Shape{1, 64});
+    ov::OutputVector concat_inputs;
+    for (size_t i = 0; i < branches; i++) {
+        std::vector<float> weights(64 * 64);
+        std::iota(weights.begin(), weights.end(), static_cast<float>(i));
+        for (auto& weight : weights)
+            weight /= 4096.f;
+        auto constant = ov::opset11::Constant::create(ov::element::f32, ov::Shape{64, 64}, weights);
+        auto matmul = std::make_shared<ov::opset11::MatMul>(data, constant);
+        auto relu = std::make_shared<ov::opset11::Relu>(matmul);
+        auto multiply = std::make_shared<ov::opset11::Multiply>(relu, data);
+        concat_inputs.push_back(multiply);
+    }
+    auto concat = std::make_shared<ov::opset11::Concat>(concat_inputs, 1);
+    return std::make_shared<ov::Model>(ov::NodeVector{concat}, ov::ParameterVector{data});
+}
+
+ov::Tensor make_input(const ov::Shape& shape, size_t seed) {
+    ov::Tensor tensor(ov::element::f32, shape);
+    auto data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); i++)
+        data[i] = static_cast<float>((i * 37 + seed * 11) % 101) / 50.f - 1.f;
+    return tensor;
+}
+
+ov::Tensor infer(const std::shared_ptr<ov::Model>& model, const std::vector<ov::Tensor>& inputs) {
+    auto core = ov::test::utils::PluginCache::get().core("TEMPLATE");
+    auto request = core->compile_model(model, "TEMPLATE").create_infer_request();
+    for (size_t i = 0; i < inputs.size(); i++)
+        request.set_input_tensor(i, inputs[i]);
+    request.infer();
+    return request.get_output_tensor(0);
+}
+
+void compare(const ov::Tensor& actual, const std::vector<float>& expected) {
+    ASSERT_EQ(actual.get_size(), expected.size());
+    const auto data = actual.data<const float>();
+    for (size_t i = 0; i < expected.size(); i++)
+        ASSERT_NEAR(data[i], expected[i], 1e-4f * std::max(1.f, std::abs(expected[i]))) << "at index " << i;
+}
+}  // namespace
+
+/*
+ * The reference kernels split the output between the threads if the work amount exceeds 2 * parallel_min_work
+ * (2^16 scalar operations). The shapes below exceed it, and the numbers of the work items are primes or have
+ * uneven remainders for the usual thread counts, so the last range of each split is shorter than the others.
+ * The results are compared with the plain serial loops.
+ */
+
+TEST(ReferenceParallelKernelsTests, MatMul) {
+    const size_t M = 257, K = 129, N = 131;
+    auto a = std::make_shared<ov::opset11::Parameter>(ov::element::f32, ov::Shape{M, K});
+    auto b = std::make_shared<ov::opset11::Parameter>(ov::element::f32, ov::Shape{K, N});
+    auto matmul = std::make_shared<ov::opset11::MatMul>(a, b);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{matmul}, ov::ParameterVector{a, b});
+
+    const auto in_a = make_input({M, K}, 0), in_b = make_input({K, N}, 1);
+    const auto pa = in_a.data<const float>(), pb = in_b.data<const float>();
+    std::vector<float> expected(M * N, 0.f);
+    for (size_t i = 0; i < M; i++)
+        for (size_t k = 0; k < K; k++)
+            for (size_t j = 0; j < N; j++)
+                expected[i * N + j] += pa[i * K + k] * pb[k * N + j];
+
+    compare(infer(model, {in_a, in_b}), expected);
+}
+
+TEST(ReferenceParallelKernelsTests, BatchedMatMul) {
+    const size_t B = 13, M = 31, K = 67, N = 29;
+    auto a = std::make_shared<ov::opset11::Parameter>(ov::element::f32, ov::Shape{B, M, K});
+    auto b = std::make_shared<ov::opset11::Parameter>(ov::element::f32, ov::Shape{B, K, N});
+    auto matmul = std::make_shared<ov::opset11::MatMul>(a, b);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{matmul}, ov::ParameterVector{a, b});
+
+    const auto in_a = make_input({B, M, K}, 0), in_b = make_input({B, K, N}, 1);
+    const auto pa = in_a.data<const float>(), pb = in_b.data<const float>();
+    std::vector<float> expected(B * M * N, 0.f);
+    for (size_t n = 0; n < B; n++)
+        for (size_t i = 0; i < M; i++)
+            for (size_t k = 0; k < K; k++)
+                for (size_t j = 0; j < N; j++)
+                    expected[(n * M + i) * N + j] += pa[(n * M + i) * K + k] * pb[(n * K + k) * N + j];
+
+    compare(infer(model, {in_a, in_b}), expected);
+}
+
+TEST(ReferenceParallelKernelsTests, AddSameShapes) {
+    const ov::Shape shape{70001};
+    auto a = std::make_shared<ov::opset11::Parameter>(ov::element::f32, shape);
+    auto b = std::make_shared<ov::opset11::Parameter>(ov::element::f32, shape);
+    auto add = std::make_shared<ov::opset11::Add>(a, b);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{add}, ov::ParameterVector{a, b});
+
+    const auto in_a = make_input(shape, 0), in_b = make_input(shape, 1);
+    std::vector<float> expected(ov::shape_size(shape));
+    for (size_t i = 0; i < expected.size(); i++)
+        expected[i] = in_a.data<const float>()[i] + in_b.data<const float>()[i];
+
+    compare(infer(model, {in_a, in_b}), expected);
+}
+
+TEST(ReferenceParallelKernelsTests, AddNumpyBroadcast) {
+    const size_t D0 = 3, D1 = 257, D2 = 97;
+    auto a = std::make_shared<ov::opset11::Parameter>(ov::element::f32, ov::Shape{D0, D1, D2});
+    auto b = std::make_shared<ov::opset11::Parameter>(ov::element::f32, ov::Shape{D1, 1});
+    auto add = std::make_shared<ov::opset11::Add>(a, b);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{add}, ov::ParameterVector{a, b});
+
+    const auto in_a = make_input({D0, D1, D2}, 0), in_b = make_input({D1, 1}, 1);
+    std::vector<float> expected(D0 * D1 * D2);
+    for (size_t i = 0; i < D0; i++)
+        for (size_t j = 0; j < D1; j++)
+            for (size_t k = 0; k < D2; k++)
+                expected[(i * D1 + j) * D2 + k] = in_a.data<const float>()[(i * D1 + j) * D2 + k] + in_b.data<const float>()[j];
+
+    compare(infer(model, {in_a, in_b}), expected);
+}
+
+TEST(ReferenceParallelKernelsTests, Gather) {
+    const size_t D0 = 517, D1 = 131, D2 = 3, I = 64;
+    auto data = std::make_shared<ov::opset11::Parameter>(ov::element::f32, ov::Shape{D0, D1, D2});
+    std::vector<int32_t> indices(I);
+    for (size_t i = 0; i < I; i++)
+        indices[i] = static_cast<int32_t>((i * 7) % D1);
+    auto indices_const = ov::opset11::Constant::create(ov::element::i32, ov::Shape{I}, indices);
+    auto axis = ov::opset11::Constant::create(ov::element::i32, ov::Shape{}, {1});
+    auto gather = std::make_shared<ov::opset11::Gather>(data, indices_const, axis);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{gather}, ov::ParameterVector{data});
+
+    const auto input = make_input({D0, D1, D2}, 0);
+    std::vector<float> expected(D0 * I * D2);
+    for (size_t i = 0; i < D0; i++)
+        for (size_t j = 0; j < I; j++)
+            for (size_t k = 0; k < D2; k++)
+                expected[(i * I + j) * D2 + k] = input.data<const float>()[(i * D1 + indices[j]) * D2 + k];
+
+    compare(infer(model, {input}), expected);
+}
+
+namespace {
+// 3x3 window, stride 1, the padding of 1 keeps the spatial size
+constexpr size_t pool_c = 7, pool_hw = 131;
+
+template <typename Reduce>
+std::vector<float> pool_3x3(const ov::Tensor& input, float init, Reduce reduce, bool average) {
+    const auto data = input.data<const float>();
+    std::vector<float> expected(pool_c * pool_hw * pool_hw);
+    for (size_t c = 0; c < pool_c; c++) {
+        for (int64_t y = 0; y < static_cast<int64_t>(pool_hw); y++) {
+            for (int64_t x = 0; x < static_cast<int64_t>(pool_hw); x++) {
+                float acc = init;
+                size_t count = 0;
+                for (int64_t ky = y - 1; ky <= y + 1; ky++) {
+                    for (int64_t kx = x - 1; kx <= x + 1; kx++) {
+                        if (ky < 0 || kx < 0 || ky >= static_cast<int64_t>(pool_hw) || kx >= static_cast<int64_t>(pool_hw))
+                            continue;
+                        acc = reduce(acc, data[(c * pool_hw + ky) * pool_hw + kx]);
+                        count++;
+                    }
+                }
+                expected[(c * pool_hw + y) * pool_hw + x] = average ? acc / static_cast<float>(count) : acc;
+            }
+        }
+    }
+    return expected;
+}
+}  // namespace
+
+TEST(ReferenceParallelKernelsTests, AvgPool) {
+    const ov::Shape shape{1, pool_c, pool_hw, pool_hw};
+    auto data = std::make_shared<ov::opset11::Parameter>(ov::element::f32, shape);
+    auto pool = std::make_shared<ov::opset11::AvgPool>(data,
+                                                       ov::Strides{1, 1},
+                                                       ov::Shape{1, 1},
+                                                       ov::Shape{1, 1},
+                                                       ov::Shape{3, 3},
+                                                       true);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{pool}, ov::ParameterVector{data});
+
+    const auto input = make_input(shape, 0);
+    const auto expected = pool_3x3(input, 0.f, [](float acc, float value) { return acc + value; }, true);
+    compare(infer(model, {input}), expected);
+}
+
+TEST(ReferenceParallelKernelsTests, MaxPool) {
+    const ov::Shape shape{1, pool_c, pool_hw, pool_hw};
+    auto data = std::make_shared<ov::opset11::Parameter>(ov::element::f32, shape);
+    auto pool_v1 = std::make_shared<ov::op::v1::MaxPool>(data,
+                                                         ov::Strides{1, 1},
+                                                         ov::Shape{1, 1},
+                                                         ov::Shape{1, 1},
+                                                         ov::Shape{3, 3});
+    auto pool_v8 = std::make_shared<ov::op::v8::MaxPool>(data,
+                                                         ov::Strides{1, 1},
+                                                         ov::Strides{1, 1},
+                                                         ov::Shape{1, 1},
+                                                         ov::Shape{1, 1},
+                                                         ov::Shape{3, 3});
+
+    const auto input = make_input(shape, 0);
+    const auto expected = pool_3x3(input, std::numeric_limits<float>::lowest(), [](float acc, float value) {
+        return std::max(acc, value);
+    }, false);
+    compare(infer(std::make_shared<ov::Model>(ov::OutputVector{pool_v1->output(0)}, ov::ParameterVector{data}), {input}),
+            expected);
+    compare(infer(std::make_shared<ov::Model>(ov::OutputVector{pool_v8->output(0)}, ov::ParameterVector{data}), {input}),
+            expected);
+}
+
+TEST(ReferenceParallelKernelsTests, Convolution) {
+    const size_t N = 3, C = 5, F = 7, HW = 67, K = 3, OHW = HW - K + 1;
+    auto data = std::make_shared<ov::opset11::Parameter>(ov::element::f32, ov::Shape{N, C, HW, HW});
+    auto filters = std::make_shared<ov::opset11::Parameter>(ov::element::f32, ov::Shape{F, C, K, K});
+    auto conv = std::make_shared<ov::opset11::Convolution>(data,
+                                                           filters,
+                                                           ov::Strides{1, 1},
+                                                           ov::CoordinateDiff{0, 0},
+                                                           ov::CoordinateDiff{0, 0},
+                                                           ov::Strides{1, 1});
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{conv}, ov::ParameterVector{data, filters});
+
+    const auto input = make_input({N, C, HW, HW}, 0), weights = make_input({F, C, K, K}, 1);
+    const auto pi = input.data<const float>(), pw = weights.data<const float>();
+    std::vector<float> expected(N * F * OHW * OHW, 0.f);
+    for (size_t n = 0; n < N; n++)
+        for (size_t f = 0; f < F; f++)
+            for (size_t y = 0; y < OHW; y++)
+                for (size_t x = 0; x < OHW; x++) {
+                    float acc = 0.f;
+                    for (size_t c = 0; c < C; c++)
+                        for (size_t ky = 0; ky < K; ky++)
+                            for (size_t kx = 0; kx < K; kx++)
+                                acc += pi[((n * C + c) * HW + y + ky) * HW + x + kx] * pw[((f * C + c) * K + ky) * K + kx];
+                    expected[((n * F + f) * OHW + y) * OHW + x] = acc;
+                }
+
+    compare(infer(model, {input, weights}), expected);
+}
+
+TEST(ConcurrentOpsExecutionTests, TestTemplatePluginProperty) {
+    auto core = ov::test::utils::PluginCache::get().core("TEMPLATE");
+    auto model = make_branched_model(8);
+
+    ov::Tensor input(ov::element::f32, ov::Shape{1, 64});
+    auto input_data = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        input_data[i] = static_cast<float>(i % 7) - 3.f;
+
+    auto infer = [&](bool concurrent) {
+        auto compiled_model =
+            core->compile_model(model, "TEMPLATE", ov::template_plugin::concurrent_ops_execution(concurrent));
+        EXPECT_EQ(compiled_model.get_property(ov::template_plugin::concurrent_ops_execution), concurrent);
+        auto request = compiled_model.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        return request.get_output_tensor();
+    };
+    auto serial = infer(false);
+    auto concurrent = infer(true);
+
+    ASSERT_EQ(serial.get_shape(), concurrent.get_shape());
+    ASSERT_EQ(0, std::memcmp(serial.data(), concurrent.data(), serial.get_byte_size()));
+}